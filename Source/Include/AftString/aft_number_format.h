@@ -3,9 +3,15 @@
 
 #include <AftString/aft_string.h>
 
+#include <limits.h>
 #include <stdint.h>
 
 
+// Set as the maximum fraction or significant digits of a format to write
+// doubles with the fewest digits that read back as the same value.
+#define AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT INT_MAX
+
+
 typedef enum AftDecimalFormatRoundingMode
 {
     AFT_DECIMAL_FORMAT_ROUNDING_MODE_CEILING,
@@ -17,6 +23,15 @@ typedef enum AftDecimalFormatRoundingMode
     AFT_DECIMAL_FORMAT_ROUNDING_MODE_UP,
 } AftDecimalFormatRoundingMode;
 
+typedef enum AftFormatType
+{
+    AFT_FORMAT_TYPE_CODEPOINT,
+    AFT_FORMAT_TYPE_DOUBLE,
+    AFT_FORMAT_TYPE_INT64,
+    AFT_FORMAT_TYPE_SLICE,
+    AFT_FORMAT_TYPE_UINT64,
+} AftFormatType;
+
 typedef enum AftDecimalFormatStyle
 {
     AFT_DECIMAL_FORMAT_STYLE_CURRENCY,
@@ -32,6 +47,35 @@ typedef struct AftBaseFormat
     bool use_uppercase;
 } AftBaseFormat;
 
+// Numbers are written with the separator between them. Arrays of at least
+// chunk_size values each are split into chunks, to format on up to
+// thread_count threads.
+typedef struct AftBatchFormatOptions
+{
+    AftStringSlice separator;
+    int chunk_size;
+    int thread_count;
+} AftBatchFormatOptions;
+
+// Fields end at the delimiter or at a line break. Text is split into chunks
+// of at least chunk_size bytes, to parse on up to thread_count threads.
+typedef struct AftDelimitedParseOptions
+{
+    int chunk_size;
+    int thread_count;
+    char delimiter;
+} AftDelimitedParseOptions;
+
+// The field count includes any fields past the end of the values array,
+// which aren't parsed. The first error is the index of the first field that
+// isn't a valid number, or -1 if they all are.
+typedef struct AftDelimitedParseResult
+{
+    int error_count;
+    int field_count;
+    int first_error;
+} AftDelimitedParseResult;
+
 typedef struct AftNumberSymbols
 {
     AftString digits[10];
@@ -103,29 +147,127 @@ typedef struct AftDecimalFormat
     bool use_significant_digits;
 } AftDecimalFormat;
 
+typedef struct AftCompiledDecimalFormat
+{
+    AftString digits;
+    AftString exponential_sign;
+    AftString group_separator;
+    AftString negative_prefix;
+    AftString negative_suffix;
+    AftString positive_prefix;
+    AftString positive_suffix;
+    AftString radix_separator;
+    uint64_t grouping_mask;
+    int digit_starts[11];
+    int max_count;
+    int min_count;
+
+    union
+    {
+        struct
+        {
+            int max_fraction_digits;
+            int max_integer_digits;
+            int min_fraction_digits;
+            int min_integer_digits;
+        };
+
+        struct
+        {
+            int max_significant_digits;
+            int min_significant_digits;
+        };
+    };
+
+    int multiplier;
+    int rounding_increment;
+    AftDecimalFormatRoundingMode rounding_mode;
+    AftDecimalFormatStyle style;
+    int primary_grouping_size;
+    int secondary_grouping_size;
+    bool ascii_digits;
+    bool use_grouping;
+    bool use_significant_digits;
+} AftCompiledDecimalFormat;
+
+typedef struct AftFormatValue
+{
+    union
+    {
+        AftStringSlice slice;
+        double double_value;
+        int64_t int64_value;
+        uint64_t uint64_value;
+        char32_t codepoint;
+    };
+
+    const AftDecimalFormat* format;
+    AftFormatType type;
+} AftFormatValue;
+
 
 AftMaybeString aft_ascii_from_double(double value);
 AftMaybeString aft_ascii_from_double_with_allocator(double value, void* allocator);
 AftMaybeString aft_ascii_from_uint64(uint64_t value, const AftBaseFormat* format);
 AftMaybeString aft_ascii_from_uint64_with_allocator(uint64_t value, const AftBaseFormat* format, void* allocator);
 AftMaybeDouble aft_ascii_to_double(AftStringSlice slice);
+AftDelimitedParseResult aft_ascii_to_doubles(AftStringSlice text, const AftDelimitedParseOptions* options, double* values, bool* valid, int cap);
+AftMaybeFloat aft_ascii_to_float(AftStringSlice slice);
+AftMaybeInt32 aft_ascii_to_int32(AftStringSlice slice);
+AftMaybeInt32 aft_ascii_to_int32_with_base(AftStringSlice slice, int base, int* count);
+AftMaybeInt64 aft_ascii_to_int64(AftStringSlice slice);
+AftMaybeInt64 aft_ascii_to_int64_with_base(AftStringSlice slice, int base, int* count);
+AftDelimitedParseResult aft_ascii_to_int64s(AftStringSlice text, const AftDelimitedParseOptions* options, int64_t* values, bool* valid, int cap);
 AftMaybeUint64 aft_ascii_to_uint64(AftStringSlice slice);
+AftMaybeUint64 aft_ascii_to_uint64_with_base(AftStringSlice slice, int base, int* count);
+
+void aft_compiled_decimal_format_destroy(AftCompiledDecimalFormat* compiled);
 
+bool aft_decimal_format_compile(AftCompiledDecimalFormat* compiled, const AftDecimalFormat* format);
+bool aft_decimal_format_compile_with_allocator(AftCompiledDecimalFormat* compiled, const AftDecimalFormat* format, void* allocator);
 bool aft_decimal_format_default(AftDecimalFormat* format);
 bool aft_decimal_format_default_with_allocator(AftDecimalFormat* format, void* allocator);
 bool aft_decimal_format_default_scientific(AftDecimalFormat* format);
 bool aft_decimal_format_default_scientific_with_allocator(AftDecimalFormat* format, void* allocator);
 void aft_decimal_format_destroy(AftDecimalFormat* format);
+int aft_decimal_format_get_max_count(const AftDecimalFormat* format, AftFormatType type);
 bool aft_decimal_format_validate(const AftDecimalFormat* format);
 
+AftMaybeInt aft_double_to_buffer(double value, const AftDecimalFormat* format, char* buffer, int cap);
+AftMaybeInt aft_float_to_buffer(float value, const AftDecimalFormat* format, char* buffer, int cap);
+AftMaybeInt aft_int_to_buffer(int value, const AftDecimalFormat* format, char* buffer, int cap);
+AftMaybeInt aft_int64_to_buffer(int64_t value, const AftDecimalFormat* format, char* buffer, int cap);
+AftMaybeInt aft_uint64_to_buffer(uint64_t value, const AftDecimalFormat* format, char* buffer, int cap);
+
+AftFormatValue aft_format_value_from_codepoint(char32_t codepoint);
+AftFormatValue aft_format_value_from_double(double number, const AftDecimalFormat* format);
+AftFormatValue aft_format_value_from_int64(int64_t number, const AftDecimalFormat* format);
+AftFormatValue aft_format_value_from_slice(AftStringSlice slice);
+AftFormatValue aft_format_value_from_uint64(uint64_t number, const AftDecimalFormat* format);
+
+bool aft_string_append_double(AftString* string, double value, const AftDecimalFormat* format);
+bool aft_string_append_doubles(AftString* string, const double* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options);
+bool aft_string_append_float(AftString* string, float value, const AftDecimalFormat* format);
+bool aft_string_append_format(AftString* string, const char* pattern, const AftFormatValue* values, int count);
+bool aft_string_append_int(AftString* string, int value, const AftDecimalFormat* format);
+bool aft_string_append_int64(AftString* string, int64_t value, const AftDecimalFormat* format);
+bool aft_string_append_int64_compiled(AftString* string, int64_t value, const AftCompiledDecimalFormat* compiled);
+bool aft_string_append_int64s(AftString* string, const int64_t* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options);
+bool aft_string_append_uint64(AftString* string, uint64_t value, const AftDecimalFormat* format);
+bool aft_string_append_uint64_compiled(AftString* string, uint64_t value, const AftCompiledDecimalFormat* compiled);
+
 AftMaybeString aft_string_from_double(double value, const AftDecimalFormat* format);
 AftMaybeString aft_string_from_double_with_allocator(double value, const AftDecimalFormat* format, void* allocator);
+AftMaybeString aft_string_from_doubles(const double* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options);
+AftMaybeString aft_string_from_doubles_with_allocator(const double* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options, void* allocator);
 AftMaybeString aft_string_from_float(float value, const AftDecimalFormat* format);
 AftMaybeString aft_string_from_float_with_allocator(float value, const AftDecimalFormat* format, void* allocator);
 AftMaybeString aft_string_from_int(int value, const AftDecimalFormat* format);
 AftMaybeString aft_string_from_int_with_allocator(int value, const AftDecimalFormat* format, void* allocator);
 AftMaybeString aft_string_from_int64(int64_t value, const AftDecimalFormat* format);
 AftMaybeString aft_string_from_int64_with_allocator(int64_t value, const AftDecimalFormat* format, void* allocator);
+AftMaybeString aft_string_from_int64s(const int64_t* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options);
+AftMaybeString aft_string_from_int64s_with_allocator(const int64_t* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options, void* allocator);
 AftMaybeString aft_string_from_uint64(uint64_t value, const AftDecimalFormat* format);
 AftMaybeString aft_string_from_uint64_with_allocator(uint64_t value, const AftDecimalFormat* format, void* allocator);
 
@@ -11,6 +11,7 @@ extern "C" {
 #endif
 
 
+#define AFT_CODEPOINT_INDEX_STRIDE 64
 #define AFT_STRING_SMALL_CAP sizeof(AftStringBig)
 
 #if !defined(NDEBUG)
@@ -18,12 +19,44 @@ extern "C" {
 #endif // !defined(NDEBUG)
 
 
+typedef enum AftByteOrder
+{
+    AFT_BYTE_ORDER_BIG_ENDIAN,
+    AFT_BYTE_ORDER_LITTLE_ENDIAN,
+} AftByteOrder;
+
+typedef enum AftCodePage
+{
+    AFT_CODE_PAGE_LATIN_1,
+    AFT_CODE_PAGE_WINDOWS_1252,
+} AftCodePage;
+
+typedef enum AftConversion
+{
+    AFT_CONVERSION_LOSSY,
+    AFT_CONVERSION_STRICT,
+} AftConversion;
+
+typedef enum AftStringSortOrder
+{
+    AFT_STRING_SORT_ORDER_BYTE,
+    AFT_STRING_SORT_ORDER_ASCII_CASE_INSENSITIVE,
+} AftStringSortOrder;
+
+
 typedef struct AftMemoryBlock
 {
     void* memory;
     uint64_t bytes;
 } AftMemoryBlock;
 
+typedef struct AftByteSet
+{
+    uint64_t bits[4];
+    char bytes[4];
+    int count;
+} AftByteSet;
+
 typedef struct AftStringBig
 {
     char* contents;
@@ -62,12 +95,92 @@ typedef struct AftStringSlice
     int count;
 } AftStringSlice;
 
+// A handle keeps the length and the first bytes of a string alongside the
+// pointer to its contents, so most comparisons can be decided without reading
+// the contents at all. The prefix is packed most significant byte first, so
+// comparing prefixes as integers gives the same order as comparing the bytes.
+typedef struct AftStringHandle
+{
+    const char* contents;
+    uint32_t prefix;
+    int count;
+} AftStringHandle;
+
+typedef struct AftStringSortOptions
+{
+    AftStringSortOrder order;
+    int thread_count;
+} AftStringSortOptions;
+
+typedef struct AftTextPosition
+{
+    int line;
+    int column;
+} AftTextPosition;
+
+typedef struct AftUtf16String
+{
+    char16_t* contents;
+    int count;
+} AftUtf16String;
+
 typedef struct AftUtf32String
 {
     char32_t* contents;
     int count;
 } AftUtf32String;
 
+typedef struct AftLineIndex
+{
+    void* allocator;
+    int* line_starts;
+    int cap;
+    int count;
+    int text_count;
+} AftLineIndex;
+
+typedef struct AftLineIterator
+{
+    AftStringSlice slice;
+    uint64_t mask;
+    int index;
+    int mask_start;
+} AftLineIterator;
+
+typedef struct AftSplitOptions
+{
+    bool skip_empty;
+    bool trim_whitespace;
+} AftSplitOptions;
+
+// The iterator classifies the string 64 bytes at a time, keeping a mask with a
+// bit set for each delimiter in the current block. So each byte is looked at
+// once, no matter how many tokens are taken from the block.
+typedef struct AftSplitIterator
+{
+    AftByteSet delimiter_set;
+    AftStringSlice delimiter;
+    AftStringSlice slice;
+    uint64_t mask;
+    int index;
+    int mask_start;
+    bool done;
+    bool skip_empty;
+    bool trim_whitespace;
+} AftSplitIterator;
+
+// Byte offsets of every AFT_CODEPOINT_INDEX_STRIDE-th codepoint, so finding
+// a codepoint only scans forward from the nearest one.
+typedef struct AftCodepointIndex
+{
+    AftStringSlice slice;
+    void* allocator;
+    int* byte_offsets;
+    int cap;
+    int codepoint_count;
+    int count;
+} AftCodepointIndex;
+
 typedef struct AftCodepointIterator
 {
     AftStringSlice slice;
@@ -88,24 +201,54 @@ typedef struct AftMaybeDouble
     bool valid;
 } AftMaybeDouble;
 
+typedef struct AftMaybeFloat
+{
+    float value;
+    bool valid;
+} AftMaybeFloat;
+
 typedef struct AftMaybeInt
 {
     int value;
     bool valid;
 } AftMaybeInt;
 
+typedef struct AftMaybeInt32
+{
+    int32_t value;
+    bool valid;
+} AftMaybeInt32;
+
+typedef struct AftMaybeInt64
+{
+    int64_t value;
+    bool valid;
+} AftMaybeInt64;
+
 typedef struct AftMaybeString
 {
     AftString value;
     bool valid;
 } AftMaybeString;
 
+typedef struct AftMaybeStringSlice
+{
+    AftStringSlice value;
+    bool valid;
+} AftMaybeStringSlice;
+
 typedef struct AftMaybeUint64
 {
     uint64_t value;
     bool valid;
 } AftMaybeUint64;
 
+typedef struct AftMaybeUtf16String
+{
+    AftUtf16String value;
+    bool valid;
+} AftMaybeUtf16String;
+
 typedef struct AftMaybeUtf32String
 {
     AftUtf32String value;
@@ -136,10 +279,20 @@ char* aft_c_string_copy_string_with_allocator(const AftString* string, void* all
 bool aft_c_string_deallocate(char* string);
 bool aft_c_string_deallocate_with_allocator(void* allocator, char* string);
 
+bool aft_code_page_append_utf8(AftString* encoded, AftStringSlice utf8, AftCodePage code_page, AftConversion conversion);
+
+void aft_codepoint_index_destroy(AftCodepointIndex* index);
+int aft_codepoint_index_find_byte(const AftCodepointIndex* index, int codepoint_index);
+int aft_codepoint_index_find_codepoint(const AftCodepointIndex* index, int byte_index);
+int aft_codepoint_index_get_codepoint_count(const AftCodepointIndex* index);
+bool aft_codepoint_index_initialise(AftCodepointIndex* index, AftStringSlice slice);
+bool aft_codepoint_index_initialise_with_allocator(AftCodepointIndex* index, AftStringSlice slice, void* allocator);
+
 void aft_codepoint_iterator_end(AftCodepointIterator* it);
 int aft_codepoint_iterator_get_index(AftCodepointIterator* it);
 AftStringSlice aft_codepoint_iterator_get_string(AftCodepointIterator* it);
 AftMaybeChar32 aft_codepoint_iterator_next(AftCodepointIterator* it);
+int aft_codepoint_iterator_next_batch(AftCodepointIterator* it, char32_t* codepoints, int max);
 AftMaybeChar32 aft_codepoint_iterator_prior(AftCodepointIterator* it);
 void aft_codepoint_iterator_set_string(AftCodepointIterator* it, AftStringSlice slice);
 void aft_codepoint_iterator_start(AftCodepointIterator* it);
@@ -147,10 +300,29 @@ void aft_codepoint_iterator_start(AftCodepointIterator* it);
 AftMemoryBlock aft_allocate(void* allocator, uint64_t bytes);
 bool aft_deallocate(void* allocator, AftMemoryBlock block);
 
+void aft_line_index_destroy(AftLineIndex* index);
+AftTextPosition aft_line_index_find_position(const AftLineIndex* index, int offset);
+AftStringSlice aft_line_index_get_line(const AftLineIndex* index, AftStringSlice text, int line);
+int aft_line_index_get_line_count(const AftLineIndex* index);
+int aft_line_index_get_line_start(const AftLineIndex* index, int line);
+void aft_line_index_initialise(AftLineIndex* index);
+void aft_line_index_initialise_with_allocator(AftLineIndex* index, void* allocator);
+bool aft_line_index_update(AftLineIndex* index, AftStringSlice text);
+
+AftMaybeStringSlice aft_line_iterator_next(AftLineIterator* it);
+void aft_line_iterator_set_string(AftLineIterator* it, AftStringSlice slice);
+
+AftMaybeStringSlice aft_split_iterator_next(AftSplitIterator* it);
+void aft_split_iterator_set_delimiter_byte(AftSplitIterator* it, AftStringSlice slice, char delimiter, const AftSplitOptions* options);
+void aft_split_iterator_set_delimiter_byte_set(AftSplitIterator* it, AftStringSlice slice, AftStringSlice delimiters, const AftSplitOptions* options);
+void aft_split_iterator_set_delimiter_string(AftSplitIterator* it, AftStringSlice slice, AftStringSlice delimiter, const AftSplitOptions* options);
+
 bool aft_string_add(AftString* to, AftStringSlice from, int index);
 bool aft_string_append(AftString* to, const AftString* from);
 bool aft_string_append_c_string(AftString* to, const char* from);
 bool aft_string_append_char(AftString* to, char from);
+bool aft_string_append_many(AftString* to, const AftStringSlice* slices, int count);
+bool aft_string_append_repeated(AftString* to, AftStringSlice from, int repeats);
 bool aft_string_append_slice(AftString* to, AftStringSlice from);
 bool aft_string_assign(AftString* to, const AftString* from);
 AftMaybeString aft_string_copy(AftString* string);
@@ -166,9 +338,22 @@ const char* aft_string_get_contents_const(const AftString* string);
 int aft_string_get_count(const AftString* string);
 void aft_string_initialise(AftString* string);
 void aft_string_initialise_with_allocator(AftString* string, void* allocator);
+AftMaybeString aft_string_join(AftStringSlice separator, const AftStringSlice* slices, int count);
+AftMaybeString aft_string_join_with_allocator(AftStringSlice separator, const AftStringSlice* slices, int count, void* allocator);
 void aft_string_remove(AftString* string, int start, int end);
 bool aft_string_replace(AftString* to, int start, int end, AftStringSlice from);
 bool aft_string_reserve(AftString* string, int count);
+bool aft_string_sort(AftString* strings, int count, const AftStringSortOptions* options);
+bool aft_string_sort_with_allocator(AftString* strings, int count, const AftStringSortOptions* options, void* allocator);
+
+void aft_string_handle_array_from_slices(AftStringHandle* handles, const AftStringSlice* slices, int count);
+void aft_string_handle_array_from_strings(AftStringHandle* handles, const AftString* strings, int count);
+int aft_string_handle_compare(AftStringHandle a, AftStringHandle b);
+AftStringHandle aft_string_handle_from_slice(AftStringSlice slice);
+AftStringHandle aft_string_handle_from_string(const AftString* string);
+AftStringSlice aft_string_handle_get_slice(AftStringHandle handle);
+uint64_t aft_string_handle_hash(AftStringHandle handle);
+bool aft_string_handle_matches(AftStringHandle a, AftStringHandle b);
 
 bool aft_string_range_check(const AftString* string, int start, int end);
 
@@ -187,20 +372,34 @@ bool aft_string_slice_in_string(AftStringSlice slice, const AftString* string);
 bool aft_string_slice_matches(AftStringSlice a, AftStringSlice b);
 void aft_string_slice_remove_end(AftStringSlice* slice, int count);
 void aft_string_slice_remove_start(AftStringSlice* slice, int count);
+bool aft_string_slice_sort(AftStringSlice* slices, int count, const AftStringSortOptions* options);
+bool aft_string_slice_sort_with_allocator(AftStringSlice* slices, int count, const AftStringSortOptions* options, void* allocator);
 const char* aft_string_slice_start(AftStringSlice slice);
 bool aft_string_slice_starts_with(AftStringSlice slice, AftStringSlice lookup);
 AftStringSlice aft_string_slice_string(const AftString* string, int start, int end);
 
 bool aft_strings_match(const AftString* a, const AftString* b);
 
+bool aft_utf16_destroy(AftUtf16String* string);
+bool aft_utf16_destroy_with_allocator(AftUtf16String* string, void* allocator);
+AftMaybeInt aft_utf16_get_utf8_count(const char16_t* contents, int count, AftByteOrder byte_order);
+AftMaybeString aft_utf16_to_utf8(const AftUtf16String* string, AftByteOrder byte_order);
+AftMaybeInt aft_utf16_to_utf8_buffer(const char16_t* contents, int count, AftByteOrder byte_order, char* buffer, int cap);
+AftMaybeString aft_utf16_to_utf8_with_allocator(const AftUtf16String* string, AftByteOrder byte_order, void* allocator);
+
 bool aft_utf32_destroy(AftUtf32String* string);
 bool aft_utf32_destroy_with_allocator(AftUtf32String* string, void* allocator);
 AftMaybeString aft_utf32_to_utf8(const AftUtf32String* string);
 AftMaybeString aft_utf32_to_utf8_with_allocator(const AftUtf32String* string, void* allocator);
 
 bool aft_utf8_append_codepoint(AftString* string, char32_t codepoint);
+bool aft_utf8_append_code_page(AftString* string, AftStringSlice encoded, AftCodePage code_page);
 bool aft_utf8_check(const AftString* string);
 int aft_utf8_codepoint_count(const AftString* string);
+AftMaybeInt aft_utf8_get_utf16_count(AftStringSlice slice);
+AftMaybeStringSlice aft_utf8_sanitize(AftStringSlice slice, AftString* buffer);
+AftMaybeUtf16String aft_utf8_to_utf16(const AftString* string, AftByteOrder byte_order);
+AftMaybeInt aft_utf8_to_utf16_buffer(AftStringSlice slice, AftByteOrder byte_order, char16_t* buffer, int cap);
 AftMaybeUtf32String aft_utf8_to_utf32(const AftString* string);
 
 
@@ -0,0 +1,107 @@
+#ifndef AFT_UNICODE_H_
+#define AFT_UNICODE_H_
+
+#include <AftString/aft_string.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <uchar.h>
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+
+#define AFT_CASE_FOLD_MAX 3
+#define AFT_UNICODE_CLASS_CATEGORY_MASK 0x1f
+#define AFT_UNICODE_CLASS_ALPHABETIC 0x20
+#define AFT_UNICODE_CLASS_WHITESPACE 0x40
+
+
+typedef enum AftCaseFolding
+{
+    AFT_CASE_FOLDING_FULL,
+    AFT_CASE_FOLDING_SIMPLE,
+} AftCaseFolding;
+
+typedef enum AftUnicodeCategory
+{
+    AFT_UNICODE_CATEGORY_UNASSIGNED,
+    AFT_UNICODE_CATEGORY_UPPERCASE_LETTER,
+    AFT_UNICODE_CATEGORY_LOWERCASE_LETTER,
+    AFT_UNICODE_CATEGORY_TITLECASE_LETTER,
+    AFT_UNICODE_CATEGORY_MODIFIER_LETTER,
+    AFT_UNICODE_CATEGORY_OTHER_LETTER,
+    AFT_UNICODE_CATEGORY_NONSPACING_MARK,
+    AFT_UNICODE_CATEGORY_SPACING_MARK,
+    AFT_UNICODE_CATEGORY_ENCLOSING_MARK,
+    AFT_UNICODE_CATEGORY_DECIMAL_NUMBER,
+    AFT_UNICODE_CATEGORY_LETTER_NUMBER,
+    AFT_UNICODE_CATEGORY_OTHER_NUMBER,
+    AFT_UNICODE_CATEGORY_CONNECTOR_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_DASH_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_OPEN_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_CLOSE_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_INITIAL_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_FINAL_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_OTHER_PUNCTUATION,
+    AFT_UNICODE_CATEGORY_MATH_SYMBOL,
+    AFT_UNICODE_CATEGORY_CURRENCY_SYMBOL,
+    AFT_UNICODE_CATEGORY_MODIFIER_SYMBOL,
+    AFT_UNICODE_CATEGORY_OTHER_SYMBOL,
+    AFT_UNICODE_CATEGORY_SPACE_SEPARATOR,
+    AFT_UNICODE_CATEGORY_LINE_SEPARATOR,
+    AFT_UNICODE_CATEGORY_PARAGRAPH_SEPARATOR,
+    AFT_UNICODE_CATEGORY_CONTROL,
+    AFT_UNICODE_CATEGORY_FORMAT,
+    AFT_UNICODE_CATEGORY_SURROGATE,
+    AFT_UNICODE_CATEGORY_PRIVATE_USE,
+} AftUnicodeCategory;
+
+typedef struct AftGraphemeIterator
+{
+    AftStringSlice slice;
+    int index;
+} AftGraphemeIterator;
+
+typedef struct AftWordIterator
+{
+    AftStringSlice slice;
+    int index;
+} AftWordIterator;
+
+
+AftMaybeStringSlice aft_grapheme_iterator_next(AftGraphemeIterator* it);
+void aft_grapheme_iterator_set_string(AftGraphemeIterator* it, AftStringSlice slice);
+
+AftMaybeInt aft_unicode_classify(AftStringSlice slice, uint8_t* classes, int cap);
+AftUnicodeCategory aft_unicode_get_category(char32_t c);
+uint8_t aft_unicode_get_class(char32_t c);
+char32_t aft_unicode_fold_case_simple(char32_t c);
+int aft_unicode_fold_case_full(char32_t c, char32_t* folded);
+bool aft_unicode_is_alphabetic(char32_t c);
+bool aft_unicode_is_alphanumeric(char32_t c);
+bool aft_unicode_is_letter(char32_t c);
+bool aft_unicode_is_lowercase(char32_t c);
+bool aft_unicode_is_mark(char32_t c);
+bool aft_unicode_is_numeric(char32_t c);
+bool aft_unicode_is_punctuation(char32_t c);
+bool aft_unicode_is_uppercase(char32_t c);
+bool aft_unicode_is_whitespace(char32_t c);
+
+bool aft_utf8_equals_folded(AftStringSlice a, AftStringSlice b);
+AftMaybeInt aft_utf8_find_folded(AftStringSlice haystack, AftStringSlice needle);
+bool aft_utf8_fold_case(AftString* folded, AftStringSlice slice, AftCaseFolding folding);
+AftMaybeStringSlice aft_utf8_normalize_nfc(AftStringSlice slice, AftString* buffer);
+AftMaybeStringSlice aft_utf8_normalize_nfd(AftStringSlice slice, AftString* buffer);
+
+AftMaybeStringSlice aft_word_iterator_next(AftWordIterator* it);
+void aft_word_iterator_set_string(AftWordIterator* it, AftStringSlice slice);
+
+
+#if defined(__cplusplus)
+} // extern "C"
+#endif
+
+#endif // AFT_UNICODE_H_
@@ -0,0 +1,385 @@
+#include <AftString/aft_unicode.h>
+
+#include "byte_set.h"
+#include "unicode_data.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+#define AFT_CODEPOINT_MAX 0x10ffff
+
+
+// Reads the case folded codepoints of a string one at a time, holding the
+// rest of a codepoint's full case folding when it's more than one.
+typedef struct FoldReader
+{
+    AftCodepointIterator it;
+    char32_t pending[AFT_CASE_FOLD_MAX];
+    int pending_count;
+    int pending_index;
+} FoldReader;
+
+
+static char fold_ascii(char c)
+{
+    if(c >= 'A' && c <= 'Z')
+    {
+        return c + ('a' - 'A');
+    }
+
+    return c;
+}
+
+#if defined(USE_SSE2)
+
+// Lowercase any ASCII uppercase letters in a block. Bytes above 0x7f are
+// negative when compared as signed, so those are left alone.
+static __m128i fold_ascii_block(__m128i bytes)
+{
+    __m128i above = _mm_cmpgt_epi8(bytes, _mm_set1_epi8('A' - 1));
+    __m128i below = _mm_cmplt_epi8(bytes, _mm_set1_epi8('Z' + 1));
+    __m128i uppercase = _mm_and_si128(above, below);
+    return _mm_add_epi8(bytes, _mm_and_si128(uppercase, _mm_set1_epi8('a' - 'A')));
+}
+
+#endif // defined(USE_SSE2)
+
+static void fold_reader_start(FoldReader* reader, AftStringSlice slice)
+{
+    aft_codepoint_iterator_set_string(&reader->it, slice);
+    reader->pending_count = 0;
+    reader->pending_index = 0;
+}
+
+static bool fold_reader_at_boundary(const FoldReader* reader)
+{
+    return reader->pending_index >= reader->pending_count;
+}
+
+static bool fold_reader_at_end(const FoldReader* reader)
+{
+    return fold_reader_at_boundary(reader) && reader->it.index == reader->it.end;
+}
+
+static bool fold_reader_next(FoldReader* reader, char32_t* c)
+{
+    if(reader->pending_index < reader->pending_count)
+    {
+        *c = reader->pending[reader->pending_index];
+        reader->pending_index += 1;
+        return true;
+    }
+
+    AftCodepointIterator* it = &reader->it;
+
+    if(it->index < it->end)
+    {
+        char byte = aft_string_slice_start(it->slice)[it->index];
+
+        if((uint8_t) byte < 0x80)
+        {
+            *c = (uint8_t) fold_ascii(byte);
+            it->index += 1;
+            return true;
+        }
+    }
+
+    AftMaybeChar32 codepoint = aft_codepoint_iterator_next(it);
+
+    if(!codepoint.valid)
+    {
+        return false;
+    }
+
+    reader->pending_count = aft_unicode_fold_case_full(codepoint.value, reader->pending);
+    reader->pending_index = 1;
+    *c = reader->pending[0];
+
+    return true;
+}
+
+// Check whether the whole needle matches, when folded, the start of the
+// haystack. The match has to end at the end of a haystack codepoint's
+// folding, so a needle "s" doesn't match half of "ß".
+static bool matches_folded_at(AftStringSlice haystack, int start, AftStringSlice needle)
+{
+    FoldReader haystack_reader;
+    int count = aft_string_slice_count(haystack);
+    fold_reader_start(&haystack_reader, aft_string_slice(haystack, start, count));
+
+    FoldReader needle_reader;
+    fold_reader_start(&needle_reader, needle);
+
+    for(;;)
+    {
+        char32_t needle_codepoint;
+
+        if(!fold_reader_next(&needle_reader, &needle_codepoint))
+        {
+            return fold_reader_at_end(&needle_reader)
+                    && fold_reader_at_boundary(&haystack_reader);
+        }
+
+        char32_t haystack_codepoint;
+
+        if(!fold_reader_next(&haystack_reader, &haystack_codepoint)
+                || haystack_codepoint != needle_codepoint)
+        {
+            return false;
+        }
+    }
+}
+
+
+char32_t aft_unicode_fold_case_simple(char32_t c)
+{
+    if(c > AFT_CODEPOINT_MAX)
+    {
+        return c;
+    }
+
+    uint8_t record = unicode_case_fold_lookup(c);
+    return c + unicode_case_fold_deltas[record];
+}
+
+int aft_unicode_fold_case_full(char32_t c, char32_t* folded)
+{
+    AFT_ASSERT(folded);
+
+    if(c > AFT_CODEPOINT_MAX)
+    {
+        folded[0] = c;
+        return 1;
+    }
+
+    uint8_t record = unicode_case_fold_lookup(c);
+    int sequence_index = unicode_case_fold_sequence_indices[record];
+
+    if(!sequence_index)
+    {
+        folded[0] = c + unicode_case_fold_deltas[record];
+        return 1;
+    }
+
+    const uint32_t* sequence = &unicode_case_fold_sequences[AFT_CASE_FOLD_MAX * sequence_index];
+    int count = 0;
+
+    while(count < AFT_CASE_FOLD_MAX && sequence[count])
+    {
+        folded[count] = sequence[count];
+        count += 1;
+    }
+
+    return count;
+}
+
+
+bool aft_utf8_equals_folded(AftStringSlice a, AftStringSlice b)
+{
+    FoldReader reader_a;
+    fold_reader_start(&reader_a, a);
+
+    FoldReader reader_b;
+    fold_reader_start(&reader_b, b);
+
+    for(;;)
+    {
+#if defined(USE_SSE2)
+        AftCodepointIterator* it_a = &reader_a.it;
+        AftCodepointIterator* it_b = &reader_b.it;
+
+        if(fold_reader_at_boundary(&reader_a)
+                && fold_reader_at_boundary(&reader_b)
+                && it_a->end - it_a->index >= 16
+                && it_b->end - it_b->index >= 16)
+        {
+            const char* contents_a = aft_string_slice_start(it_a->slice);
+            const char* contents_b = aft_string_slice_start(it_b->slice);
+            __m128i bytes_a = _mm_loadu_si128((const __m128i*) &contents_a[it_a->index]);
+            __m128i bytes_b = _mm_loadu_si128((const __m128i*) &contents_b[it_b->index]);
+
+            if(!_mm_movemask_epi8(_mm_or_si128(bytes_a, bytes_b)))
+            {
+                __m128i equal = _mm_cmpeq_epi8(fold_ascii_block(bytes_a), fold_ascii_block(bytes_b));
+
+                if(_mm_movemask_epi8(equal) != 0xffff)
+                {
+                    return false;
+                }
+
+                it_a->index += 16;
+                it_b->index += 16;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        char32_t codepoint_a;
+        char32_t codepoint_b;
+        bool has_a = fold_reader_next(&reader_a, &codepoint_a);
+        bool has_b = fold_reader_next(&reader_b, &codepoint_b);
+
+        if(!has_a || !has_b)
+        {
+            return !has_a
+                    && !has_b
+                    && fold_reader_at_end(&reader_a)
+                    && fold_reader_at_end(&reader_b);
+        }
+
+        if(codepoint_a != codepoint_b)
+        {
+            return false;
+        }
+    }
+}
+
+AftMaybeInt aft_utf8_find_folded(AftStringSlice haystack, AftStringSlice needle)
+{
+    AftMaybeInt result = {0, false};
+
+    FoldReader needle_reader;
+    fold_reader_start(&needle_reader, needle);
+
+    char32_t first;
+
+    if(!fold_reader_next(&needle_reader, &first))
+    {
+        result.valid = fold_reader_at_end(&needle_reader);
+        return result;
+    }
+
+    const char* contents = aft_string_slice_start(haystack);
+    int count = aft_string_slice_count(haystack);
+    int index = 0;
+
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        // Skip ahead to either a byte that folds to the first codepoint of
+        // the needle or a non-ASCII byte, which might fold to it.
+        if(first < 0x80 && count - index >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &contents[index]);
+            __m128i equal = _mm_cmpeq_epi8(fold_ascii_block(bytes), _mm_set1_epi8((char) first));
+            uint64_t mask = (uint16_t) (_mm_movemask_epi8(equal) | _mm_movemask_epi8(bytes));
+
+            if(!mask)
+            {
+                index += 16;
+                continue;
+            }
+
+            index += count_trailing_zeros64(mask);
+        }
+#endif // defined(USE_SSE2)
+
+        uint8_t byte = (uint8_t) contents[index];
+
+        bool continuation = (byte & 0xc0) == 0x80;
+        bool mismatch = byte < 0x80 && (uint8_t) fold_ascii((char) byte) != first;
+
+        if(!continuation && !mismatch && matches_folded_at(haystack, index, needle))
+        {
+            result.value = index;
+            result.valid = true;
+            return result;
+        }
+
+        index += 1;
+    }
+
+    return result;
+}
+
+bool aft_utf8_fold_case(AftString* folded, AftStringSlice slice, AftCaseFolding folding)
+{
+    AFT_ASSERT(folded);
+
+    int prior_count = aft_string_get_count(folded);
+
+    // Folding seldom changes the length, so this is usually the only
+    // allocation.
+    if(!aft_string_reserve(folded, prior_count + aft_string_slice_count(slice)))
+    {
+        return false;
+    }
+
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, slice);
+
+    const char* contents = aft_string_slice_start(slice);
+
+    while(it.index < it.end)
+    {
+        bool appended = true;
+
+#if defined(USE_SSE2)
+        if(it.end - it.index >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &contents[it.index]);
+
+            if(!_mm_movemask_epi8(bytes))
+            {
+                char block[16];
+                _mm_storeu_si128((__m128i*) block, fold_ascii_block(bytes));
+
+                if(!aft_string_append_slice(folded, aft_string_slice_from_buffer(block, 16)))
+                {
+                    aft_string_remove(folded, prior_count, aft_string_get_count(folded));
+                    return false;
+                }
+
+                it.index += 16;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        char byte = contents[it.index];
+
+        if((uint8_t) byte < 0x80)
+        {
+            appended = aft_string_append_char(folded, fold_ascii(byte));
+            it.index += 1;
+        }
+        else
+        {
+            AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+            appended = codepoint.valid;
+
+            if(appended && folding == AFT_CASE_FOLDING_SIMPLE)
+            {
+                char32_t simple = aft_unicode_fold_case_simple(codepoint.value);
+                appended = aft_utf8_append_codepoint(folded, simple);
+            }
+            else if(appended)
+            {
+                char32_t full[AFT_CASE_FOLD_MAX];
+                int full_count = aft_unicode_fold_case_full(codepoint.value, full);
+
+                for(int full_index = 0; appended && full_index < full_count; full_index += 1)
+                {
+                    appended = aft_utf8_append_codepoint(folded, full[full_index]);
+                }
+            }
+        }
+
+        if(!appended)
+        {
+            aft_string_remove(folded, prior_count, aft_string_get_count(folded));
+            return false;
+        }
+    }
+
+    return true;
+}
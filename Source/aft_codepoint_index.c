@@ -0,0 +1,227 @@
+#include <AftString/aft_string.h>
+
+#include "byte_set.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+
+static bool is_codepoint_start(char c)
+{
+    return (c & 0xc0) != 0x80;
+}
+
+// Mark each byte in a block that isn't a continuation byte. Those are exactly
+// the bytes that start a codepoint in valid UTF-8.
+static uint64_t match_codepoint_starts(const char* block, int count)
+{
+    AFT_ASSERT(count <= BYTE_SET_BLOCK_SIZE);
+
+#if defined(USE_SSE2)
+    if(count == BYTE_SET_BLOCK_SIZE)
+    {
+        // Continuation bytes are 0x80 to 0xbf, which are -128 to -65 when
+        // the bytes are compared as signed.
+        const __m128i limit = _mm_set1_epi8(-65);
+        uint64_t mask = 0;
+
+        for(int lane = 0; lane < 4; lane += 1)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &block[16 * lane]);
+            uint64_t lane_mask = (uint16_t) _mm_movemask_epi8(_mm_cmpgt_epi8(bytes, limit));
+            mask |= lane_mask << (16 * lane);
+        }
+
+        return mask;
+    }
+#endif // defined(USE_SSE2)
+
+    uint64_t mask = 0;
+
+    for(int byte_index = 0; byte_index < count; byte_index += 1)
+    {
+        uint64_t match = is_codepoint_start(block[byte_index]);
+        mask |= match << byte_index;
+    }
+
+    return mask;
+}
+
+
+void aft_codepoint_index_destroy(AftCodepointIndex* index)
+{
+    AFT_ASSERT(index);
+
+    if(index->byte_offsets)
+    {
+        AftMemoryBlock block;
+        block.memory = index->byte_offsets;
+        block.bytes = sizeof(int) * (uint64_t) index->cap;
+        aft_deallocate(index->allocator, block);
+    }
+
+    index->byte_offsets = NULL;
+    index->cap = 0;
+    index->codepoint_count = 0;
+    index->count = 0;
+}
+
+int aft_codepoint_index_find_byte(const AftCodepointIndex* index, int codepoint_index)
+{
+    AFT_ASSERT(index);
+    AFT_ASSERT(codepoint_index >= 0 && codepoint_index <= index->codepoint_count);
+
+    if(codepoint_index == index->codepoint_count)
+    {
+        return aft_string_slice_count(index->slice);
+    }
+
+    const char* contents = aft_string_slice_start(index->slice);
+    int byte_index = index->byte_offsets[codepoint_index / AFT_CODEPOINT_INDEX_STRIDE];
+
+    for(int skip = codepoint_index % AFT_CODEPOINT_INDEX_STRIDE; skip > 0;)
+    {
+        byte_index += 1;
+
+        if(is_codepoint_start(contents[byte_index]))
+        {
+            skip -= 1;
+        }
+    }
+
+    return byte_index;
+}
+
+int aft_codepoint_index_find_codepoint(const AftCodepointIndex* index, int byte_index)
+{
+    AFT_ASSERT(index);
+    AFT_ASSERT(byte_index >= 0 && byte_index <= aft_string_slice_count(index->slice));
+
+    if(byte_index == aft_string_slice_count(index->slice))
+    {
+        return index->codepoint_count;
+    }
+
+    // Find the last stored offset at or before the byte.
+    int low = 0;
+    int high = index->count;
+
+    while(low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if(index->byte_offsets[middle] <= byte_index)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    if(low == 0)
+    {
+        return 0;
+    }
+
+    // Count the codepoints that start after the stored one, up to and
+    // including the given byte. A byte in the middle of a codepoint then
+    // gives the index of the codepoint it's part of.
+    const char* contents = aft_string_slice_start(index->slice);
+    int codepoint_index = AFT_CODEPOINT_INDEX_STRIDE * (low - 1);
+
+    for(int scan = index->byte_offsets[low - 1] + 1; scan <= byte_index; scan += 1)
+    {
+        codepoint_index += is_codepoint_start(contents[scan]);
+    }
+
+    return codepoint_index;
+}
+
+int aft_codepoint_index_get_codepoint_count(const AftCodepointIndex* index)
+{
+    AFT_ASSERT(index);
+    return index->codepoint_count;
+}
+
+bool aft_codepoint_index_initialise(AftCodepointIndex* index, AftStringSlice slice)
+{
+    return aft_codepoint_index_initialise_with_allocator(index, slice, NULL);
+}
+
+bool aft_codepoint_index_initialise_with_allocator(AftCodepointIndex* index, AftStringSlice slice, void* allocator)
+{
+    AFT_ASSERT(index);
+
+    index->slice = slice;
+    index->allocator = allocator;
+    index->byte_offsets = NULL;
+    index->cap = 0;
+    index->codepoint_count = 0;
+    index->count = 0;
+
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+
+    if(count == 0)
+    {
+        return true;
+    }
+
+    // Every codepoint is at least one byte, so this is enough room for any
+    // text of this size.
+    int cap = count / AFT_CODEPOINT_INDEX_STRIDE + 1;
+    AftMemoryBlock block = aft_allocate(allocator, sizeof(int) * (uint64_t) cap);
+    if(!block.memory)
+    {
+        return false;
+    }
+
+    index->byte_offsets = (int*) block.memory;
+    index->cap = cap;
+
+    int codepoint_count = 0;
+
+    for(int block_start = 0; block_start < count; block_start += BYTE_SET_BLOCK_SIZE)
+    {
+        int block_count = count - block_start;
+        if(block_count > BYTE_SET_BLOCK_SIZE)
+        {
+            block_count = BYTE_SET_BLOCK_SIZE;
+        }
+
+        uint64_t mask = match_codepoint_starts(&contents[block_start], block_count);
+        int block_codepoints = count_set_bits64(mask);
+        int next = AFT_CODEPOINT_INDEX_STRIDE * index->count;
+
+        while(next < codepoint_count + block_codepoints)
+        {
+            for(int skip = next - codepoint_count; skip > 0; skip -= 1)
+            {
+                mask &= mask - 1;
+                codepoint_count += 1;
+                block_codepoints -= 1;
+            }
+
+            index->byte_offsets[index->count] = block_start + count_trailing_zeros64(mask);
+            index->count += 1;
+            next += AFT_CODEPOINT_INDEX_STRIDE;
+        }
+
+        codepoint_count += block_codepoints;
+    }
+
+    index->codepoint_count = codepoint_count;
+
+    return true;
+}
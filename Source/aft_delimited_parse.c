@@ -0,0 +1,342 @@
+#include <AftString/aft_number_format.h>
+
+#include "byte_set.h"
+#include "number_parse.h"
+#include "parallel.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+
+typedef enum FieldType
+{
+    FIELD_TYPE_DOUBLE,
+    FIELD_TYPE_INT64,
+} FieldType;
+
+// Fields end at the delimiter or at a line break. A carriage return just
+// before a line feed isn't part of its field.
+typedef struct FieldBatch
+{
+    AftByteSet separators;
+    AftStringSlice text;
+    const char* contents;
+    void* values;
+    bool* valid;
+    FieldType type;
+    int cap;
+    int count;
+} FieldBatch;
+
+// A run of whole fields. It starts at the beginning of the text or just after
+// a separator, and ends just after a separator or at the end of the text.
+typedef struct FieldChunk
+{
+    AftDelimitedParseResult result;
+    int end;
+    int first_field;
+    int start;
+} FieldChunk;
+
+typedef struct ParallelFields
+{
+    const FieldBatch* batch;
+    FieldChunk chunks[PARALLEL_THREAD_CAP];
+} ParallelFields;
+
+
+static void clear_result(AftDelimitedParseResult* result)
+{
+    result->error_count = 0;
+    result->field_count = 0;
+    result->first_error = -1;
+}
+
+// Text that ends with a line break has no field after it, but text that ends
+// with a delimiter has an empty one.
+static bool has_last_field(const FieldBatch* batch, int field_start)
+{
+    const char* contents = batch->contents;
+    int count = batch->count;
+
+    if(field_start < count)
+    {
+        return true;
+    }
+
+    return count > 0 && contents[count - 1] != '\n';
+}
+
+static void parse_field(const FieldBatch* batch, int start, int end, AftDelimitedParseResult* result, int field_index)
+{
+    const char* contents = batch->contents;
+    int count = batch->count;
+
+    if(end > start
+            && end < count
+            && contents[end] == '\n'
+            && contents[end - 1] == '\r')
+    {
+        end -= 1;
+    }
+
+    if(field_index >= batch->cap)
+    {
+        return;
+    }
+
+    AftStringSlice field = aft_string_slice_from_buffer(&contents[start], end - start);
+    int field_count = end - start;
+    bool valid;
+
+    if(batch->type == FIELD_TYPE_DOUBLE)
+    {
+        ParsedDecimal decimal;
+        double* values = (double*) batch->values;
+
+        valid = parse_decimal(field, &decimal) == field_count && field_count > 0;
+        values[field_index] = valid ? decimal_to_double(&decimal) : 0.0;
+    }
+    else
+    {
+        int64_t* values = (int64_t*) batch->values;
+        bool sign;
+        uint64_t magnitude;
+        int parsed_count;
+        int64_t value = 0;
+
+        valid = parse_integer(field, 10, true, &parsed_count, &sign, &magnitude)
+                && parsed_count == field_count
+                && apply_sign(sign, magnitude, INT64_MAX, &value);
+        values[field_index] = valid ? value : 0;
+    }
+
+    if(batch->valid)
+    {
+        batch->valid[field_index] = valid;
+    }
+
+    if(!valid)
+    {
+        result->error_count += 1;
+
+        if(result->first_error < 0)
+        {
+            result->first_error = field_index;
+        }
+    }
+}
+
+// Find each separator with a bitmap of a block of bytes at a time, and parse
+// the field before it.
+static void parse_chunk(const FieldBatch* batch, FieldChunk* chunk)
+{
+    const char* contents = batch->contents;
+    int field_index = chunk->first_field;
+    int field_start = chunk->start;
+
+    clear_result(&chunk->result);
+
+    for(int block_start = chunk->start; block_start < chunk->end; block_start += BYTE_SET_BLOCK_SIZE)
+    {
+        int block_count = chunk->end - block_start;
+        if(block_count > BYTE_SET_BLOCK_SIZE)
+        {
+            block_count = BYTE_SET_BLOCK_SIZE;
+        }
+
+        uint64_t mask = byte_set_match_block(&batch->separators, &contents[block_start], block_count);
+
+        while(mask)
+        {
+            int separator = block_start + count_trailing_zeros64(mask);
+            mask &= mask - 1;
+
+            parse_field(batch, field_start, separator, &chunk->result, field_index);
+            field_index += 1;
+            field_start = separator + 1;
+        }
+    }
+
+    if(chunk->end == batch->count && has_last_field(batch, field_start))
+    {
+        parse_field(batch, field_start, chunk->end, &chunk->result, field_index);
+        field_index += 1;
+    }
+
+    chunk->result.field_count = field_index - chunk->first_field;
+}
+
+static int count_fields(const FieldBatch* batch, const FieldChunk* chunk)
+{
+    const char* contents = batch->contents;
+    int field_count = 0;
+
+    for(int block_start = chunk->start; block_start < chunk->end; block_start += BYTE_SET_BLOCK_SIZE)
+    {
+        int block_count = chunk->end - block_start;
+        if(block_count > BYTE_SET_BLOCK_SIZE)
+        {
+            block_count = BYTE_SET_BLOCK_SIZE;
+        }
+
+        uint64_t mask = byte_set_match_block(&batch->separators, &contents[block_start], block_count);
+        field_count += count_set_bits64(mask);
+    }
+
+    return field_count;
+}
+
+static void count_fields_task(void* data, int task_index)
+{
+    ParallelFields* fields = (ParallelFields*) data;
+    FieldChunk* chunk = &fields->chunks[task_index];
+    chunk->first_field = count_fields(fields->batch, chunk);
+}
+
+static void parse_chunk_task(void* data, int task_index)
+{
+    ParallelFields* fields = (ParallelFields*) data;
+    parse_chunk(fields->batch, &fields->chunks[task_index]);
+}
+
+// Split the text into even chunks, with each moved along to just after the
+// next separator so no field is cut in two. Each chunk's fields are counted
+// first, so that every chunk knows the index of its first field, and then all
+// the chunks are parsed.
+static AftDelimitedParseResult parse_in_parallel(const FieldBatch* batch, int chunk_count)
+{
+    ParallelFields fields;
+    fields.batch = batch;
+
+    int count = batch->count;
+    int start = 0;
+
+    for(int chunk_index = 0; chunk_index < chunk_count; chunk_index += 1)
+    {
+        int end = (int) ((int64_t) count * (chunk_index + 1) / chunk_count);
+
+        if(end <= start)
+        {
+            end = start;
+        }
+        else if(end < count)
+        {
+            uint64_t mask;
+            int mask_start = -BYTE_SET_BLOCK_SIZE;
+            AftMaybeInt separator = byte_set_find(&batch->separators, batch->text, end - 1, &mask, &mask_start);
+            end = separator.valid ? separator.value + 1 : count;
+        }
+
+        fields.chunks[chunk_index].start = start;
+        fields.chunks[chunk_index].end = end;
+        start = end;
+
+        // Only one chunk can have the last field.
+        if(end == count)
+        {
+            chunk_count = chunk_index + 1;
+        }
+    }
+
+    parallel_run(count_fields_task, &fields, chunk_count);
+
+    int first_field = 0;
+
+    for(int chunk_index = 0; chunk_index < chunk_count; chunk_index += 1)
+    {
+        int field_count = fields.chunks[chunk_index].first_field;
+        fields.chunks[chunk_index].first_field = first_field;
+        first_field += field_count;
+    }
+
+    parallel_run(parse_chunk_task, &fields, chunk_count);
+
+    AftDelimitedParseResult result;
+    clear_result(&result);
+
+    for(int chunk_index = 0; chunk_index < chunk_count; chunk_index += 1)
+    {
+        const AftDelimitedParseResult* chunk_result = &fields.chunks[chunk_index].result;
+
+        result.error_count += chunk_result->error_count;
+        result.field_count += chunk_result->field_count;
+
+        if(result.first_error < 0)
+        {
+            result.first_error = chunk_result->first_error;
+        }
+    }
+
+    return result;
+}
+
+static AftDelimitedParseResult parse_fields(const FieldBatch* batch, const AftDelimitedParseOptions* options)
+{
+    int count = batch->count;
+    int chunk_count = parallel_clamp_thread_count(options->thread_count);
+
+    if(options->chunk_size > 0 && count / options->chunk_size < chunk_count)
+    {
+        chunk_count = count / options->chunk_size;
+    }
+
+    if(chunk_count > 1)
+    {
+        return parse_in_parallel(batch, chunk_count);
+    }
+
+    FieldChunk chunk;
+    chunk.start = 0;
+    chunk.end = count;
+    chunk.first_field = 0;
+
+    parse_chunk(batch, &chunk);
+
+    return chunk.result;
+}
+
+static void start_batch(FieldBatch* batch, AftStringSlice text, const AftDelimitedParseOptions* options, bool* valid, int cap)
+{
+    AFT_ASSERT(options);
+    AFT_ASSERT(cap >= 0);
+
+    byte_set_clear(&batch->separators);
+    byte_set_add(&batch->separators, options->delimiter);
+    byte_set_add(&batch->separators, '\n');
+
+    batch->text = text;
+    batch->contents = aft_string_slice_start(text);
+    batch->count = aft_string_slice_count(text);
+    batch->valid = valid;
+    batch->cap = cap;
+}
+
+
+AftDelimitedParseResult aft_ascii_to_doubles(AftStringSlice text, const AftDelimitedParseOptions* options, double* values, bool* valid, int cap)
+{
+    AFT_ASSERT(values || cap == 0);
+
+    FieldBatch batch;
+    start_batch(&batch, text, options, valid, cap);
+    batch.values = values;
+    batch.type = FIELD_TYPE_DOUBLE;
+
+    return parse_fields(&batch, options);
+}
+
+AftDelimitedParseResult aft_ascii_to_int64s(AftStringSlice text, const AftDelimitedParseOptions* options, int64_t* values, bool* valid, int cap)
+{
+    AFT_ASSERT(values || cap == 0);
+
+    FieldBatch batch;
+    start_batch(&batch, text, options, valid, cap);
+    batch.values = values;
+    batch.type = FIELD_TYPE_INT64;
+
+    return parse_fields(&batch, options);
+}
@@ -0,0 +1,278 @@
+#include <AftString/aft_string.h>
+
+#include "byte_set.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+
+static void set_newlines(AftByteSet* set)
+{
+    byte_set_clear(set);
+    byte_set_add(set, '\n');
+    byte_set_add(set, '\r');
+}
+
+static void free_line_starts(AftLineIndex* index)
+{
+    if(index->line_starts)
+    {
+        AftMemoryBlock block;
+        block.memory = index->line_starts;
+        block.bytes = sizeof(int) * (uint64_t) index->cap;
+        aft_deallocate(index->allocator, block);
+    }
+}
+
+static bool reserve_line_starts(AftLineIndex* index, int cap)
+{
+    if(cap <= index->cap)
+    {
+        return true;
+    }
+
+    int new_cap = index->cap > 0 ? 2 * index->cap : 16;
+    while(new_cap < cap)
+    {
+        new_cap *= 2;
+    }
+
+    AftMemoryBlock block = aft_allocate(index->allocator, sizeof(int) * (uint64_t) new_cap);
+    int* line_starts = (int*) block.memory;
+    if(!line_starts)
+    {
+        return false;
+    }
+
+    for(int line_index = 0; line_index < index->count; line_index += 1)
+    {
+        line_starts[line_index] = index->line_starts[line_index];
+    }
+
+    free_line_starts(index);
+
+    index->line_starts = line_starts;
+    index->cap = new_cap;
+
+    return true;
+}
+
+
+void aft_line_index_destroy(AftLineIndex* index)
+{
+    AFT_ASSERT(index);
+
+    free_line_starts(index);
+
+    index->line_starts = NULL;
+    index->cap = 0;
+    index->count = 0;
+    index->text_count = 0;
+}
+
+AftTextPosition aft_line_index_find_position(const AftLineIndex* index, int offset)
+{
+    AFT_ASSERT(index);
+    AFT_ASSERT(offset >= 0 && offset <= index->text_count);
+
+    // Find the last line starting at or before the offset. Line 0 always
+    // starts at 0 and isn't stored.
+    int low = 0;
+    int high = index->count;
+
+    while(low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if(index->line_starts[middle] <= offset)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    AftTextPosition position;
+    position.line = low;
+    position.column = offset - aft_line_index_get_line_start(index, low);
+    return position;
+}
+
+AftStringSlice aft_line_index_get_line(const AftLineIndex* index, AftStringSlice text, int line)
+{
+    AFT_ASSERT(index);
+    AFT_ASSERT(aft_string_slice_count(text) >= index->text_count);
+
+    int line_count = aft_line_index_get_line_count(index);
+    AFT_ASSERT(line >= 0 && line < line_count);
+
+    int start = aft_line_index_get_line_start(index, line);
+    int end = index->text_count;
+
+    if(line + 1 < line_count)
+    {
+        const char* contents = aft_string_slice_start(text);
+
+        end = aft_line_index_get_line_start(index, line + 1) - 1;
+
+        if(contents[end] == '\n' && end > start && contents[end - 1] == '\r')
+        {
+            end -= 1;
+        }
+    }
+
+    return aft_string_slice(text, start, end);
+}
+
+int aft_line_index_get_line_count(const AftLineIndex* index)
+{
+    AFT_ASSERT(index);
+    return index->count + 1;
+}
+
+int aft_line_index_get_line_start(const AftLineIndex* index, int line)
+{
+    AFT_ASSERT(index);
+    AFT_ASSERT(line >= 0 && line <= index->count);
+
+    if(line == 0)
+    {
+        return 0;
+    }
+
+    return index->line_starts[line - 1];
+}
+
+void aft_line_index_initialise(AftLineIndex* index)
+{
+    aft_line_index_initialise_with_allocator(index, NULL);
+}
+
+void aft_line_index_initialise_with_allocator(AftLineIndex* index, void* allocator)
+{
+    AFT_ASSERT(index);
+
+    index->allocator = allocator;
+    index->line_starts = NULL;
+    index->cap = 0;
+    index->count = 0;
+    index->text_count = 0;
+}
+
+bool aft_line_index_update(AftLineIndex* index, AftStringSlice text)
+{
+    AFT_ASSERT(index);
+
+    const char* contents = aft_string_slice_start(text);
+    int count = aft_string_slice_count(text);
+    AFT_ASSERT(count >= index->text_count);
+
+    AftByteSet newlines;
+    set_newlines(&newlines);
+
+    for(int block_start = index->text_count;
+            block_start < count;
+            block_start += BYTE_SET_BLOCK_SIZE)
+    {
+        int block_count = count - block_start;
+        if(block_count > BYTE_SET_BLOCK_SIZE)
+        {
+            block_count = BYTE_SET_BLOCK_SIZE;
+        }
+
+        uint64_t mask = byte_set_match_block(&newlines, &contents[block_start], block_count);
+
+        while(mask)
+        {
+            int newline = block_start + count_trailing_zeros64(mask);
+            mask &= mask - 1;
+
+            // A carriage return already started a line after itself, so the
+            // line feed of a CRLF pair just moves that start along by one.
+            // The pair may have been split across two updates.
+            if(contents[newline] == '\n'
+                    && newline > 0
+                    && contents[newline - 1] == '\r')
+            {
+                AFT_ASSERT(index->line_starts[index->count - 1] == newline);
+                index->line_starts[index->count - 1] = newline + 1;
+                continue;
+            }
+
+            if(!reserve_line_starts(index, index->count + 1))
+            {
+                // Stop at the newline that couldn't be added, so a later
+                // update picks up from there.
+                index->text_count = newline;
+                return false;
+            }
+
+            index->line_starts[index->count] = newline + 1;
+            index->count += 1;
+        }
+    }
+
+    index->text_count = count;
+
+    return true;
+}
+
+
+AftMaybeStringSlice aft_line_iterator_next(AftLineIterator* it)
+{
+    AFT_ASSERT(it);
+
+    int count = aft_string_slice_count(it->slice);
+    int line_start = it->index;
+
+    if(line_start >= count)
+    {
+        AftMaybeStringSlice result = {{NULL, 0}, false};
+        return result;
+    }
+
+    AftByteSet newlines;
+    set_newlines(&newlines);
+
+    AftMaybeInt newline = byte_set_find(&newlines, it->slice, line_start, &it->mask, &it->mask_start);
+    int line_end;
+
+    if(newline.valid)
+    {
+        const char* contents = aft_string_slice_start(it->slice);
+
+        line_end = newline.value;
+        it->index = line_end + 1;
+
+        if(contents[line_end] == '\r'
+                && it->index < count
+                && contents[it->index] == '\n')
+        {
+            it->index += 1;
+        }
+    }
+    else
+    {
+        line_end = count;
+        it->index = count;
+    }
+
+    AftMaybeStringSlice result = {aft_string_slice(it->slice, line_start, line_end), true};
+    return result;
+}
+
+void aft_line_iterator_set_string(AftLineIterator* it, AftStringSlice slice)
+{
+    AFT_ASSERT(it);
+
+    it->slice = slice;
+    it->mask = 0;
+    it->index = 0;
+    it->mask_start = -BYTE_SET_BLOCK_SIZE;
+}
@@ -0,0 +1,553 @@
+#include <AftString/aft_unicode.h>
+
+#include "unicode_data.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <stddef.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+#define AFT_DECOMPOSITION_MAX 4
+#define AFT_NORMALIZER_CAP 64
+
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_L_COUNT 19
+#define HANGUL_S_BASE 0xac00
+#define HANGUL_S_COUNT 11172
+#define HANGUL_T_BASE 0x11a7
+#define HANGUL_T_COUNT 28
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_V_COUNT 21
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+
+#define QUICK_CHECK_NFC_NO 0x1
+#define QUICK_CHECK_NFC_MAYBE 0x2
+#define QUICK_CHECK_NFD_NO 0x4
+
+
+typedef enum QuickCheck
+{
+    QUICK_CHECK_INVALID,
+    QUICK_CHECK_NO,
+    QUICK_CHECK_YES,
+} QuickCheck;
+
+
+// Holds decomposed codepoints until the next starter, when they can be put
+// in canonical order and composed. For composition, the last starter is kept
+// back, since it could still compose with the starter after it.
+//
+// A whole run of combining marks has to be ordered at once. Runs longer than
+// the inline buffer only happen for text outside the stream-safe format, and
+// move the buffer to the heap.
+typedef struct Normalizer
+{
+    AftString* output;
+    char32_t* buffer;
+    int count;
+    int cap;
+    bool compose;
+    char32_t inline_buffer[AFT_NORMALIZER_CAP];
+} Normalizer;
+
+
+static int get_combining_class(char32_t c)
+{
+    return unicode_combining_class_lookup(c);
+}
+
+static char32_t compose_pair(char32_t first, char32_t second)
+{
+    if(first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT
+            && second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT)
+    {
+        int l_index = first - HANGUL_L_BASE;
+        int v_index = second - HANGUL_V_BASE;
+        return HANGUL_S_BASE + (l_index * HANGUL_N_COUNT) + (v_index * HANGUL_T_COUNT);
+    }
+
+    if(first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT
+            && (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0
+            && second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT)
+    {
+        return first + (second - HANGUL_T_BASE);
+    }
+
+    uint64_t key = ((uint64_t) first << 21) | second;
+    int low = 0;
+    int high = sizeof(unicode_composition_keys) / sizeof(*unicode_composition_keys);
+
+    while(low < high)
+    {
+        int middle = low + (high - low) / 2;
+
+        if(unicode_composition_keys[middle] < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    int key_count = sizeof(unicode_composition_keys) / sizeof(*unicode_composition_keys);
+
+    if(low < key_count && unicode_composition_keys[low] == key)
+    {
+        return unicode_composition_values[low];
+    }
+
+    return 0;
+}
+
+static int decompose(char32_t c, char32_t* decomposition)
+{
+    if(c >= HANGUL_S_BASE && c < HANGUL_S_BASE + HANGUL_S_COUNT)
+    {
+        int s_index = c - HANGUL_S_BASE;
+        int t_index = s_index % HANGUL_T_COUNT;
+
+        decomposition[0] = HANGUL_L_BASE + s_index / HANGUL_N_COUNT;
+        decomposition[1] = HANGUL_V_BASE + (s_index % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+
+        if(t_index)
+        {
+            decomposition[2] = HANGUL_T_BASE + t_index;
+            return 3;
+        }
+
+        return 2;
+    }
+
+    int index = unicode_decomposition_lookup(c);
+
+    if(!index)
+    {
+        decomposition[0] = c;
+        return 1;
+    }
+
+    int count = unicode_decomposition_sequences[index];
+    AFT_ASSERT(count <= AFT_DECOMPOSITION_MAX);
+
+    for(int part_index = 0; part_index < count; part_index += 1)
+    {
+        decomposition[part_index] = unicode_decomposition_sequences[index + 1 + part_index];
+    }
+
+    return count;
+}
+
+// Sort each run of combining marks by combining class, keeping marks of the
+// same class in order.
+static void reorder(char32_t* codepoints, int count)
+{
+    for(int index = 1; index < count; index += 1)
+    {
+        char32_t c = codepoints[index];
+        int combining_class = get_combining_class(c);
+
+        if(!combining_class)
+        {
+            continue;
+        }
+
+        int insert = index;
+
+        while(insert > 0 && get_combining_class(codepoints[insert - 1]) > combining_class)
+        {
+            codepoints[insert] = codepoints[insert - 1];
+            insert -= 1;
+        }
+
+        codepoints[insert] = c;
+    }
+}
+
+// This is the canonical composition algorithm from the Unicode Standard,
+// section 3.11. A mark is blocked from its starter by anything in between
+// with the same or higher combining class, or by another starter.
+static int compose(char32_t* codepoints, int count)
+{
+    if(count == 0)
+    {
+        return 0;
+    }
+
+    int starter_index = 0;
+    int last_class = get_combining_class(codepoints[0]);
+    if(last_class)
+    {
+        last_class = 256;
+    }
+
+    int composed_count = 1;
+
+    for(int index = 1; index < count; index += 1)
+    {
+        char32_t c = codepoints[index];
+        int combining_class = get_combining_class(c);
+        char32_t composite = compose_pair(codepoints[starter_index], c);
+
+        if(composite && (last_class < combining_class || last_class == 0))
+        {
+            codepoints[starter_index] = composite;
+        }
+        else
+        {
+            if(!combining_class)
+            {
+                starter_index = composed_count;
+            }
+
+            last_class = combining_class;
+            codepoints[composed_count] = c;
+            composed_count += 1;
+        }
+    }
+
+    return composed_count;
+}
+
+static void normalizer_initialise(Normalizer* normalizer, AftString* output, bool compose)
+{
+    normalizer->output = output;
+    normalizer->buffer = normalizer->inline_buffer;
+    normalizer->count = 0;
+    normalizer->cap = AFT_NORMALIZER_CAP;
+    normalizer->compose = compose;
+}
+
+static void normalizer_destroy(Normalizer* normalizer)
+{
+    if(normalizer->buffer != normalizer->inline_buffer)
+    {
+        AftMemoryBlock block;
+        block.memory = normalizer->buffer;
+        block.bytes = sizeof(char32_t) * (uint64_t) normalizer->cap;
+        aft_deallocate(normalizer->output->allocator, block);
+    }
+}
+
+static bool normalizer_grow(Normalizer* normalizer)
+{
+    if(normalizer->cap > INT_MAX / 2)
+    {
+        return false;
+    }
+
+    int new_cap = 2 * normalizer->cap;
+
+    AftMemoryBlock block = aft_allocate(normalizer->output->allocator, sizeof(char32_t) * (uint64_t) new_cap);
+    char32_t* buffer = (char32_t*) block.memory;
+    if(!buffer)
+    {
+        return false;
+    }
+
+    for(int index = 0; index < normalizer->count; index += 1)
+    {
+        buffer[index] = normalizer->buffer[index];
+    }
+
+    normalizer_destroy(normalizer);
+    normalizer->buffer = buffer;
+    normalizer->cap = new_cap;
+
+    return true;
+}
+
+static bool normalizer_flush(Normalizer* normalizer, bool keep_starter)
+{
+    reorder(normalizer->buffer, normalizer->count);
+
+    if(normalizer->compose)
+    {
+        normalizer->count = compose(normalizer->buffer, normalizer->count);
+    }
+
+    int flush_count = normalizer->count;
+
+    if(keep_starter
+            && normalizer->compose
+            && flush_count > 0
+            && !get_combining_class(normalizer->buffer[flush_count - 1]))
+    {
+        flush_count -= 1;
+    }
+
+    for(int index = 0; index < flush_count; index += 1)
+    {
+        if(!aft_utf8_append_codepoint(normalizer->output, normalizer->buffer[index]))
+        {
+            return false;
+        }
+    }
+
+    int kept = normalizer->count - flush_count;
+
+    for(int index = 0; index < kept; index += 1)
+    {
+        normalizer->buffer[index] = normalizer->buffer[flush_count + index];
+    }
+
+    normalizer->count = kept;
+
+    return true;
+}
+
+static bool normalizer_push(Normalizer* normalizer, char32_t c)
+{
+    bool starter = !get_combining_class(c);
+
+    if(normalizer->count > 0 && starter)
+    {
+        if(!normalizer_flush(normalizer, true))
+        {
+            return false;
+        }
+    }
+
+    if(normalizer->count == normalizer->cap && !normalizer_grow(normalizer))
+    {
+        return false;
+    }
+
+    normalizer->buffer[normalizer->count] = c;
+    normalizer->count += 1;
+
+    return true;
+}
+
+// Check a segment with codepoints that might compose with what's before
+// them, by composing it in a scratch buffer and comparing. The segment starts
+// at a starter which nothing earlier can compose with. A segment too long for
+// the scratch buffer is taken as not composed, which is only slower.
+static bool segment_is_composed(AftStringSlice segment)
+{
+    char32_t codepoints[AFT_NORMALIZER_CAP];
+    int count = 0;
+
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, segment);
+
+    for(AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+            codepoint.valid;
+            codepoint = aft_codepoint_iterator_next(&it))
+    {
+        char32_t decomposition[AFT_DECOMPOSITION_MAX];
+        int part_count = decompose(codepoint.value, decomposition);
+
+        if(count + part_count > AFT_NORMALIZER_CAP)
+        {
+            return false;
+        }
+
+        for(int part_index = 0; part_index < part_count; part_index += 1)
+        {
+            codepoints[count] = decomposition[part_index];
+            count += 1;
+        }
+    }
+
+    reorder(codepoints, count);
+    count = compose(codepoints, count);
+
+    aft_codepoint_iterator_set_string(&it, segment);
+
+    for(int index = 0; index < count; index += 1)
+    {
+        AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+
+        if(!codepoint.valid || codepoint.value != codepoints[index])
+        {
+            return false;
+        }
+    }
+
+    return it.index == it.end;
+}
+
+// Check whether a string is already normalized, by its quick check values
+// and the order of its combining marks. When it might not be, the stable
+// index is where normalization has to start from, which is the last starter
+// before the problem.
+//
+// For composition, codepoints that maybe aren't allowed are only checked
+// when the segment they're in ends, at the next stable starter.
+static QuickCheck quick_check(AftStringSlice slice, bool compose, int* stable_index)
+{
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, slice);
+
+    const char* contents = aft_string_slice_start(slice);
+    int last_class = 0;
+    uint8_t no_mask = compose ? QUICK_CHECK_NFC_NO : QUICK_CHECK_NFD_NO;
+    bool maybe = false;
+
+    *stable_index = 0;
+
+    while(it.index < it.end)
+    {
+#if defined(USE_SSE2)
+        if(it.end - it.index >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &contents[it.index]);
+
+            if(!_mm_movemask_epi8(bytes))
+            {
+                if(maybe && !segment_is_composed(aft_string_slice(slice, *stable_index, it.index)))
+                {
+                    return QUICK_CHECK_NO;
+                }
+
+                maybe = false;
+                it.index += 16;
+                *stable_index = it.index - 1;
+                last_class = 0;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        int index = it.index;
+
+        if((uint8_t) contents[index] < 0x80)
+        {
+            if(maybe && !segment_is_composed(aft_string_slice(slice, *stable_index, index)))
+            {
+                return QUICK_CHECK_NO;
+            }
+
+            maybe = false;
+            it.index += 1;
+            *stable_index = index;
+            last_class = 0;
+            continue;
+        }
+
+        AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+
+        if(!codepoint.valid)
+        {
+            return QUICK_CHECK_INVALID;
+        }
+
+        int combining_class = get_combining_class(codepoint.value);
+        uint8_t quick_check_value = unicode_quick_check_lookup(codepoint.value);
+
+        if((combining_class && last_class > combining_class)
+                || (quick_check_value & no_mask))
+        {
+            return QUICK_CHECK_NO;
+        }
+
+        bool codepoint_maybe = compose && (quick_check_value & QUICK_CHECK_NFC_MAYBE);
+
+        if(!combining_class && !codepoint_maybe)
+        {
+            if(maybe && !segment_is_composed(aft_string_slice(slice, *stable_index, index)))
+            {
+                return QUICK_CHECK_NO;
+            }
+
+            maybe = false;
+            *stable_index = index;
+        }
+
+        maybe = maybe || codepoint_maybe;
+        last_class = combining_class;
+    }
+
+    if(maybe && !segment_is_composed(aft_string_slice(slice, *stable_index, it.end)))
+    {
+        return QUICK_CHECK_NO;
+    }
+
+    return QUICK_CHECK_YES;
+}
+
+static AftMaybeStringSlice normalize(AftStringSlice slice, AftString* buffer, bool compose)
+{
+    AFT_ASSERT(buffer);
+
+    AftMaybeStringSlice result = {slice, true};
+
+    int stable_index;
+    QuickCheck check = quick_check(slice, compose, &stable_index);
+
+    if(check == QUICK_CHECK_YES)
+    {
+        return result;
+    }
+
+    result.valid = false;
+
+    if(check == QUICK_CHECK_INVALID)
+    {
+        return result;
+    }
+
+    int prior_count = aft_string_get_count(buffer);
+    int slice_count = aft_string_slice_count(slice);
+    bool appended = aft_string_reserve(buffer, prior_count + slice_count)
+            && aft_string_append_slice(buffer, aft_string_slice(slice, 0, stable_index));
+
+    Normalizer normalizer;
+    normalizer_initialise(&normalizer, buffer, compose);
+
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, aft_string_slice(slice, stable_index, slice_count));
+
+    while(appended)
+    {
+        AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+
+        if(!codepoint.valid)
+        {
+            appended = it.index == it.end && normalizer_flush(&normalizer, false);
+            break;
+        }
+
+        char32_t decomposition[AFT_DECOMPOSITION_MAX];
+        int count = decompose(codepoint.value, decomposition);
+
+        for(int part_index = 0; appended && part_index < count; part_index += 1)
+        {
+            appended = normalizer_push(&normalizer, decomposition[part_index]);
+        }
+    }
+
+    normalizer_destroy(&normalizer);
+
+    if(!appended)
+    {
+        aft_string_remove(buffer, prior_count, aft_string_get_count(buffer));
+        return result;
+    }
+
+    result.value = aft_string_slice_string(buffer, prior_count, aft_string_get_count(buffer));
+    result.valid = true;
+
+    return result;
+}
+
+
+AftMaybeStringSlice aft_utf8_normalize_nfc(AftStringSlice slice, AftString* buffer)
+{
+    return normalize(slice, buffer, true);
+}
+
+AftMaybeStringSlice aft_utf8_normalize_nfd(AftStringSlice slice, AftString* buffer)
+{
+    return normalize(slice, buffer, false);
+}
@@ -1,11 +1,14 @@
 #include <AftString/aft_string.h>
 
+#include "byte_set.h"
 #include "floating_point_format.h"
+#include "number_parse.h"
+#include "parallel.h"
 
 #include <assert.h>
 #include <math.h>
 #include <stddef.h>
-#include <stdio.h>
+#include <stdlib.h>
 
 
 #define AFT_ASSERT(expression) \
@@ -13,14 +16,65 @@
 
 #define AFT_UINT64_MAX_BINARY_DIGITS 64
 #define AFT_UINT64_MAX_DECIMAL_DIGITS 20
+#define ASCII_DOUBLE_MAX_COUNT 25
+#define ASCII_DOUBLE_MAX_EXPONENT 21
+#define ASCII_DOUBLE_MIN_EXPONENT (-6)
+#define DOUBLE_MAX_INTEGER_DIGITS 309
+#define DOUBLE_MAX_LEADING_ZEROS 324
+#define DOUBLE_MAX_SHORTEST_DIGITS 17
+#define FORMAT_BATCH_CAP 1024
+#define FORMAT_WRITER_CAP 64
+
+
+// Collects formatted bytes. Writing to a string goes through a buffer on the
+// stack, so a whole number usually takes a single append. Writing to a
+// caller's buffer fails once it's full.
+typedef struct FormatWriter
+{
+    AftString* string;
+    char* bytes;
+    char stack[FORMAT_WRITER_CAP];
+    int cap;
+    int count;
+    bool failed;
+} FormatWriter;
+
+// An array of numbers in one format, written with a separator between them.
+// What's needed from the format is worked out once for the whole array, and
+// integers use a compiled format when it has a fast path.
+typedef struct NumberBatch
+{
+    AftStringSlice separator;
+    FloatFormat float_format;
+    const AftCompiledDecimalFormat* compiled;
+    const AftDecimalFormat* format;
+    const void* values;
+    AftFormatType type;
+    bool ascii_digits;
+} NumberBatch;
+
+// Each chunk but the first is written to its own string, to be joined after.
+typedef struct BatchChunk
+{
+    AftString string;
+    int end;
+    int start;
+    bool valid;
+} BatchChunk;
 
+typedef struct ParallelBatch
+{
+    const NumberBatch* batch;
+    AftString* string;
+    BatchChunk chunks[PARALLEL_THREAD_CAP];
+} ParallelBatch;
 
 typedef struct DecimalFormatter
 {
     uint64_t digits[AFT_UINT64_MAX_DECIMAL_DIGITS];
     const AftDecimalFormat* format;
     const AftString* group_separator;
-    AftString* string;
+    FormatWriter* writer;
     int digit_index;
     int digit_total;
     int digits_shown;
@@ -30,6 +84,18 @@ typedef struct DecimalFormatter
 static const char* base36_digits_uppercase = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
 static const char* base36_digits_lowercase = "0123456789abcdefghijklmnopqrstuvwxyz";
 
+static const char digit_pairs[201] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
 static const uint64_t powers_of_ten[AFT_UINT64_MAX_DECIMAL_DIGITS] =
 {
     UINT64_C(10000000000000000000),
@@ -64,6 +130,188 @@ static int count_digits(int value)
     return digits;
 }
 
+static int int_max(int a, int b)
+{
+    return (a > b) ? a : b;
+}
+
+static int int_min(int a, int b)
+{
+    return (a < b) ? a : b;
+}
+
+// The bit length times 1233 / 4096, which is just over log10(2), is either
+// the digit count or one less, so one comparison with a power of ten settles
+// it.
+static int count_decimal_digits(uint64_t value)
+{
+    // Setting the lowest bit counts zero as one digit without changing the
+    // count of anything else.
+    value |= 1;
+
+    int bits = 64 - count_leading_zeros64(value);
+    int guess = (bits * 1233) >> 12;
+    return guess + (value >= powers_of_ten[AFT_UINT64_MAX_DECIMAL_DIGITS - 1 - guess]);
+}
+
+// Write the ASCII digits of a value, two at a time, so they end at the given
+// count. The count must be from count_decimal_digits.
+static void write_decimal_digits(char* digits, uint64_t value, int count)
+{
+    int index = count;
+
+    while(value >= 100)
+    {
+        int pair = 2 * (int) (value % 100);
+        value /= 100;
+        index -= 2;
+        digits[index] = digit_pairs[pair];
+        digits[index + 1] = digit_pairs[pair + 1];
+    }
+
+    if(value >= 10)
+    {
+        int pair = 2 * (int) value;
+        digits[index - 2] = digit_pairs[pair];
+        digits[index - 1] = digit_pairs[pair + 1];
+    }
+    else
+    {
+        digits[index - 1] = (char) ('0' + value);
+    }
+}
+
+static bool has_ascii_digits(const AftNumberSymbols* symbols)
+{
+    for(int digit = 0; digit < 10; digit += 1)
+    {
+        const AftString* symbol = &symbols->digits[digit];
+
+        if(aft_string_get_count(symbol) != 1
+                || aft_string_get_contents_const(symbol)[0] != '0' + digit)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void format_writer_start_buffer(FormatWriter* writer, char* buffer, int cap)
+{
+    writer->string = NULL;
+    writer->bytes = buffer;
+    writer->cap = cap;
+    writer->count = 0;
+    writer->failed = false;
+}
+
+static void format_writer_start_string(FormatWriter* writer, AftString* string)
+{
+    writer->string = string;
+    writer->bytes = writer->stack;
+    writer->cap = FORMAT_WRITER_CAP;
+    writer->count = 0;
+    writer->failed = false;
+}
+
+// Writing many numbers at once goes through a bigger buffer than the one on
+// the writer, so there are fewer appends.
+static void format_writer_start_string_with_buffer(FormatWriter* writer, AftString* string, char* buffer, int cap)
+{
+    format_writer_start_string(writer, string);
+    writer->bytes = buffer;
+    writer->cap = cap;
+}
+
+// Writing to a caller's buffer has nothing to flush, so this only reports
+// whether everything fit.
+static bool format_writer_flush(FormatWriter* writer)
+{
+    if(writer->string && writer->count)
+    {
+        AftStringSlice slice = aft_string_slice_from_buffer(writer->bytes, writer->count);
+        writer->failed = !aft_string_append_slice(writer->string, slice) || writer->failed;
+        writer->count = 0;
+    }
+
+    return !writer->failed;
+}
+
+static AftMaybeInt format_writer_finish_buffer(FormatWriter* writer)
+{
+    AftMaybeInt result = {writer->count, !writer->failed};
+    return result;
+}
+
+// Take back anything already appended, so a string is left as it was when
+// formatting fails.
+static bool format_writer_finish_string(FormatWriter* writer, int prior_count)
+{
+    if(!format_writer_flush(writer))
+    {
+        aft_string_remove(writer->string, prior_count, aft_string_get_count(writer->string));
+        return false;
+    }
+
+    return true;
+}
+
+static void format_writer_put(FormatWriter* writer, const char* bytes, int count)
+{
+    if(count > writer->cap - writer->count)
+    {
+        if(!writer->string)
+        {
+            writer->failed = true;
+            return;
+        }
+
+        format_writer_flush(writer);
+
+        if(count > writer->cap)
+        {
+            AftStringSlice slice = aft_string_slice_from_buffer(bytes, count);
+            writer->failed = !aft_string_append_slice(writer->string, slice) || writer->failed;
+            return;
+        }
+    }
+
+    for(int byte_index = 0; byte_index < count; byte_index += 1)
+    {
+        writer->bytes[writer->count + byte_index] = bytes[byte_index];
+    }
+
+    writer->count += count;
+}
+
+static void format_writer_put_char(FormatWriter* writer, char c)
+{
+    if(writer->count == writer->cap)
+    {
+        if(!writer->string)
+        {
+            writer->failed = true;
+            return;
+        }
+
+        format_writer_flush(writer);
+    }
+
+    writer->bytes[writer->count] = c;
+    writer->count += 1;
+}
+
+static void format_writer_put_slice(FormatWriter* writer, AftStringSlice slice)
+{
+    format_writer_put(writer, aft_string_slice_start(slice), aft_string_slice_count(slice));
+}
+
+static void format_writer_put_string(FormatWriter* writer, const AftString* string)
+{
+    format_writer_put(writer, aft_string_get_contents_const(string), aft_string_get_count(string));
+}
+
 static bool default_number_symbols(AftNumberSymbols* symbols, void* allocator)
 {
     struct
@@ -228,6 +476,19 @@ static uint64_t round_uint64_and_sign(uint64_t value, uint64_t increment, bool s
     }
 }
 
+static bool is_group_boundary(int from_end, int primary_grouping_size, int secondary_grouping_size)
+{
+    int secondary_index = from_end - primary_grouping_size;
+    if(secondary_index > 0)
+    {
+        return secondary_index % secondary_grouping_size == 0;
+    }
+    else
+    {
+        return from_end == primary_grouping_size;
+    }
+}
+
 static bool separate_group_at_location(const AftDecimalFormat* format, int index, int length)
 {
     int from_end = index + 1;
@@ -238,19 +499,11 @@ static bool separate_group_at_location(const AftDecimalFormat* format, int index
     }
     else
     {
-        int secondary_index = from_end - format->primary_grouping_size;
-        if(secondary_index > 0)
-        {
-            return secondary_index % format->secondary_grouping_size == 0;
-        }
-        else
-        {
-            return from_end == format->primary_grouping_size;
-        }
+        return is_group_boundary(from_end, format->primary_grouping_size, format->secondary_grouping_size);
     }
 }
 
-static void append_pattern(AftString* string, const AftString* pattern, const AftDecimalFormat* format)
+static void write_pattern(FormatWriter* writer, const AftString* pattern, const AftDecimalFormat* format)
 {
     AftCodepointIterator it;
     aft_codepoint_iterator_set_string(&it, aft_string_slice_from_string(pattern));
@@ -274,43 +527,106 @@ static void append_pattern(AftString* string, const AftString* pattern, const Af
             {
                 if(format->use_explicit_plus_sign)
                 {
-                    aft_string_append(string, &format->symbols.plus_sign);
+                    format_writer_put_string(writer, &format->symbols.plus_sign);
                 }
                 break;
             }
             case U'-':
             {
-                aft_string_append(string, &format->symbols.minus_sign);
+                format_writer_put_string(writer, &format->symbols.minus_sign);
                 break;
             }
             case U'$':
             {
                 AFT_ASSERT(format->style == AFT_DECIMAL_FORMAT_STYLE_CURRENCY);
-                aft_string_append(string, &format->currency.symbol);
+                format_writer_put_string(writer, &format->currency.symbol);
                 break;
             }
             case U'%':
             {
                 AFT_ASSERT(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT);
-                aft_string_append(string, &format->symbols.percent_sign);
+                format_writer_put_string(writer, &format->symbols.percent_sign);
                 break;
             }
             case U'‰':
             {
                 AFT_ASSERT(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT);
-                aft_string_append(string, &format->symbols.per_mille_sign);
+                format_writer_put_string(writer, &format->symbols.per_mille_sign);
                 break;
             }
             default:
             {
                 AftStringSlice slice = aft_string_slice_string(pattern, prior_index, index);
-                aft_string_append_slice(string, slice);
+                format_writer_put_slice(writer, slice);
+                break;
+            }
+        }
+
+        prior_index = index;
+    }
+}
+
+// Count the bytes a pattern expands to, the same way write_pattern does.
+static int measure_pattern(const AftString* pattern, const AftDecimalFormat* format)
+{
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, aft_string_slice_from_string(pattern));
+
+    int count = 0;
+    int prior_index = 0;
+
+    for(;;)
+    {
+        AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+
+        if(!codepoint.valid)
+        {
+            break;
+        }
+
+        int index = aft_codepoint_iterator_get_index(&it);
+
+        switch(codepoint.value)
+        {
+            case U'+':
+            {
+                if(format->use_explicit_plus_sign)
+                {
+                    count += aft_string_get_count(&format->symbols.plus_sign);
+                }
+                break;
+            }
+            case U'-':
+            {
+                count += aft_string_get_count(&format->symbols.minus_sign);
+                break;
+            }
+            case U'$':
+            {
+                count += aft_string_get_count(&format->currency.symbol);
+                break;
+            }
+            case U'%':
+            {
+                count += aft_string_get_count(&format->symbols.percent_sign);
+                break;
+            }
+            case U'‰':
+            {
+                count += aft_string_get_count(&format->symbols.per_mille_sign);
+                break;
+            }
+            default:
+            {
+                count += index - prior_index;
                 break;
             }
         }
 
         prior_index = index;
     }
+
+    return count;
 }
 
 static uint64_t apply_multiplier(uint64_t value, const AftDecimalFormat* format)
@@ -337,15 +653,15 @@ static uint64_t apply_rounding(uint64_t value, bool sign, const AftDecimalFormat
     return result;
 }
 
-static void apply_prefix(AftString* string, const AftDecimalFormat* format, bool sign)
+static void apply_prefix(FormatWriter* writer, const AftDecimalFormat* format, bool sign)
 {
     if(sign)
     {
-        append_pattern(string, &format->negative_prefix_pattern, format);
+        write_pattern(writer, &format->negative_prefix_pattern, format);
     }
     else
     {
-        append_pattern(string, &format->positive_prefix_pattern, format);
+        write_pattern(writer, &format->positive_prefix_pattern, format);
     }
 }
 
@@ -398,10 +714,10 @@ static void pad_leading_zeros_and_set_digit_limits(DecimalFormatter* formatter)
 
                 if(separate_group_at_location(format, digit_index, format->min_integer_digits))
                 {
-                    aft_string_append(formatter->string, formatter->group_separator);
+                    format_writer_put_string(formatter->writer, formatter->group_separator);
                 }
 
-                aft_string_append(formatter->string, &format->symbols.digits[0]);
+                format_writer_put_string(formatter->writer, &format->symbols.digits[0]);
             }
 
             digit_total = format->min_integer_digits;
@@ -427,7 +743,7 @@ static void set_digit_limits_scientific(DecimalFormatter* formatter)
     }
     else
     {
-        digits_shown = format->max_fraction_digits + 1;
+        digits_shown = int_min(format->max_fraction_digits, AFT_UINT64_MAX_DECIMAL_DIGITS) + 1;
     }
 
     formatter->digit_index = digit_index;
@@ -452,11 +768,11 @@ static void format_significant_integer_digits(DecimalFormatter* formatter)
 
         if(separate_group_at_location(formatter->format, digit_index, formatter->digit_total))
         {
-            aft_string_append(formatter->string, formatter->group_separator);
+            format_writer_put_string(formatter->writer, formatter->group_separator);
         }
 
         int digit = (int) formatter->digits[digit_index];
-        aft_string_append(formatter->string, &formatter->format->symbols.digits[digit]);
+        format_writer_put_string(formatter->writer, &formatter->format->symbols.digits[digit]);
     }
 
     formatter->digit_index = digit_index;
@@ -468,27 +784,27 @@ static void format_scientific_digits_and_exponent(DecimalFormatter* formatter)
 
     int digit_index = formatter->digit_index - 1;
 
-    aft_string_append(formatter->string, &format->symbols.digits[formatter->digits[digit_index]]);
+    format_writer_put_string(formatter->writer, &format->symbols.digits[formatter->digits[digit_index]]);
     digit_index -= 1;
 
     if(formatter->digits_shown > 1)
     {
-        aft_string_append(formatter->string, &format->symbols.radix_separator);
+        format_writer_put_string(formatter->writer, &format->symbols.radix_separator);
 
         for(int digit_limiter = 1;
                 digit_limiter < formatter->digits_shown && digit_index >= 0;
                 digit_limiter += 1, digit_index -= 1)
         {
             int digit = (int) formatter->digits[digit_index];
-            aft_string_append(formatter->string, &format->symbols.digits[digit]);
+            format_writer_put_string(formatter->writer, &format->symbols.digits[digit]);
         }
 
-        aft_string_append(formatter->string, &format->symbols.exponential_sign);
+        format_writer_put_string(formatter->writer, &format->symbols.exponential_sign);
 
         int exponent = formatter->digit_index - 1;
         if(exponent < 0)
         {
-            aft_string_append(formatter->string, &format->symbols.minus_sign);
+            format_writer_put_string(formatter->writer, &format->symbols.minus_sign);
             exponent = -exponent;
         }
 
@@ -507,18 +823,48 @@ static void format_scientific_digits_and_exponent(DecimalFormatter* formatter)
                 exponent_digit_index -= 1)
         {
             int digit = exponent_digits[exponent_digit_index];
-            aft_string_append(formatter->string, &format->symbols.digits[digit]);
+            format_writer_put_string(formatter->writer, &format->symbols.digits[digit]);
         }
     }
 }
 
-static void pad_zeros_without_separator(AftString* string, const AftDecimalFormat* format, int count)
+static void pad_zeros_without_separator(FormatWriter* writer, const AftDecimalFormat* format, int count)
 {
     for(int zero_index = 0;
             zero_index < count;
             zero_index += 1)
     {
-        aft_string_append(string, &format->symbols.digits[0]);
+        format_writer_put_string(writer, &format->symbols.digits[0]);
+    }
+}
+
+// Quantity digits are values from 0 to 9. With ASCII digit symbols, a run of
+// them is written in one go rather than a symbol at a time.
+static void put_digit_run(FormatWriter* writer, const AftDecimalFormat* format, const char* digits, int count, bool ascii_digits)
+{
+    if(!ascii_digits)
+    {
+        for(int digit_index = 0; digit_index < count; digit_index += 1)
+        {
+            format_writer_put_string(writer, &format->symbols.digits[(int) digits[digit_index]]);
+        }
+        return;
+    }
+
+    char run[FORMAT_WRITER_CAP];
+
+    while(count > 0)
+    {
+        int run_count = int_min(count, FORMAT_WRITER_CAP);
+
+        for(int digit_index = 0; digit_index < run_count; digit_index += 1)
+        {
+            run[digit_index] = (char) ('0' + digits[digit_index]);
+        }
+
+        format_writer_put(writer, run, run_count);
+        digits += run_count;
+        count -= run_count;
     }
 }
 
@@ -533,56 +879,75 @@ static void format_remaining_integer_digits_and_fraction_digits(DecimalFormatter
         {
             if(separate_group_at_location(format, digit_index, formatter->digit_total))
             {
-                aft_string_append(formatter->string, formatter->group_separator);
+                format_writer_put_string(formatter->writer, formatter->group_separator);
             }
 
-            aft_string_append(formatter->string, &format->symbols.digits[0]);
+            format_writer_put_string(formatter->writer, &format->symbols.digits[0]);
         }
 
         if(format->min_significant_digits > formatter->digit_total)
         {
-            aft_string_append(formatter->string, &format->symbols.radix_separator);
+            format_writer_put_string(formatter->writer, &format->symbols.radix_separator);
 
             int zeros = format->min_significant_digits - formatter->digit_total;
-            pad_zeros_without_separator(formatter->string, format, zeros);
+            pad_zeros_without_separator(formatter->writer, format, zeros);
         }
     }
     else if(format->min_fraction_digits > 0)
     {
-        aft_string_append(formatter->string, &format->symbols.radix_separator);
-        pad_zeros_without_separator(formatter->string, format, format->min_fraction_digits);
+        format_writer_put_string(formatter->writer, &format->symbols.radix_separator);
+        pad_zeros_without_separator(formatter->writer, format, format->min_fraction_digits);
     }
 
     formatter->digit_index = digit_index;
 }
 
-static void apply_suffix(AftString* string, const AftDecimalFormat* format, bool sign)
+static void apply_suffix(FormatWriter* writer, const AftDecimalFormat* format, bool sign)
 {
     if(sign)
     {
-        append_pattern(string, &format->negative_suffix_pattern, format);
+        write_pattern(writer, &format->negative_suffix_pattern, format);
     }
     else
     {
-        append_pattern(string, &format->positive_suffix_pattern, format);
+        write_pattern(writer, &format->positive_suffix_pattern, format);
     }
 }
 
-static AftMaybeString string_from_uint64_and_sign(uint64_t value, bool sign, const AftDecimalFormat* format, void* allocator)
+// Without grouping, significant digits or scientific notation, the digits of
+// an integer are one run that can be written all at once.
+static void write_ascii_integer_and_fraction(FormatWriter* writer, uint64_t value, const AftDecimalFormat* format)
 {
-    AFT_ASSERT(aft_decimal_format_validate(format));
+    char digits[AFT_UINT64_MAX_DECIMAL_DIGITS];
+    int count = count_decimal_digits(value);
+    write_decimal_digits(digits, value, count);
 
-    AftMaybeString result;
-    result.valid = true;
-    aft_string_initialise_with_allocator(&result.value, allocator);
+    int shown = int_min(count, format->max_integer_digits);
+
+    if(format->max_integer_digits >= count && format->min_integer_digits > count)
+    {
+        pad_zeros_without_separator(writer, format, format->min_integer_digits - count);
+    }
+
+    format_writer_put_slice(writer, aft_string_slice_from_buffer(&digits[count - shown], shown));
+
+    if(format->min_fraction_digits > 0)
+    {
+        format_writer_put_string(writer, &format->symbols.radix_separator);
+        pad_zeros_without_separator(writer, format, format->min_fraction_digits);
+    }
+}
 
+// The format must already be validated.
+static void write_checked_uint64_and_sign(FormatWriter* writer, uint64_t value, bool sign, const AftDecimalFormat* format, bool ascii_digits)
+{
     value = apply_multiplier(value, format);
     value = apply_rounding(value, sign, format);
 
     DecimalFormatter formatter =
     {
         .format = format,
-        .string = &result.value,
+        .writer = writer,
     };
 
     formatter.group_separator = &format->symbols.group_separator;
@@ -591,7 +956,18 @@ static AftMaybeString string_from_uint64_and_sign(uint64_t value, bool sign, con
         formatter.group_separator = &format->symbols.currency_group_separator;
     }
 
-    apply_prefix(formatter.string, formatter.format, sign);
+    apply_prefix(writer, format, sign);
+
+    if(format->style != AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC
+            && !format->use_grouping
+            && !format->use_significant_digits
+            && ascii_digits)
+    {
+        write_ascii_integer_and_fraction(writer, value, format);
+        apply_suffix(writer, format, sign);
+        return;
+    }
+
     digitize(&formatter, value);
 
     switch(format->style)
@@ -613,38 +989,43 @@ static AftMaybeString string_from_uint64_and_sign(uint64_t value, bool sign, con
         }
     }
 
-    apply_suffix(formatter.string, formatter.format, sign);
+    apply_suffix(writer, format, sign);
+}
+
+static void write_uint64_and_sign(FormatWriter* writer, uint64_t value, bool sign, const AftDecimalFormat* format)
+{
+    AFT_ASSERT(aft_decimal_format_validate(format));
 
-    return result;
+    write_checked_uint64_and_sign(writer, value, sign, format, has_ascii_digits(&format->symbols));
 }
 
-static void format_float_result(AftMaybeString* result, const DecimalQuantity* quantity, const AftDecimalFormat* format)
+static void write_decimal_quantity(FormatWriter* writer, const DecimalQuantity* quantity, const AftDecimalFormat* format, bool ascii_digits)
 {
     switch(quantity->type)
     {
         case DECIMAL_QUANTITY_TYPE_INFINITY:
         {
-            apply_prefix(&result->value, format, quantity->sign);
-            aft_string_append(&result->value, &format->symbols.infinity_sign);
-            apply_suffix(&result->value, format, quantity->sign);
+            apply_prefix(writer, format, quantity->sign);
+            format_writer_put_string(writer, &format->symbols.infinity_sign);
+            apply_suffix(writer, format, quantity->sign);
             break;
         }
         case DECIMAL_QUANTITY_TYPE_NAN:
         {
-            aft_string_assign(&result->value, &format->symbols.nan_sign);
+            format_writer_put_string(writer, &format->symbols.nan_sign);
             break;
         }
         case DECIMAL_QUANTITY_TYPE_NORMAL:
         {
-            apply_prefix(&result->value, format, quantity->sign);
+            apply_prefix(writer, format, quantity->sign);
 
-            const char* digits_contents = aft_string_get_contents_const(&quantity->digits);
-            int digits_count = aft_string_get_count(&quantity->digits);
+            const char* digits_contents = quantity->digits;
+            int digits_count = quantity->digits_count;
 
             const AftString* group_separator = &format->symbols.group_separator;
             if(format->style == AFT_DECIMAL_FORMAT_STYLE_CURRENCY)
             {
-                const AftString* group_separator = &format->symbols.currency_group_separator;
+                group_separator = &format->symbols.currency_group_separator;
             }
 
             switch(format->style)
@@ -655,27 +1036,20 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
                 {
                     if(quantity->exponent <= 0)
                     {
-                        aft_string_append(&result->value, &format->symbols.digits[0]);
+                        format_writer_put_string(writer, &format->symbols.digits[0]);
 
                         if(digits_count >= 1 && (digits_count != 1 || digits_contents[0] != 0))
                         {
-                            aft_string_append(&result->value, &format->symbols.radix_separator);
-                            pad_zeros_without_separator(&result->value, format, -quantity->exponent);
-
-                            for(int digit_index = 0;
-                                    digit_index < digits_count;
-                                    digit_index += 1)
-                            {
-                                int digit = digits_contents[digit_index];
-                                aft_string_append(&result->value, &format->symbols.digits[digit]);
-                            }
+                            format_writer_put_string(writer, &format->symbols.radix_separator);
+                            pad_zeros_without_separator(writer, format, -quantity->exponent);
+                            put_digit_run(writer, format, digits_contents, digits_count, ascii_digits);
 
                             if(format->use_significant_digits)
                             {
                                 if(digits_count < format->min_significant_digits)
                                 {
                                     int zeros = format->min_significant_digits - digits_count;
-                                    pad_zeros_without_separator(&result->value, format, zeros);
+                                    pad_zeros_without_separator(writer, format, zeros);
                                 }
                             }
                             else
@@ -684,7 +1058,7 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
                                 if(fraction_digits < format->min_fraction_digits)
                                 {
                                     int zeros = format->min_fraction_digits - fraction_digits;
-                                    pad_zeros_without_separator(&result->value, format, zeros);
+                                    pad_zeros_without_separator(writer, format, zeros);
                                 }
                             }
                         }
@@ -706,50 +1080,54 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
                             {
                                 if(separate_group_at_location(format, integer_digits - digit_index - 1, integer_digits))
                                 {
-                                    aft_string_append(&result->value, group_separator);
+                                    format_writer_put_string(writer, group_separator);
                                 }
 
-                                aft_string_append(&result->value, &format->symbols.digits[0]);
+                                format_writer_put_string(writer, &format->symbols.digits[0]);
                             }
 
                             integers_so_far += zeros;
                         }
                         else if(quantity->exponent > format->max_integer_digits)
                         {
+                            // Only the lowest integer digits are shown, so
+                            // count locations from the first shown digit.
                             start_digit = quantity->exponent - format->max_integer_digits;
+                            integer_digits = format->max_integer_digits;
+                            integers_so_far = -start_digit;
                         }
 
-                        for(int digit_index = start_digit;
-                                digit_index < quantity->exponent;
-                                digit_index += 1)
+                        if(!format->use_grouping)
                         {
-                            int location = digit_index + integers_so_far;
-
-                            if(separate_group_at_location(format, integer_digits - location - 1, integer_digits))
-                            {
-                                aft_string_append(&result->value, group_separator);
-                            }
-
-                            int digit = digits_contents[digit_index];
-                            aft_string_append(&result->value, &format->symbols.digits[digit]);
+                            put_digit_run(writer, format, &digits_contents[start_digit], quantity->exponent - start_digit, ascii_digits);
                         }
+                        else
+                        {
+                            for(int digit_index = start_digit;
+                                    digit_index < quantity->exponent;
+                                    digit_index += 1)
+                            {
+                                int location = digit_index + integers_so_far;
 
-                        aft_string_append(&result->value, &format->symbols.radix_separator);
+                                if(separate_group_at_location(format, integer_digits - location - 1, integer_digits))
+                                {
+                                    format_writer_put_string(writer, group_separator);
+                                }
 
-                        for(int digit_index = quantity->exponent;
-                                digit_index < digits_count;
-                                digit_index += 1)
-                        {
-                            int digit = digits_contents[digit_index];
-                            aft_string_append(&result->value, &format->symbols.digits[digit]);
+                                int digit = digits_contents[digit_index];
+                                format_writer_put_string(writer, &format->symbols.digits[digit]);
+                            }
                         }
 
+                        format_writer_put_string(writer, &format->symbols.radix_separator);
+                        put_digit_run(writer, format, &digits_contents[quantity->exponent], digits_count - quantity->exponent, ascii_digits);
+
                         if(format->use_significant_digits)
                         {
                             if(digits_count < format->min_significant_digits)
                             {
                                 int zeros = format->min_significant_digits - digits_count;
-                                pad_zeros_without_separator(&result->value, format, zeros);
+                                pad_zeros_without_separator(writer, format, zeros);
                             }
                         }
                         else
@@ -758,7 +1136,7 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
                             if(fraction_digits < format->min_fraction_digits)
                             {
                                 int zeros = format->min_fraction_digits - fraction_digits;
-                                pad_zeros_without_separator(&result->value, format, zeros);
+                                pad_zeros_without_separator(writer, format, zeros);
                             }
                         }
                     }
@@ -779,17 +1157,21 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
                             {
                                 if(separate_group_at_location(format, integer_digits - digit_index - 1, integer_digits))
                                 {
-                                    aft_string_append(&result->value, group_separator);
+                                    format_writer_put_string(writer, group_separator);
                                 }
 
-                                aft_string_append(&result->value, &format->symbols.digits[0]);
+                                format_writer_put_string(writer, &format->symbols.digits[0]);
                             }
 
                             integers_so_far += zeros;
                         }
                         else if(quantity->exponent > format->max_integer_digits)
                         {
+                            // Only the lowest integer digits are shown, so
+                            // count locations from the first shown digit.
                             start_digit = quantity->exponent - format->max_integer_digits;
+                            integer_digits = format->max_integer_digits;
+                            integers_so_far = -start_digit;
                         }
 
                         for(int digit_index = start_digit;
@@ -800,14 +1182,14 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
 
                             if(separate_group_at_location(format, integer_digits - location - 1, integer_digits))
                             {
-                                aft_string_append(&result->value, group_separator);
+                                format_writer_put_string(writer, group_separator);
                             }
 
                             int digit = digits_contents[digit_index];
-                            aft_string_append(&result->value, &format->symbols.digits[digit]);
+                            format_writer_put_string(writer, &format->symbols.digits[digit]);
                         }
 
-                        for(int digit_index = digits_count;
+                        for(int digit_index = int_max(start_digit, digits_count);
                                 digit_index < quantity->exponent;
                                 digit_index += 1)
                         {
@@ -815,315 +1197,1367 @@ static void format_float_result(AftMaybeString* result, const DecimalQuantity* q
 
                             if(separate_group_at_location(format, integer_digits - location - 1, integer_digits))
                             {
-                                aft_string_append(&result->value, group_separator);
+                                format_writer_put_string(writer, group_separator);
                             }
 
-                            aft_string_append(&result->value, &format->symbols.digits[0]);
+                            format_writer_put_string(writer, &format->symbols.digits[0]);
                         }
 
                         if(format->use_significant_digits)
                         {
                             if(format->min_significant_digits > digits_count)
                             {
-                                aft_string_append(&result->value, &format->symbols.radix_separator);
+                                format_writer_put_string(writer, &format->symbols.radix_separator);
 
                                 int zeros = format->min_significant_digits - digits_count;
-                                pad_zeros_without_separator(&result->value, format, zeros);
+                                pad_zeros_without_separator(writer, format, zeros);
                             }
                         }
                         else if(format->min_fraction_digits > 0)
                         {
-                            aft_string_append(&result->value, &format->symbols.radix_separator);
+                            format_writer_put_string(writer, &format->symbols.radix_separator);
 
-                            pad_zeros_without_separator(&result->value, format, format->min_fraction_digits);
+                            pad_zeros_without_separator(writer, format, format->min_fraction_digits);
                         }
                     }
                     break;
                 }
                 case AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC:
                 {
-                    aft_string_append(&result->value, &format->symbols.digits[digits_contents[0]]);
+                    format_writer_put_string(writer, &format->symbols.digits[(int) digits_contents[0]]);
 
                     if(digits_count > 1)
                     {
-                        aft_string_append(&result->value, &format->symbols.radix_separator);
+                        format_writer_put_string(writer, &format->symbols.radix_separator);
 
-                        for(int digit_index = 1;
-                                digit_index < digits_count;
-                                digit_index += 1)
-                        {
-                            int digit = digits_contents[digit_index];
-                            aft_string_append(&result->value, &format->symbols.digits[digit]);
-                        }
+                        put_digit_run(writer, format, &digits_contents[1], digits_count - 1, ascii_digits);
+                    }
 
-                        aft_string_append(&result->value, &format->symbols.exponential_sign);
+                    format_writer_put_string(writer, &format->symbols.exponential_sign);
 
-                        int exponent = quantity->exponent - 1;
-                        if(exponent < 0)
-                        {
-                            aft_string_append(&result->value, &format->symbols.minus_sign);
-                            exponent = -exponent;
-                        }
+                    // Zero is written with a zero exponent.
+                    int exponent = 0;
+                    if(digits_count != 1 || digits_contents[0] != 0)
+                    {
+                        exponent = quantity->exponent - 1;
+                    }
 
-                        AFT_ASSERT(count_digits(exponent) <= 3);
-                        int exponent_digits[3];
-                        int exponent_digit_index = 0;
-                        do
-                        {
-                            exponent_digits[exponent_digit_index] = exponent % 10;
-                            exponent_digit_index += 1;
-                            exponent /= 10;
-                        } while(exponent);
-
-                        for(exponent_digit_index -= 1;
-                                exponent_digit_index >= 0;
-                                exponent_digit_index -= 1)
-                        {
-                            int digit = exponent_digits[exponent_digit_index];
-                            aft_string_append(&result->value, &format->symbols.digits[digit]);
-                        }
+                    if(exponent < 0)
+                    {
+                        format_writer_put_string(writer, &format->symbols.minus_sign);
+                        exponent = -exponent;
+                    }
+
+                    AFT_ASSERT(count_digits(exponent) <= 3);
+                    int exponent_digits[3];
+                    int exponent_digit_index = 0;
+                    do
+                    {
+                        exponent_digits[exponent_digit_index] = exponent % 10;
+                        exponent_digit_index += 1;
+                        exponent /= 10;
+                    } while(exponent);
+
+                    for(exponent_digit_index -= 1;
+                            exponent_digit_index >= 0;
+                            exponent_digit_index -= 1)
+                    {
+                        int digit = exponent_digits[exponent_digit_index];
+                        format_writer_put_string(writer, &format->symbols.digits[digit]);
                     }
                     break;
                 }
             }
 
-            apply_suffix(&result->value, format, quantity->sign);
+            apply_suffix(writer, format, quantity->sign);
             break;
         }
     }
 }
 
-AftMaybeString aft_ascii_from_double(double value)
+static bool has_digit_limit(const AftDecimalFormat* format)
 {
-    return aft_ascii_from_double_with_allocator(value, NULL);
-}
-
-AftMaybeString aft_ascii_from_double_with_allocator(double value, void* allocator)
+    if(format->use_significant_digits)
+    {
+        return format->max_significant_digits != AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+    }
+    else
+    {
+        return format->max_fraction_digits != AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+    }
+}
+
+static FloatFormat get_float_format(const AftDecimalFormat* format)
 {
-    AftMaybeString result;
-    result.valid = true;
-    aft_string_initialise_with_allocator(&result.value, allocator);
+    FloatFormat float_format;
+    float_format.rounding_mode = format->rounding_mode;
+
+    if(!has_digit_limit(format))
+    {
+        float_format.cutoff_mode = CUTOFF_MODE_SHORTEST;
+    }
+    else if(format->use_significant_digits)
+    {
+        float_format.cutoff_mode = CUTOFF_MODE_SIGNIFICANT_DIGITS;
+        float_format.max_significant_digits = format->max_significant_digits;
+        float_format.min_significant_digits = format->min_significant_digits;
+    }
+    else
+    {
+        if(format->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+        {
+            float_format.cutoff_mode = CUTOFF_MODE_SIGNIFICANT_DIGITS;
+            float_format.max_significant_digits = format->max_fraction_digits + 1;
+            float_format.min_significant_digits = format->min_fraction_digits + 1;
+        }
+        else
+        {
+            float_format.cutoff_mode = CUTOFF_MODE_FRACTION_DIGITS;
+            float_format.max_fraction_digits = format->max_fraction_digits;
+            float_format.min_fraction_digits = format->min_fraction_digits;
+        }
+    }
 
-    char cheating[25];
-    snprintf(cheating, 25, "%g", value);
-    aft_string_append_c_string(&result.value, cheating);
+    return float_format;
+}
 
-    return result;
+// The format must already be validated, and the float format taken from it.
+static void write_checked_double(FormatWriter* writer, double value, const AftDecimalFormat* format, const FloatFormat* float_format, bool ascii_digits)
+{
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT)
+    {
+        value *= (double) format->percent.multiplier;
+    }
+
+    DecimalQuantity quantity = format_double(value, float_format);
+    write_decimal_quantity(writer, &quantity, format, ascii_digits);
 }
 
-AftMaybeString aft_ascii_from_uint64(uint64_t value, const AftBaseFormat* format)
+static void write_double(FormatWriter* writer, double value, const AftDecimalFormat* format)
 {
-    return aft_ascii_from_uint64_with_allocator(value, format, NULL);
+    AFT_ASSERT(aft_decimal_format_validate(format));
+
+    FloatFormat float_format = get_float_format(format);
+    write_checked_double(writer, value, format, &float_format, has_ascii_digits(&format->symbols));
 }
 
-AftMaybeString aft_ascii_from_uint64_with_allocator(uint64_t value, const AftBaseFormat* format, void* allocator)
+static void write_float(FormatWriter* writer, float value, const AftDecimalFormat* format)
 {
-    AFT_ASSERT(allocator);
-    AFT_ASSERT(format);
-    AFT_ASSERT(format->base >= 2);
-    AFT_ASSERT(format->base <= 36);
+    AFT_ASSERT(aft_decimal_format_validate(format));
 
-    const char* base36_digits = base36_digits_lowercase;
-    if(format->use_uppercase)
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT)
     {
-        base36_digits = base36_digits_uppercase;
+        value *= (float) format->percent.multiplier;
     }
 
-    char digits[AFT_UINT64_MAX_BINARY_DIGITS + 1];
-    int digit_index = 0;
-    do
+    FloatFormat float_format = get_float_format(format);
+    DecimalQuantity quantity = format_float(value, &float_format);
+    write_decimal_quantity(writer, &quantity, format, has_ascii_digits(&format->symbols));
+}
+
+// Write the fewest digits that read back as the same double. Like JavaScript
+// numbers, those are in positional notation from 1e-6 up to 1e21 and
+// exponential notation outside that.
+static void write_ascii_double(FormatWriter* writer, double value)
+{
+    if(isnan(value))
     {
-        digits[digit_index] = base36_digits[value % format->base];
-        digit_index += 1;
-        value /= format->base;
-    } while(value && digit_index < AFT_UINT64_MAX_BINARY_DIGITS);
+        format_writer_put(writer, "nan", 3);
+        return;
+    }
 
-    digits[digit_index] = '\0';
+    if(signbit(value))
+    {
+        format_writer_put_char(writer, '-');
+    }
 
-    AftMaybeString result = aft_string_copy_c_string_with_allocator(digits, allocator);
-    aft_ascii_reverse(&result.value);
+    if(isinf(value))
+    {
+        format_writer_put(writer, "inf", 3);
+        return;
+    }
 
-    return result;
-}
+    DecimalFloat decimal = shortest_double(value);
 
-// Warning!
-//
-// This implementation does not produce very accurate results. A more robust
-// algorithm would use large integers and assemble the binary representation of
-// the double by parts. Repeatedly operating on a float-point intermediate value
-// compounds rounding errors and reduces the accuracy of the result in this
-// implementation.
-//
-// A good modern implementation might be something like Albert Chan's
-// strtod-fast in this repository https://github.com/achan001/dtoa-fast. Or
-// a simpler but less speedy traditional implementation using big integers
-// as outlined here
-// https://www.exploringbinary.com/correct-decimal-to-floating-point-using-big-integers/.
-AftMaybeDouble aft_ascii_to_double(AftStringSlice slice)
-{
-    AFT_ASSERT(aft_ascii_check(slice));
+    char digits[AFT_UINT64_MAX_DECIMAL_DIGITS];
+    int count = count_decimal_digits(decimal.significand);
+    write_decimal_digits(digits, decimal.significand, count);
 
-    AftMaybeDouble result;
-    result.valid = false;
-    result.value = 0.0;
+    int point = count + decimal.exponent;
 
-    bool sign = false;
+    if(point > ASCII_DOUBLE_MAX_EXPONENT || point <= ASCII_DOUBLE_MIN_EXPONENT)
+    {
+        format_writer_put_char(writer, digits[0]);
 
-    const char* contents = aft_string_slice_start(slice);
-    int count = aft_string_slice_count(slice);
+        if(count > 1)
+        {
+            format_writer_put_char(writer, '.');
+            format_writer_put(writer, &digits[1], count - 1);
+        }
 
-    int char_index = 0;
+        int exponent = point - 1;
+        format_writer_put(writer, exponent < 0 ? "e-" : "e+", 2);
 
-    if(char_index < count)
+        char exponent_digits[3];
+        int exponent_count = count_decimal_digits((uint64_t) abs(exponent));
+        write_decimal_digits(exponent_digits, (uint64_t) abs(exponent), exponent_count);
+        format_writer_put(writer, exponent_digits, exponent_count);
+    }
+    else if(point <= 0)
     {
-        if(contents[char_index] == '-')
+        format_writer_put(writer, "0.", 2);
+
+        for(int zero_index = point; zero_index < 0; zero_index += 1)
         {
-            sign = true;
-            char_index += 1;
+            format_writer_put_char(writer, '0');
         }
-        else if(contents[char_index] == '+')
+
+        format_writer_put(writer, digits, count);
+    }
+    else if(point < count)
+    {
+        format_writer_put(writer, digits, point);
+        format_writer_put_char(writer, '.');
+        format_writer_put(writer, &digits[point], count - point);
+    }
+    else
+    {
+        format_writer_put(writer, digits, count);
+
+        for(int zero_index = count; zero_index < point; zero_index += 1)
         {
-            sign = false;
-            char_index += 1;
+            format_writer_put_char(writer, '0');
         }
     }
+}
+
+static void write_ascii_int64(FormatWriter* writer, uint64_t magnitude, bool sign)
+{
+    char digits[AFT_UINT64_MAX_DECIMAL_DIGITS + 1];
+    digits[0] = '-';
+
+    int count = count_decimal_digits(magnitude);
+    write_decimal_digits(&digits[sign], magnitude, count);
 
-    double value = 0.0;
-    int mantissa_count = 0;
-    int fraction_digits = 0;
-    int exponent = 0;
+    format_writer_put_slice(writer, aft_string_slice_from_buffer(digits, count + sign));
+}
 
-    while(char_index < count && aft_ascii_is_numeric(contents[char_index]))
+static void write_int64(FormatWriter* writer, int64_t value, const AftDecimalFormat* format)
+{
+    bool sign = value < 0;
+    uint64_t magnitude = (uint64_t) value;
+    if(sign)
     {
-        value = (10.0 * value) + (contents[char_index] - '0');
-        char_index += 1;
-        mantissa_count += 1;
+        magnitude = ~magnitude + 1;
     }
 
-    if(char_index < count && contents[char_index] == '.')
+    if(format)
+    {
+        write_uint64_and_sign(writer, magnitude, sign, format);
+    }
+    else
     {
-        char_index += 1;
+        write_ascii_int64(writer, magnitude, sign);
+    }
+}
 
-        while(char_index < count && aft_ascii_is_numeric(contents[char_index]))
+static void write_format_value(FormatWriter* writer, const AftFormatValue* value)
+{
+    switch(value->type)
+    {
+        case AFT_FORMAT_TYPE_CODEPOINT:
         {
-            value = (10.0 * value) + (contents[char_index] - '0');
-            char_index += 1;
-            fraction_digits += 1;
-            mantissa_count += 1;
+            // Only strings are given codepoints, so the writer is never a
+            // fixed buffer here.
+            AFT_ASSERT(writer->string);
+            format_writer_flush(writer);
+            writer->failed = !aft_utf8_append_codepoint(writer->string, value->codepoint) || writer->failed;
+            break;
+        }
+        case AFT_FORMAT_TYPE_DOUBLE:
+        {
+            if(value->format)
+            {
+                write_double(writer, value->double_value, value->format);
+            }
+            else
+            {
+                write_ascii_double(writer, value->double_value);
+            }
+            break;
+        }
+        case AFT_FORMAT_TYPE_INT64:
+        {
+            write_int64(writer, value->int64_value, value->format);
+            break;
+        }
+        case AFT_FORMAT_TYPE_SLICE:
+        {
+            format_writer_put_slice(writer, value->slice);
+            break;
+        }
+        case AFT_FORMAT_TYPE_UINT64:
+        {
+            if(value->format)
+            {
+                write_uint64_and_sign(writer, value->uint64_value, false, value->format);
+            }
+            else
+            {
+                write_ascii_int64(writer, value->uint64_value, false);
+            }
+            break;
         }
-
-        exponent -= fraction_digits;
     }
+}
+
+// Guess how many bytes a number takes in a format. This doesn't have to be
+// exact, since it's only used to reserve space up front.
+static int estimate_decimal_count(const AftDecimalFormat* format, int digits)
+{
+    int affixes = aft_string_get_count(&format->negative_prefix_pattern)
+            + aft_string_get_count(&format->negative_suffix_pattern)
+            + aft_string_get_count(&format->symbols.minus_sign);
 
-    if(mantissa_count == 0)
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_CURRENCY)
     {
-        return result;
+        affixes += aft_string_get_count(&format->currency.symbol);
     }
 
-    if(char_index < count && (contents[char_index] == 'E' || contents[char_index] == 'e'))
-    {
-        char_index += 1;
+    int digit_bytes = aft_string_get_count(&format->symbols.digits[0]);
+    int separator_bytes = format->use_grouping ? aft_string_get_count(&format->symbols.group_separator) : 0;
 
-        bool exponent_sign = false;
+    return affixes + (digit_bytes * digits) + (separator_bytes * digits / 2);
+}
 
-        if(char_index < count)
+static int estimate_format_value_count(const AftFormatValue* value)
+{
+    switch(value->type)
+    {
+        case AFT_FORMAT_TYPE_CODEPOINT:
+        {
+            return 4;
+        }
+        case AFT_FORMAT_TYPE_DOUBLE:
         {
-            if(contents[char_index] == '-')
+            if(value->format)
             {
-                exponent_sign = true;
-                char_index += 1;
+                return estimate_decimal_count(value->format, 24);
             }
-            else if(contents[char_index] == '+')
+            return ASCII_DOUBLE_MAX_COUNT;
+        }
+        case AFT_FORMAT_TYPE_INT64:
+        case AFT_FORMAT_TYPE_UINT64:
+        {
+            if(value->format)
             {
-                exponent_sign = false;
-                char_index += 1;
+                return estimate_decimal_count(value->format, AFT_UINT64_MAX_DECIMAL_DIGITS);
             }
+            return AFT_UINT64_MAX_DECIMAL_DIGITS + 1;
+        }
+        case AFT_FORMAT_TYPE_SLICE:
+        {
+            return aft_string_slice_count(value->slice);
+        }
+    }
+
+    return 0;
+}
+
+static int get_affix_max_count(const AftDecimalFormat* format)
+{
+    int positive_count = measure_pattern(&format->positive_prefix_pattern, format)
+            + measure_pattern(&format->positive_suffix_pattern, format);
+    int negative_count = measure_pattern(&format->negative_prefix_pattern, format)
+            + measure_pattern(&format->negative_suffix_pattern, format);
+
+    return int_max(positive_count, negative_count);
+}
+
+static int get_digit_max_count(const AftDecimalFormat* format)
+{
+    int digit_max = 0;
+
+    for(int digit = 0; digit < 10; digit += 1)
+    {
+        digit_max = int_max(digit_max, aft_string_get_count(&format->symbols.digits[digit]));
+    }
+
+    return digit_max;
+}
+
+static int get_group_separator_count(const AftDecimalFormat* format, int integer_digits)
+{
+    const AftString* group_separator = &format->symbols.group_separator;
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_CURRENCY)
+    {
+        group_separator = &format->symbols.currency_group_separator;
+    }
+
+    int separators = 0;
+
+    for(int digit_index = 0; digit_index < integer_digits; digit_index += 1)
+    {
+        separators += separate_group_at_location(format, digit_index, -1);
+    }
+
+    return separators * aft_string_get_count(group_separator);
+}
+
+// Work out the most bytes a double can take in a format. Fixed-point doubles
+// can have up to 309 integer digits, and up to 324 zeros after the radix
+// separator before the first significant digit. Without a digit limit, there
+// are at most 17 significant digits.
+static int get_double_max_count(const AftDecimalFormat* format)
+{
+    int digit_max = get_digit_max_count(format);
+    int radix_count = aft_string_get_count(&format->symbols.radix_separator);
+    int count = get_affix_max_count(format);
+
+    int special_count = int_max(count + aft_string_get_count(&format->symbols.infinity_sign),
+            aft_string_get_count(&format->symbols.nan_sign));
+
+    int max_significant_digits = format->max_significant_digits;
+    int max_fraction_digits = format->max_fraction_digits;
+
+    if(!has_digit_limit(format))
+    {
+        max_significant_digits = DOUBLE_MAX_SHORTEST_DIGITS;
+        max_fraction_digits = DOUBLE_MAX_LEADING_ZEROS + DOUBLE_MAX_SHORTEST_DIGITS;
+    }
+
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+    {
+        if(!has_digit_limit(format))
+        {
+            max_fraction_digits = DOUBLE_MAX_SHORTEST_DIGITS - 1;
+        }
+
+        int digits_shown = format->use_significant_digits
+                ? int_max(max_significant_digits, format->min_significant_digits)
+                : int_max(max_fraction_digits, format->min_fraction_digits) + 1;
+
+        count += (digit_max * (int_max(1, digits_shown) + 3))
+                + radix_count
+                + aft_string_get_count(&format->symbols.exponential_sign)
+                + aft_string_get_count(&format->symbols.minus_sign);
+    }
+    else
+    {
+        int integer_digits = DOUBLE_MAX_INTEGER_DIGITS;
+        if(!format->use_significant_digits)
+        {
+            integer_digits = int_max(int_min(format->max_integer_digits, integer_digits), 1);
         }
+        integer_digits = int_max(integer_digits, format->min_integer_digits);
+
+        int fraction_digits = format->use_significant_digits
+                ? DOUBLE_MAX_LEADING_ZEROS + int_max(max_significant_digits, format->min_significant_digits)
+                : int_max(max_fraction_digits, format->min_fraction_digits);
+
+        count += (digit_max * (integer_digits + fraction_digits))
+                + get_group_separator_count(format, integer_digits)
+                + radix_count;
+    }
+
+    return int_max(count, special_count);
+}
 
-        int explicit_exponent = 0;
-        while(char_index < count && aft_ascii_is_numeric(contents[char_index]))
+// Work out the most bytes any 64-bit integer can take in a format, given how
+// long its prefix and suffix are.
+static int get_uint64_max_count(const AftDecimalFormat* format, int affix_count)
+{
+    int digit_max = get_digit_max_count(format);
+    int radix_count = aft_string_get_count(&format->symbols.radix_separator);
+    int zero_count = aft_string_get_count(&format->symbols.digits[0]);
+    int count = affix_count;
+
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+    {
+        int digits_shown = format->use_significant_digits
+                ? format->max_significant_digits
+                : int_min(format->max_fraction_digits, AFT_UINT64_MAX_DECIMAL_DIGITS) + 1;
+
+        count += digit_max * int_max(1, int_min(digits_shown, AFT_UINT64_MAX_DECIMAL_DIGITS));
+
+        if(digits_shown > 1)
         {
-            explicit_exponent = (10 * explicit_exponent) + (contents[char_index] - '0');
-            char_index += 1;
+            count += radix_count
+                    + aft_string_get_count(&format->symbols.exponential_sign)
+                    + (2 * digit_max);
         }
+    }
+    else
+    {
+        int integer_digits = AFT_UINT64_MAX_DECIMAL_DIGITS;
+        int fraction_count = 0;
 
-        if(exponent_sign)
+        if(format->use_significant_digits)
         {
-            exponent -= explicit_exponent;
+            if(format->min_significant_digits > 1)
+            {
+                fraction_count = radix_count + zero_count * (format->min_significant_digits - 1);
+            }
         }
         else
         {
-            exponent += explicit_exponent;
+            integer_digits = int_max(int_min(format->max_integer_digits, integer_digits), format->min_integer_digits);
+
+            if(format->min_fraction_digits > 0)
+            {
+                fraction_count = radix_count + zero_count * format->min_fraction_digits;
+            }
         }
+
+        count += (digit_max * integer_digits)
+                + get_group_separator_count(format, integer_digits)
+                + fraction_count;
+    }
+
+    return count;
+}
+
+static void put_compiled_digit(FormatWriter* writer, const AftCompiledDecimalFormat* compiled, int digit)
+{
+    if(compiled->ascii_digits)
+    {
+        format_writer_put_char(writer, (char) ('0' + digit));
     }
+    else
+    {
+        const char* digits = aft_string_get_contents_const(&compiled->digits);
+        int start = compiled->digit_starts[digit];
+        format_writer_put(writer, &digits[start], compiled->digit_starts[digit + 1] - start);
+    }
+}
 
-    if(exponent < -307 || exponent > 308)
+static void put_compiled_zeros(FormatWriter* writer, const AftCompiledDecimalFormat* compiled, int count)
+{
+    for(int zero_index = 0; zero_index < count; zero_index += 1)
     {
-        return result;
+        put_compiled_digit(writer, compiled, 0);
     }
+}
 
-    double power_of_ten = 10.0;
-    int exponent_magnitude = exponent;
-    if(exponent_magnitude < 0)
+static bool compiled_group_at_location(const AftCompiledDecimalFormat* compiled, int index, int length)
+{
+    if(index + 1 == length)
+    {
+        return false;
+    }
+    else if(index < 64)
+    {
+        return (compiled->grouping_mask >> index) & 1;
+    }
+    else
     {
-        exponent_magnitude = -exponent_magnitude;
+        return compiled->use_grouping
+                && is_group_boundary(index + 1, compiled->primary_grouping_size, compiled->secondary_grouping_size);
     }
+}
+
+// This follows the same steps as pad_leading_zeros_and_set_digit_limits,
+// format_significant_integer_digits and
+// format_remaining_integer_digits_and_fraction_digits, so the output matches
+// formatting with the uncompiled format.
+static void put_compiled_fixed_point(FormatWriter* writer, const AftCompiledDecimalFormat* compiled, const uint8_t* digits, int digit_total)
+{
+    int digit_index = digit_total;
+    int digits_shown;
 
-    while(exponent_magnitude)
+    if(compiled->use_significant_digits)
+    {
+        digits_shown = compiled->max_significant_digits;
+    }
+    else
     {
-        if(exponent_magnitude & 1)
+        digits_shown = compiled->max_integer_digits;
+
+        if(digits_shown < digit_total)
         {
-            if(exponent < 0)
-            {
-                value /= power_of_ten;
-            }
-            else
+            digit_index = digits_shown;
+        }
+        else if(digit_total < compiled->min_integer_digits)
+        {
+            for(int zero_index = compiled->min_integer_digits - 1;
+                    zero_index >= digit_total;
+                    zero_index -= 1)
             {
-                value *= power_of_ten;
+                if(compiled_group_at_location(compiled, zero_index, compiled->min_integer_digits))
+                {
+                    format_writer_put_string(writer, &compiled->group_separator);
+                }
+
+                put_compiled_digit(writer, compiled, 0);
             }
+
+            digit_total = compiled->min_integer_digits;
+        }
+    }
+
+    for(int digit_limiter = 0; digit_limiter < digits_shown; digit_limiter += 1)
+    {
+        digit_index -= 1;
+
+        if(digit_index < 0)
+        {
+            break;
+        }
+
+        if(compiled_group_at_location(compiled, digit_index, digit_total))
+        {
+            format_writer_put_string(writer, &compiled->group_separator);
         }
 
-        exponent_magnitude >>= 1;
-        power_of_ten *= power_of_ten;
+        put_compiled_digit(writer, compiled, digits[digit_index]);
+    }
+
+    if(compiled->use_significant_digits)
+    {
+        for(digit_index -= 1; digit_index >= 0; digit_index -= 1)
+        {
+            if(compiled_group_at_location(compiled, digit_index, digit_total))
+            {
+                format_writer_put_string(writer, &compiled->group_separator);
+            }
+
+            put_compiled_digit(writer, compiled, 0);
+        }
+
+        if(compiled->min_significant_digits > digit_total)
+        {
+            format_writer_put_string(writer, &compiled->radix_separator);
+            put_compiled_zeros(writer, compiled, compiled->min_significant_digits - digit_total);
+        }
+    }
+    else if(compiled->min_fraction_digits > 0)
+    {
+        format_writer_put_string(writer, &compiled->radix_separator);
+        put_compiled_zeros(writer, compiled, compiled->min_fraction_digits);
+    }
+}
+
+static void put_compiled_scientific(FormatWriter* writer, const AftCompiledDecimalFormat* compiled, const uint8_t* digits, int digit_total)
+{
+    int digits_shown;
+
+    if(compiled->use_significant_digits)
+    {
+        digits_shown = compiled->max_significant_digits;
+    }
+    else
+    {
+        digits_shown = int_min(compiled->max_fraction_digits, AFT_UINT64_MAX_DECIMAL_DIGITS) + 1;
+    }
+
+    int digit_index = digit_total - 1;
+    put_compiled_digit(writer, compiled, digits[digit_index]);
+    digit_index -= 1;
+
+    if(digits_shown > 1)
+    {
+        format_writer_put_string(writer, &compiled->radix_separator);
+
+        for(int digit_limiter = 1;
+                digit_limiter < digits_shown && digit_index >= 0;
+                digit_limiter += 1, digit_index -= 1)
+        {
+            put_compiled_digit(writer, compiled, digits[digit_index]);
+        }
+
+        format_writer_put_string(writer, &compiled->exponential_sign);
+
+        int exponent = digit_total - 1;
+        if(exponent >= 10)
+        {
+            put_compiled_digit(writer, compiled, exponent / 10);
+        }
+        put_compiled_digit(writer, compiled, exponent % 10);
+    }
+}
+
+static bool expand_pattern(AftString* string, const AftString* pattern, const AftDecimalFormat* format)
+{
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+    write_pattern(&writer, pattern, format);
+    return format_writer_flush(&writer);
+}
+
+static int copy_backward(char* buffer, int index, const AftString* string)
+{
+    const char* contents = aft_string_get_contents_const(string);
+    int count = aft_string_get_count(string);
+
+    for(int byte_index = count - 1; byte_index >= 0; byte_index -= 1)
+    {
+        index -= 1;
+        buffer[index] = contents[byte_index];
+    }
+
+    return index;
+}
+
+// Most formats have ASCII digits and only pad or group the integer part. For
+// those, the number is written from its end into a buffer.
+static bool can_append_compiled_fast(const AftCompiledDecimalFormat* compiled)
+{
+    return compiled->ascii_digits
+            && compiled->style != AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC
+            && !compiled->use_significant_digits
+            && compiled->max_integer_digits >= AFT_UINT64_MAX_DECIMAL_DIGITS
+            && compiled->min_integer_digits <= 64
+            && compiled->max_count <= FORMAT_WRITER_CAP;
+}
+
+// Write the number backward from the end of the buffer, which must be
+// FORMAT_WRITER_CAP bytes, and give the part that's written.
+static AftStringSlice write_compiled_fast(char* buffer, uint64_t value, bool sign, const AftCompiledDecimalFormat* compiled)
+{
+    int index = FORMAT_WRITER_CAP;
+
+    index = copy_backward(buffer, index, sign ? &compiled->negative_suffix : &compiled->positive_suffix);
+
+    if(compiled->min_fraction_digits > 0)
+    {
+        for(int zero_index = 0; zero_index < compiled->min_fraction_digits; zero_index += 1)
+        {
+            index -= 1;
+            buffer[index] = '0';
+        }
+
+        index = copy_backward(buffer, index, &compiled->radix_separator);
+    }
+
+    uint64_t grouping_mask = compiled->grouping_mask;
+    int min_integer_digits = compiled->min_integer_digits;
+
+    if(!grouping_mask)
+    {
+        int count = count_decimal_digits(value);
+        index -= count;
+        write_decimal_digits(&buffer[index], value, count);
+
+        for(; count < min_integer_digits; count += 1)
+        {
+            index -= 1;
+            buffer[index] = '0';
+        }
+    }
+    else
+    {
+        for(int digit_index = 0;; digit_index += 1)
+        {
+            index -= 1;
+            buffer[index] = (char) ('0' + value % 10);
+            value /= 10;
+
+            if(!value && digit_index + 1 >= min_integer_digits)
+            {
+                break;
+            }
+
+            if((grouping_mask >> digit_index) & 1)
+            {
+                index = copy_backward(buffer, index, &compiled->group_separator);
+            }
+        }
+    }
+
+    index = copy_backward(buffer, index, sign ? &compiled->negative_prefix : &compiled->positive_prefix);
+
+    return aft_string_slice_from_buffer(&buffer[index], FORMAT_WRITER_CAP - index);
+}
+
+static uint64_t apply_compiled_multiplier_and_rounding(uint64_t value, bool sign, const AftCompiledDecimalFormat* compiled)
+{
+    if(compiled->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT)
+    {
+        value *= compiled->multiplier;
+    }
+
+    if(compiled->rounding_increment != 1)
+    {
+        value = round_uint64_and_sign(value, compiled->rounding_increment, sign, compiled->rounding_mode);
+    }
+
+    return value;
+}
+
+static bool append_compiled(AftString* string, uint64_t value, bool sign, const AftCompiledDecimalFormat* compiled)
+{
+    AFT_ASSERT(string);
+    AFT_ASSERT(compiled);
+
+    int prior_count = aft_string_get_count(string);
+
+    if(!aft_string_reserve(string, prior_count + compiled->max_count))
+    {
+        return false;
+    }
+
+    value = apply_compiled_multiplier_and_rounding(value, sign, compiled);
+
+    if(can_append_compiled_fast(compiled))
+    {
+        char buffer[FORMAT_WRITER_CAP];
+        return aft_string_append_slice(string, write_compiled_fast(buffer, value, sign, compiled));
+    }
+
+    uint8_t digits[AFT_UINT64_MAX_DECIMAL_DIGITS];
+    int digit_total = 0;
+
+    do
+    {
+        digits[digit_total] = (uint8_t) (value % 10);
+        digit_total += 1;
+        value /= 10;
+    } while(value);
+
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+
+    format_writer_put_string(&writer, sign ? &compiled->negative_prefix : &compiled->positive_prefix);
+
+    if(compiled->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+    {
+        put_compiled_scientific(&writer, compiled, digits, digit_total);
+    }
+    else
+    {
+        put_compiled_fixed_point(&writer, compiled, digits, digit_total);
+    }
+
+    format_writer_put_string(&writer, sign ? &compiled->negative_suffix : &compiled->positive_suffix);
+
+    return format_writer_finish_string(&writer, prior_count);
+}
+
+// Work out the fewest and most bytes any integer can take in a compiled
+// format, so appending can reserve space once.
+static void set_compiled_count_bounds(AftCompiledDecimalFormat* compiled, const AftDecimalFormat* format)
+{
+    int digit_min = compiled->digit_starts[1];
+
+    for(int digit = 0; digit < 10; digit += 1)
+    {
+        int digit_count = compiled->digit_starts[digit + 1] - compiled->digit_starts[digit];
+        digit_min = int_min(digit_min, digit_count);
+    }
+
+    int zero_count = compiled->digit_starts[1];
+    int radix_count = aft_string_get_count(&compiled->radix_separator);
+    int positive_count = aft_string_get_count(&compiled->positive_prefix)
+            + aft_string_get_count(&compiled->positive_suffix);
+    int negative_count = aft_string_get_count(&compiled->negative_prefix)
+            + aft_string_get_count(&compiled->negative_suffix);
+
+    int min_count = int_min(positive_count, negative_count);
+
+    if(compiled->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+    {
+        min_count += digit_min;
+    }
+    else if(compiled->use_significant_digits)
+    {
+        if(compiled->max_significant_digits > 0)
+        {
+            min_count += digit_min;
+        }
+    }
+    else
+    {
+        if(compiled->max_integer_digits > 0)
+        {
+            min_count += digit_min;
+        }
+
+        if(compiled->min_fraction_digits > 0)
+        {
+            min_count += radix_count + zero_count * compiled->min_fraction_digits;
+        }
+    }
+
+    compiled->max_count = get_uint64_max_count(format, int_max(positive_count, negative_count));
+    compiled->min_count = min_count;
+}
+
+static void write_batch_value(FormatWriter* writer, const NumberBatch* batch, int index)
+{
+    if(batch->type == AFT_FORMAT_TYPE_DOUBLE)
+    {
+        double value = ((const double*) batch->values)[index];
+
+        if(batch->format)
+        {
+            write_checked_double(writer, value, batch->format, &batch->float_format, batch->ascii_digits);
+        }
+        else
+        {
+            write_ascii_double(writer, value);
+        }
+    }
+    else
+    {
+        int64_t value = ((const int64_t*) batch->values)[index];
+        bool sign = value < 0;
+        uint64_t magnitude = (uint64_t) value;
+        if(sign)
+        {
+            magnitude = ~magnitude + 1;
+        }
+
+        if(batch->compiled)
+        {
+            char buffer[FORMAT_WRITER_CAP];
+            magnitude = apply_compiled_multiplier_and_rounding(magnitude, sign, batch->compiled);
+            format_writer_put_slice(writer, write_compiled_fast(buffer, magnitude, sign, batch->compiled));
+        }
+        else if(batch->format)
+        {
+            write_checked_uint64_and_sign(writer, magnitude, sign, batch->format, batch->ascii_digits);
+        }
+        else
+        {
+            write_ascii_int64(writer, magnitude, sign);
+        }
+    }
+}
+
+// The separator goes before every value but the first in the whole array, so
+// chunks can be joined as they are.
+static bool append_batch_range(AftString* string, const NumberBatch* batch, int start, int end)
+{
+    char buffer[FORMAT_BATCH_CAP];
+    FormatWriter writer;
+    format_writer_start_string_with_buffer(&writer, string, buffer, FORMAT_BATCH_CAP);
+    int prior_count = aft_string_get_count(string);
+
+    for(int index = start; index < end && !writer.failed; index += 1)
+    {
+        if(index > 0)
+        {
+            format_writer_put_slice(&writer, batch->separator);
+        }
+
+        write_batch_value(&writer, batch, index);
+    }
+
+    return format_writer_finish_string(&writer, prior_count);
+}
+
+static void append_batch_task(void* data, int task_index)
+{
+    ParallelBatch* parallel = (ParallelBatch*) data;
+    BatchChunk* chunk = &parallel->chunks[task_index];
+    AftString* string = task_index == 0 ? parallel->string : &chunk->string;
+
+    chunk->valid = append_batch_range(string, parallel->batch, chunk->start, chunk->end);
+}
+
+// Split the array into even chunks and format each on its own thread. The
+// first chunk goes straight into the string and the rest are appended after.
+static bool append_batch_in_parallel(AftString* string, const NumberBatch* batch, int count, int chunk_count)
+{
+    ParallelBatch parallel;
+    parallel.batch = batch;
+    parallel.string = string;
+
+    for(int chunk_index = 0; chunk_index < chunk_count; chunk_index += 1)
+    {
+        BatchChunk* chunk = &parallel.chunks[chunk_index];
+        aft_string_initialise_with_allocator(&chunk->string, string->allocator);
+        chunk->start = (int) ((int64_t) count * chunk_index / chunk_count);
+        chunk->end = (int) ((int64_t) count * (chunk_index + 1) / chunk_count);
+    }
+
+    int prior_count = aft_string_get_count(string);
+
+    parallel_run(append_batch_task, &parallel, chunk_count);
+
+    bool valid = true;
+
+    for(int chunk_index = 0; chunk_index < chunk_count; chunk_index += 1)
+    {
+        BatchChunk* chunk = &parallel.chunks[chunk_index];
+        valid = valid && chunk->valid;
+
+        if(chunk_index > 0)
+        {
+            valid = valid && aft_string_append(string, &chunk->string);
+            aft_string_destroy(&chunk->string);
+        }
+    }
+
+    if(!valid)
+    {
+        aft_string_remove(string, prior_count, aft_string_get_count(string));
+    }
+
+    return valid;
+}
+
+static bool append_batch(AftString* string, const NumberBatch* batch, int count, const AftBatchFormatOptions* options)
+{
+    int chunk_count = parallel_clamp_thread_count(options->thread_count);
+
+    if(options->chunk_size > 0 && count / options->chunk_size < chunk_count)
+    {
+        chunk_count = count / options->chunk_size;
+    }
+
+    if(chunk_count > 1)
+    {
+        return append_batch_in_parallel(string, batch, count, chunk_count);
+    }
+
+    return append_batch_range(string, batch, 0, count);
+}
+
+static void start_batch(NumberBatch* batch, const AftDecimalFormat* format, const AftBatchFormatOptions* options)
+{
+    AFT_ASSERT(options);
+    AFT_ASSERT(!format || aft_decimal_format_validate(format));
+
+    batch->separator = options->separator;
+    batch->compiled = NULL;
+    batch->format = format;
+
+    if(format)
+    {
+        batch->float_format = get_float_format(format);
+        batch->ascii_digits = has_ascii_digits(&format->symbols);
+    }
+}
+
+
+AftMaybeString aft_ascii_from_double(double value)
+{
+    return aft_ascii_from_double_with_allocator(value, NULL);
+}
+
+AftMaybeString aft_ascii_from_double_with_allocator(double value, void* allocator)
+{
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+
+    FormatWriter writer;
+    format_writer_start_string(&writer, &result.value);
+    write_ascii_double(&writer, value);
+
+    result.valid = format_writer_finish_string(&writer, 0);
+
+    return result;
+}
+
+AftMaybeString aft_ascii_from_uint64(uint64_t value, const AftBaseFormat* format)
+{
+    return aft_ascii_from_uint64_with_allocator(value, format, NULL);
+}
+
+AftMaybeString aft_ascii_from_uint64_with_allocator(uint64_t value, const AftBaseFormat* format, void* allocator)
+{
+    AFT_ASSERT(allocator);
+    AFT_ASSERT(format);
+    AFT_ASSERT(format->base >= 2);
+    AFT_ASSERT(format->base <= 36);
+
+    const char* base36_digits = base36_digits_lowercase;
+    if(format->use_uppercase)
+    {
+        base36_digits = base36_digits_uppercase;
+    }
+
+    // The digits are written from the end of the buffer, so they don't have
+    // to be reversed afterward.
+    char digits[AFT_UINT64_MAX_BINARY_DIGITS];
+    int index = AFT_UINT64_MAX_BINARY_DIGITS;
+
+    if(format->base == 10)
+    {
+        index -= count_decimal_digits(value);
+        write_decimal_digits(&digits[index], value, AFT_UINT64_MAX_BINARY_DIGITS - index);
+    }
+    else if(!(format->base & (format->base - 1)))
+    {
+        // A power of two base takes the same number of bits for each digit.
+        int shift = count_trailing_zeros64(format->base);
+        uint64_t mask = format->base - 1;
+
+        do
+        {
+            index -= 1;
+            digits[index] = base36_digits[value & mask];
+            value >>= shift;
+        } while(value);
+    }
+    else
+    {
+        do
+        {
+            index -= 1;
+            digits[index] = base36_digits[value % format->base];
+            value /= format->base;
+        } while(value);
+    }
+
+    AftStringSlice slice = aft_string_slice_from_buffer(&digits[index], AFT_UINT64_MAX_BINARY_DIGITS - index);
+    return aft_string_copy_slice_with_allocator(slice, allocator);
+}
+
+AftMaybeDouble aft_ascii_to_double(AftStringSlice slice)
+{
+    AFT_ASSERT(aft_ascii_check(slice));
+
+    AftMaybeDouble result;
+    result.valid = false;
+    result.value = 0.0;
+
+    ParsedDecimal decimal;
+    int count = parse_decimal(slice, &decimal);
+
+    if(count == 0 || count != aft_string_slice_count(slice))
+    {
+        return result;
+    }
+
+    result.valid = true;
+    result.value = decimal_to_double(&decimal);
+
+    return result;
+}
+
+AftMaybeFloat aft_ascii_to_float(AftStringSlice slice)
+{
+    AFT_ASSERT(aft_ascii_check(slice));
+
+    AftMaybeFloat result;
+    result.valid = false;
+    result.value = 0.0f;
+
+    ParsedDecimal decimal;
+    int count = parse_decimal(slice, &decimal);
+
+    if(count == 0 || count != aft_string_slice_count(slice))
+    {
+        return result;
+    }
+
+    result.valid = true;
+    result.value = decimal_to_float(&decimal);
+
+    return result;
+}
+
+AftMaybeInt32 aft_ascii_to_int32(AftStringSlice slice)
+{
+    int count;
+    AftMaybeInt32 result = aft_ascii_to_int32_with_base(slice, 10, &count);
+    result.valid = result.valid && count == aft_string_slice_count(slice);
+    return result;
+}
+
+AftMaybeInt32 aft_ascii_to_int32_with_base(AftStringSlice slice, int base, int* count)
+{
+    AFT_ASSERT(aft_ascii_check(slice));
+
+    AftMaybeInt32 result;
+    result.valid = false;
+    result.value = 0;
+
+    bool sign;
+    uint64_t magnitude;
+    int64_t value;
+
+    if(!parse_integer(slice, base, true, count, &sign, &magnitude)
+            || !apply_sign(sign, magnitude, INT32_MAX, &value))
+    {
+        return result;
+    }
+
+    result.valid = true;
+    result.value = (int32_t) value;
+
+    return result;
+}
+
+AftMaybeInt64 aft_ascii_to_int64(AftStringSlice slice)
+{
+    int count;
+    AftMaybeInt64 result = aft_ascii_to_int64_with_base(slice, 10, &count);
+    result.valid = result.valid && count == aft_string_slice_count(slice);
+    return result;
+}
+
+AftMaybeInt64 aft_ascii_to_int64_with_base(AftStringSlice slice, int base, int* count)
+{
+    AFT_ASSERT(aft_ascii_check(slice));
+
+    AftMaybeInt64 result;
+    result.valid = false;
+    result.value = 0;
+
+    bool sign;
+    uint64_t magnitude;
+    int64_t value;
+
+    if(!parse_integer(slice, base, true, count, &sign, &magnitude)
+            || !apply_sign(sign, magnitude, INT64_MAX, &value))
+    {
+        return result;
+    }
+
+    result.valid = true;
+    result.value = (int64_t) value;
+
+    return result;
+}
+
+AftMaybeUint64 aft_ascii_to_uint64(AftStringSlice slice)
+{
+    int count;
+    AftMaybeUint64 result = aft_ascii_to_uint64_with_base(slice, 10, &count);
+    result.valid = result.valid && count == aft_string_slice_count(slice);
+    return result;
+}
+
+AftMaybeUint64 aft_ascii_to_uint64_with_base(AftStringSlice slice, int base, int* count)
+{
+    AFT_ASSERT(aft_ascii_check(slice));
+
+    AftMaybeUint64 result;
+    result.valid = false;
+    result.value = 0;
+
+    bool sign;
+    uint64_t magnitude;
+
+    if(!parse_integer(slice, base, false, count, &sign, &magnitude))
+    {
+        return result;
+    }
+
+    result.valid = true;
+    result.value = magnitude;
+
+    return result;
+}
+
+void aft_compiled_decimal_format_destroy(AftCompiledDecimalFormat* compiled)
+{
+    AFT_ASSERT(compiled);
+
+    aft_string_destroy(&compiled->digits);
+    aft_string_destroy(&compiled->exponential_sign);
+    aft_string_destroy(&compiled->group_separator);
+    aft_string_destroy(&compiled->negative_prefix);
+    aft_string_destroy(&compiled->negative_suffix);
+    aft_string_destroy(&compiled->positive_prefix);
+    aft_string_destroy(&compiled->positive_suffix);
+    aft_string_destroy(&compiled->radix_separator);
+}
+
+
+bool aft_decimal_format_compile(AftCompiledDecimalFormat* compiled, const AftDecimalFormat* format)
+{
+    return aft_decimal_format_compile_with_allocator(compiled, format, NULL);
+}
+
+bool aft_decimal_format_compile_with_allocator(AftCompiledDecimalFormat* compiled, const AftDecimalFormat* format, void* allocator)
+{
+    AFT_ASSERT(compiled);
+    AFT_ASSERT(format);
+    AFT_ASSERT(aft_decimal_format_validate(format));
+
+    aft_string_initialise_with_allocator(&compiled->digits, allocator);
+    aft_string_initialise_with_allocator(&compiled->exponential_sign, allocator);
+    aft_string_initialise_with_allocator(&compiled->group_separator, allocator);
+    aft_string_initialise_with_allocator(&compiled->negative_prefix, allocator);
+    aft_string_initialise_with_allocator(&compiled->negative_suffix, allocator);
+    aft_string_initialise_with_allocator(&compiled->positive_prefix, allocator);
+    aft_string_initialise_with_allocator(&compiled->positive_suffix, allocator);
+    aft_string_initialise_with_allocator(&compiled->radix_separator, allocator);
+
+    const AftString* group_separator = &format->symbols.group_separator;
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_CURRENCY)
+    {
+        group_separator = &format->symbols.currency_group_separator;
     }
 
-    if(sign)
+    bool copied = true;
+    bool ascii_digits = true;
+
+    for(int digit = 0; digit < 10; digit += 1)
     {
-        value = -value;
+        const AftString* symbol = &format->symbols.digits[digit];
+
+        compiled->digit_starts[digit] = aft_string_get_count(&compiled->digits);
+        copied = copied && aft_string_append(&compiled->digits, symbol);
+        ascii_digits = ascii_digits
+                && aft_string_get_count(symbol) == 1
+                && aft_string_get_contents_const(symbol)[0] == '0' + digit;
     }
 
-    result.valid = true;
-    result.value = value;
+    compiled->digit_starts[10] = aft_string_get_count(&compiled->digits);
 
-    return result;
-}
+    // The affix patterns are expanded here, so formatting only has to copy
+    // their bytes.
+    copied = copied
+            && aft_string_append(&compiled->exponential_sign, &format->symbols.exponential_sign)
+            && aft_string_append(&compiled->group_separator, group_separator)
+            && aft_string_append(&compiled->radix_separator, &format->symbols.radix_separator)
+            && expand_pattern(&compiled->negative_prefix, &format->negative_prefix_pattern, format)
+            && expand_pattern(&compiled->negative_suffix, &format->negative_suffix_pattern, format)
+            && expand_pattern(&compiled->positive_prefix, &format->positive_prefix_pattern, format)
+            && expand_pattern(&compiled->positive_suffix, &format->positive_suffix_pattern, format);
 
-AftMaybeUint64 aft_ascii_to_uint64(AftStringSlice slice)
-{
-    AFT_ASSERT(aft_ascii_check(slice));
+    if(!copied)
+    {
+        aft_compiled_decimal_format_destroy(compiled);
+        return false;
+    }
 
-    AftMaybeUint64 result;
-    result.valid = true;
-    result.value = 0;
+    uint64_t grouping_mask = 0;
 
-    const char* contents = aft_string_slice_start(slice);
-    int count = aft_string_slice_count(slice);
+    for(int digit_index = 0; digit_index < 64; digit_index += 1)
+    {
+        uint64_t separate = separate_group_at_location(format, digit_index, -1);
+        grouping_mask |= separate << digit_index;
+    }
 
-    int power_index = AFT_UINT64_MAX_DECIMAL_DIGITS - count;
+    compiled->grouping_mask = grouping_mask;
 
-    for(int char_index = 0; char_index < count; char_index += 1)
+    if(format->use_significant_digits)
     {
-        uint64_t character = contents[char_index];
-        uint64_t digit = character - '0';
-        if(digit >= 10)
-        {
-            result.valid = false;
-            return result;
-        }
-        result.value += powers_of_ten[power_index] * digit;
+        compiled->max_significant_digits = format->max_significant_digits;
+        compiled->min_significant_digits = format->min_significant_digits;
+    }
+    else
+    {
+        compiled->max_fraction_digits = format->max_fraction_digits;
+        compiled->max_integer_digits = format->max_integer_digits;
+        compiled->min_fraction_digits = format->min_fraction_digits;
+        compiled->min_integer_digits = format->min_integer_digits;
     }
 
-    return result;
+    compiled->multiplier = 1;
+    if(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT)
+    {
+        compiled->multiplier = format->percent.multiplier;
+    }
+
+    compiled->rounding_increment = format->rounding_increment_int;
+    compiled->rounding_mode = format->rounding_mode;
+    compiled->style = format->style;
+    compiled->primary_grouping_size = format->primary_grouping_size;
+    compiled->secondary_grouping_size = format->secondary_grouping_size;
+    compiled->ascii_digits = ascii_digits;
+    compiled->use_grouping = format->use_grouping;
+    compiled->use_significant_digits = format->use_significant_digits;
+
+    set_compiled_count_bounds(compiled, format);
+
+    return true;
 }
 
 bool aft_decimal_format_default(AftDecimalFormat* format)
@@ -1233,6 +2667,30 @@ void aft_decimal_format_destroy(AftDecimalFormat* format)
     aft_string_destroy(&format->positive_suffix_pattern);
 }
 
+int aft_decimal_format_get_max_count(const AftDecimalFormat* format, AftFormatType type)
+{
+    AFT_ASSERT(format);
+    AFT_ASSERT(aft_decimal_format_validate(format));
+
+    switch(type)
+    {
+        case AFT_FORMAT_TYPE_DOUBLE:
+        {
+            return get_double_max_count(format);
+        }
+        case AFT_FORMAT_TYPE_INT64:
+        case AFT_FORMAT_TYPE_UINT64:
+        {
+            return get_uint64_max_count(format, get_affix_max_count(format));
+        }
+        default:
+        {
+            AFT_ASSERT(false);
+            return 0;
+        }
+    }
+}
+
 bool aft_decimal_format_validate(const AftDecimalFormat* format)
 {
     bool rounding_increments_valid =
@@ -1256,105 +2714,356 @@ bool aft_decimal_format_validate(const AftDecimalFormat* format)
     return rounding_increments_valid && digit_limits_valid;
 }
 
-AftMaybeString aft_string_from_double(double value, const AftDecimalFormat* format)
+
+AftMaybeInt aft_double_to_buffer(double value, const AftDecimalFormat* format, char* buffer, int cap)
 {
-    return aft_string_from_double_with_allocator(value, format, NULL);
+    AFT_ASSERT(buffer || cap == 0);
+
+    FormatWriter writer;
+    format_writer_start_buffer(&writer, buffer, cap);
+    write_double(&writer, value, format);
+    return format_writer_finish_buffer(&writer);
 }
 
-AftMaybeString aft_string_from_double_with_allocator(double value, const AftDecimalFormat* format, void* allocator)
+AftMaybeInt aft_float_to_buffer(float value, const AftDecimalFormat* format, char* buffer, int cap)
 {
-    AFT_ASSERT(aft_decimal_format_validate(format));
+    AFT_ASSERT(buffer || cap == 0);
 
-    AftMaybeString result;
-    result.valid = true;
-    aft_string_initialise_with_allocator(&result.value, allocator);
+    FormatWriter writer;
+    format_writer_start_buffer(&writer, buffer, cap);
+    write_float(&writer, value, format);
+    return format_writer_finish_buffer(&writer);
+}
 
-    if(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT)
+AftMaybeInt aft_int_to_buffer(int value, const AftDecimalFormat* format, char* buffer, int cap)
+{
+    return aft_int64_to_buffer(value, format, buffer, cap);
+}
+
+AftMaybeInt aft_int64_to_buffer(int64_t value, const AftDecimalFormat* format, char* buffer, int cap)
+{
+    AFT_ASSERT(format);
+    AFT_ASSERT(buffer || cap == 0);
+
+    FormatWriter writer;
+    format_writer_start_buffer(&writer, buffer, cap);
+    write_int64(&writer, value, format);
+    return format_writer_finish_buffer(&writer);
+}
+
+AftMaybeInt aft_uint64_to_buffer(uint64_t value, const AftDecimalFormat* format, char* buffer, int cap)
+{
+    AFT_ASSERT(format);
+    AFT_ASSERT(buffer || cap == 0);
+
+    FormatWriter writer;
+    format_writer_start_buffer(&writer, buffer, cap);
+    write_uint64_and_sign(&writer, value, false, format);
+    return format_writer_finish_buffer(&writer);
+}
+
+
+AftFormatValue aft_format_value_from_codepoint(char32_t codepoint)
+{
+    AftFormatValue value;
+    value.codepoint = codepoint;
+    value.format = NULL;
+    value.type = AFT_FORMAT_TYPE_CODEPOINT;
+    return value;
+}
+
+AftFormatValue aft_format_value_from_double(double number, const AftDecimalFormat* format)
+{
+    AftFormatValue value;
+    value.double_value = number;
+    value.format = format;
+    value.type = AFT_FORMAT_TYPE_DOUBLE;
+    return value;
+}
+
+AftFormatValue aft_format_value_from_int64(int64_t number, const AftDecimalFormat* format)
+{
+    AftFormatValue value;
+    value.int64_value = number;
+    value.format = format;
+    value.type = AFT_FORMAT_TYPE_INT64;
+    return value;
+}
+
+AftFormatValue aft_format_value_from_slice(AftStringSlice slice)
+{
+    AftFormatValue value;
+    value.slice = slice;
+    value.format = NULL;
+    value.type = AFT_FORMAT_TYPE_SLICE;
+    return value;
+}
+
+AftFormatValue aft_format_value_from_uint64(uint64_t number, const AftDecimalFormat* format)
+{
+    AftFormatValue value;
+    value.uint64_value = number;
+    value.format = format;
+    value.type = AFT_FORMAT_TYPE_UINT64;
+    return value;
+}
+
+
+bool aft_string_append_double(AftString* string, double value, const AftDecimalFormat* format)
+{
+    AFT_ASSERT(string);
+
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+    int prior_count = aft_string_get_count(string);
+
+    write_double(&writer, value, format);
+
+    return format_writer_finish_string(&writer, prior_count);
+}
+
+bool aft_string_append_doubles(AftString* string, const double* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options)
+{
+    AFT_ASSERT(string);
+    AFT_ASSERT(values || count == 0);
+    AFT_ASSERT(count >= 0);
+
+    NumberBatch batch;
+    start_batch(&batch, format, options);
+    batch.values = values;
+    batch.type = AFT_FORMAT_TYPE_DOUBLE;
+
+    return append_batch(string, &batch, count, options);
+}
+
+bool aft_string_append_float(AftString* string, float value, const AftDecimalFormat* format)
+{
+    AFT_ASSERT(string);
+
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+    int prior_count = aft_string_get_count(string);
+
+    write_float(&writer, value, format);
+
+    return format_writer_finish_string(&writer, prior_count);
+}
+
+bool aft_string_append_format(AftString* string, const char* pattern, const AftFormatValue* values, int count)
+{
+    AFT_ASSERT(string);
+    AFT_ASSERT(pattern);
+    AFT_ASSERT(values || count == 0);
+
+    AftStringSlice pattern_slice = aft_string_slice_from_c_string(pattern);
+    int pattern_count = aft_string_slice_count(pattern_slice);
+    int prior_count = aft_string_get_count(string);
+    int estimate = pattern_count;
+
+    for(int value_index = 0; value_index < count; value_index += 1)
     {
-        value *= (double) format->percent.multiplier;
+        estimate += estimate_format_value_count(&values[value_index]);
     }
 
-    FloatFormat float_format;
-    float_format.rounding_mode = format->rounding_mode;
-
-    if(format->use_significant_digits)
+    if(!aft_string_reserve(string, prior_count + estimate))
     {
-        float_format.cutoff_mode = CUTOFF_MODE_SIGNIFICANT_DIGITS;
-        float_format.max_significant_digits = format->max_significant_digits;
-        float_format.min_significant_digits = format->min_significant_digits;
+        return false;
     }
-    else
+
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+
+    // Each {} is replaced by the next value and {n} by the value at index n.
+    // Doubled braces stand for a brace.
+    int literal_start = 0;
+    int next_value = 0;
+    int index = 0;
+
+    while(index < pattern_count)
     {
-        if(format->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+        char c = pattern[index];
+
+        if(c != '{' && c != '}')
         {
-            float_format.cutoff_mode = CUTOFF_MODE_SIGNIFICANT_DIGITS;
-            float_format.max_significant_digits = format->max_fraction_digits + 1;
-            float_format.min_significant_digits = format->min_fraction_digits + 1;
+            index += 1;
+            continue;
         }
-        else
+
+        format_writer_put_slice(&writer, aft_string_slice(pattern_slice, literal_start, index));
+
+        if(index + 1 < pattern_count && pattern[index + 1] == c)
         {
-            float_format.cutoff_mode = CUTOFF_MODE_FRACTION_DIGITS;
-            float_format.max_fraction_digits = format->max_fraction_digits;
-            float_format.min_fraction_digits = format->min_fraction_digits;
+            literal_start = index + 1;
+            index += 2;
+            continue;
         }
-    }
 
-    DecimalQuantity quantity = format_double(value, &float_format, allocator);
-    format_float_result(&result, &quantity, format);
+        if(c == '}')
+        {
+            writer.failed = true;
+            return format_writer_finish_string(&writer, prior_count);
+        }
 
-    aft_string_destroy(&quantity.digits);
+        int value_index = next_value;
+        bool has_index = false;
+        index += 1;
 
-    return result;
+        if(index < pattern_count && aft_ascii_is_numeric(pattern[index]))
+        {
+            value_index = 0;
+            has_index = true;
+        }
+
+        while(index < pattern_count && aft_ascii_is_numeric(pattern[index]) && value_index < count)
+        {
+            value_index = (10 * value_index) + (pattern[index] - '0');
+            index += 1;
+        }
+
+        if(index >= pattern_count || pattern[index] != '}' || value_index >= count)
+        {
+            writer.failed = true;
+            return format_writer_finish_string(&writer, prior_count);
+        }
+
+        write_format_value(&writer, &values[value_index]);
+
+        if(!has_index)
+        {
+            next_value += 1;
+        }
+
+        index += 1;
+        literal_start = index;
+    }
+
+    format_writer_put_slice(&writer, aft_string_slice(pattern_slice, literal_start, pattern_count));
+
+    return format_writer_finish_string(&writer, prior_count);
 }
 
-AftMaybeString aft_string_from_float(float value, const AftDecimalFormat* format)
+bool aft_string_append_int(AftString* string, int value, const AftDecimalFormat* format)
 {
-    return aft_string_from_double_with_allocator(value, format, NULL);
+    return aft_string_append_int64(string, value, format);
 }
 
-AftMaybeString aft_string_from_float_with_allocator(float value, const AftDecimalFormat* format, void* allocator)
+bool aft_string_append_int64(AftString* string, int64_t value, const AftDecimalFormat* format)
 {
-    AFT_ASSERT(aft_decimal_format_validate(format));
+    AFT_ASSERT(string);
+    AFT_ASSERT(format);
 
-    AftMaybeString result;
-    result.valid = true;
-    aft_string_initialise_with_allocator(&result.value, allocator);
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+    int prior_count = aft_string_get_count(string);
 
-    if(format->style == AFT_DECIMAL_FORMAT_STYLE_PERCENT)
-    {
-        value *= (float) format->percent.multiplier;
-    }
+    write_int64(&writer, value, format);
 
-    FloatFormat float_format;
-    float_format.rounding_mode = format->rounding_mode;
+    return format_writer_finish_string(&writer, prior_count);
+}
 
-    if(format->use_significant_digits)
+bool aft_string_append_int64_compiled(AftString* string, int64_t value, const AftCompiledDecimalFormat* compiled)
+{
+    bool sign = value < 0;
+    uint64_t magnitude = (uint64_t) value;
+    if(sign)
     {
-        float_format.cutoff_mode = CUTOFF_MODE_SIGNIFICANT_DIGITS;
-        float_format.max_significant_digits = format->max_significant_digits;
-        float_format.min_significant_digits = format->min_significant_digits;
+        magnitude = ~magnitude + 1;
     }
-    else
+
+    return append_compiled(string, magnitude, sign, compiled);
+}
+
+bool aft_string_append_int64s(AftString* string, const int64_t* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options)
+{
+    AFT_ASSERT(string);
+    AFT_ASSERT(values || count == 0);
+    AFT_ASSERT(count >= 0);
+
+    NumberBatch batch;
+    start_batch(&batch, format, options);
+    batch.values = values;
+    batch.type = AFT_FORMAT_TYPE_INT64;
+
+    AftCompiledDecimalFormat compiled;
+
+    if(format)
     {
-        if(format->style == AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC)
+        if(!aft_decimal_format_compile_with_allocator(&compiled, format, string->allocator))
         {
-            float_format.cutoff_mode = CUTOFF_MODE_SIGNIFICANT_DIGITS;
-            float_format.max_significant_digits = format->max_fraction_digits + 1;
-            float_format.min_significant_digits = format->min_fraction_digits + 1;
+            return false;
         }
-        else
+
+        if(can_append_compiled_fast(&compiled))
         {
-            float_format.cutoff_mode = CUTOFF_MODE_FRACTION_DIGITS;
-            float_format.max_fraction_digits = format->max_fraction_digits;
-            float_format.min_fraction_digits = format->min_fraction_digits;
+            batch.compiled = &compiled;
         }
     }
 
-    DecimalQuantity quantity = format_float(value, &float_format, allocator);
-    format_float_result(&result, &quantity, format);
+    bool appended = append_batch(string, &batch, count, options);
+
+    if(format)
+    {
+        aft_compiled_decimal_format_destroy(&compiled);
+    }
+
+    return appended;
+}
+
+bool aft_string_append_uint64(AftString* string, uint64_t value, const AftDecimalFormat* format)
+{
+    AFT_ASSERT(string);
+    AFT_ASSERT(format);
+
+    FormatWriter writer;
+    format_writer_start_string(&writer, string);
+    int prior_count = aft_string_get_count(string);
+
+    write_uint64_and_sign(&writer, value, false, format);
+
+    return format_writer_finish_string(&writer, prior_count);
+}
+
+bool aft_string_append_uint64_compiled(AftString* string, uint64_t value, const AftCompiledDecimalFormat* compiled)
+{
+    return append_compiled(string, value, false, compiled);
+}
+
+AftMaybeString aft_string_from_double(double value, const AftDecimalFormat* format)
+{
+    return aft_string_from_double_with_allocator(value, format, NULL);
+}
+
+AftMaybeString aft_string_from_double_with_allocator(double value, const AftDecimalFormat* format, void* allocator)
+{
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = aft_string_append_double(&result.value, value, format);
+    return result;
+}
+
+AftMaybeString aft_string_from_doubles(const double* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options)
+{
+    return aft_string_from_doubles_with_allocator(values, count, format, options, NULL);
+}
+
+AftMaybeString aft_string_from_doubles_with_allocator(const double* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options, void* allocator)
+{
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = aft_string_append_doubles(&result.value, values, count, format, options);
+    return result;
+}
 
-    aft_string_destroy(&quantity.digits);
+AftMaybeString aft_string_from_float(float value, const AftDecimalFormat* format)
+{
+    return aft_string_from_float_with_allocator(value, format, NULL);
+}
 
+AftMaybeString aft_string_from_float_with_allocator(float value, const AftDecimalFormat* format, void* allocator)
+{
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = aft_string_append_float(&result.value, value, format);
     return result;
 }
 
@@ -1375,13 +3084,23 @@ AftMaybeString aft_string_from_int64(int64_t value, const AftDecimalFormat* form
 
 AftMaybeString aft_string_from_int64_with_allocator(int64_t value, const AftDecimalFormat* format, void* allocator)
 {
-    bool sign = value < 0;
-    if(sign)
-    {
-        value = -value;
-    }
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = aft_string_append_int64(&result.value, value, format);
+    return result;
+}
+
+AftMaybeString aft_string_from_int64s(const int64_t* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options)
+{
+    return aft_string_from_int64s_with_allocator(values, count, format, options, NULL);
+}
 
-    return string_from_uint64_and_sign((uint64_t) value, sign, format, allocator);
+AftMaybeString aft_string_from_int64s_with_allocator(const int64_t* values, int count, const AftDecimalFormat* format, const AftBatchFormatOptions* options, void* allocator)
+{
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = aft_string_append_int64s(&result.value, values, count, format, options);
+    return result;
 }
 
 AftMaybeString aft_string_from_uint64(uint64_t value, const AftDecimalFormat* format)
@@ -1391,5 +3110,8 @@ AftMaybeString aft_string_from_uint64(uint64_t value, const AftDecimalFormat* fo
 
 AftMaybeString aft_string_from_uint64_with_allocator(uint64_t value, const AftDecimalFormat* format, void* allocator)
 {
-    return string_from_uint64_and_sign(value, false, format, allocator);
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = aft_string_append_uint64(&result.value, value, format);
+    return result;
 }
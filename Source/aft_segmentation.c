@@ -0,0 +1,538 @@
+#include <AftString/aft_unicode.h>
+
+#include "unicode_data.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+#define BREAK_PROPERTY_MASK 0x7f
+#define INVALID_CODEPOINT 0xffffffff
+
+
+// Grapheme clusters may only join an emoji to an earlier one by a zero width
+// joiner, with any number of extending marks before the joiner.
+typedef enum PictographicState
+{
+    PICTOGRAPHIC_STATE_NONE,
+    PICTOGRAPHIC_STATE_PICTOGRAPH,
+    PICTOGRAPHIC_STATE_JOINER,
+} PictographicState;
+
+
+// Word boundary rules look past extending marks, format characters and
+// joiners, so this holds the last two properties that weren't those.
+// The last raw property is kept too, for the rules that apply to
+// neighbours only.
+typedef struct WordContext
+{
+    int last;
+    int previous;
+    int before_previous;
+    int regional_indicator_count;
+} WordContext;
+
+
+// Decode the next codepoint, moving past it. Bytes that aren't valid UTF-8
+// are read one at a time as the invalid codepoint, which has no properties
+// and so is broken around like a control character.
+static char32_t read_codepoint(AftCodepointIterator* it)
+{
+    const char* contents = aft_string_slice_start(it->slice);
+    uint8_t byte = (uint8_t) contents[it->index];
+
+    if(byte < 0x80)
+    {
+        it->index += 1;
+        return byte;
+    }
+
+    AftMaybeChar32 codepoint = aft_codepoint_iterator_next(it);
+
+    if(!codepoint.valid)
+    {
+        it->index += 1;
+        return INVALID_CODEPOINT;
+    }
+
+    return codepoint.value;
+}
+
+static int get_grapheme_break(char32_t c)
+{
+    if(c == INVALID_CODEPOINT)
+    {
+        return GRAPHEME_BREAK_CONTROL;
+    }
+
+    return unicode_grapheme_break_lookup(c);
+}
+
+static int get_word_break(char32_t c)
+{
+    if(c == INVALID_CODEPOINT)
+    {
+        return WORD_BREAK_NEWLINE;
+    }
+
+    return unicode_word_break_lookup(c);
+}
+
+static bool is_grapheme_control(int property)
+{
+    return property == GRAPHEME_BREAK_CONTROL
+            || property == GRAPHEME_BREAK_CR
+            || property == GRAPHEME_BREAK_LF;
+}
+
+static bool is_grapheme_break(int left, int right, PictographicState state, int regional_indicator_count)
+{
+    int right_property = right & BREAK_PROPERTY_MASK;
+
+    if(left == GRAPHEME_BREAK_CR && right_property == GRAPHEME_BREAK_LF)
+    {
+        return false;
+    }
+
+    if(is_grapheme_control(left) || is_grapheme_control(right_property))
+    {
+        return true;
+    }
+
+    switch(left)
+    {
+        case GRAPHEME_BREAK_L:
+        {
+            if(right_property == GRAPHEME_BREAK_L
+                    || right_property == GRAPHEME_BREAK_V
+                    || right_property == GRAPHEME_BREAK_LV
+                    || right_property == GRAPHEME_BREAK_LVT)
+            {
+                return false;
+            }
+            break;
+        }
+        case GRAPHEME_BREAK_LV:
+        case GRAPHEME_BREAK_V:
+        {
+            if(right_property == GRAPHEME_BREAK_V || right_property == GRAPHEME_BREAK_T)
+            {
+                return false;
+            }
+            break;
+        }
+        case GRAPHEME_BREAK_LVT:
+        case GRAPHEME_BREAK_T:
+        {
+            if(right_property == GRAPHEME_BREAK_T)
+            {
+                return false;
+            }
+            break;
+        }
+        case GRAPHEME_BREAK_PREPEND:
+        {
+            return false;
+        }
+        case GRAPHEME_BREAK_REGIONAL_INDICATOR:
+        {
+            if(right_property == GRAPHEME_BREAK_REGIONAL_INDICATOR
+                    && regional_indicator_count % 2 == 1)
+            {
+                return false;
+            }
+            break;
+        }
+        case GRAPHEME_BREAK_ZWJ:
+        {
+            if((right & UNICODE_EXTENDED_PICTOGRAPHIC)
+                    && state == PICTOGRAPHIC_STATE_JOINER)
+            {
+                return false;
+            }
+            break;
+        }
+    }
+
+    return right_property != GRAPHEME_BREAK_EXTEND
+            && right_property != GRAPHEME_BREAK_ZWJ
+            && right_property != GRAPHEME_BREAK_SPACING_MARK;
+}
+
+static PictographicState next_pictographic_state(PictographicState state, int property)
+{
+    if(property & UNICODE_EXTENDED_PICTOGRAPHIC)
+    {
+        return PICTOGRAPHIC_STATE_PICTOGRAPH;
+    }
+
+    if(state == PICTOGRAPHIC_STATE_PICTOGRAPH)
+    {
+        switch(property)
+        {
+            case GRAPHEME_BREAK_EXTEND: return PICTOGRAPHIC_STATE_PICTOGRAPH;
+            case GRAPHEME_BREAK_ZWJ:    return PICTOGRAPHIC_STATE_JOINER;
+        }
+    }
+
+    return PICTOGRAPHIC_STATE_NONE;
+}
+
+static bool is_ah_letter(int property)
+{
+    return property == WORD_BREAK_ALETTER || property == WORD_BREAK_HEBREW_LETTER;
+}
+
+static bool is_ignored_in_words(int property)
+{
+    return property == WORD_BREAK_EXTEND
+            || property == WORD_BREAK_FORMAT
+            || property == WORD_BREAK_ZWJ;
+}
+
+static bool is_mid_letter(int property)
+{
+    return property == WORD_BREAK_MID_LETTER
+            || property == WORD_BREAK_MID_NUM_LET
+            || property == WORD_BREAK_SINGLE_QUOTE;
+}
+
+static bool is_mid_num(int property)
+{
+    return property == WORD_BREAK_MID_NUM
+            || property == WORD_BREAK_MID_NUM_LET
+            || property == WORD_BREAK_SINGLE_QUOTE;
+}
+
+static bool is_newline(int property)
+{
+    return property == WORD_BREAK_CR
+            || property == WORD_BREAK_LF
+            || property == WORD_BREAK_NEWLINE;
+}
+
+// ASCII letters, digits and underscores always join each other in a word,
+// whatever came before them.
+static bool is_word_ascii(char c)
+{
+    return (c >= 'a' && c <= 'z')
+            || (c >= 'A' && c <= 'Z')
+            || (c >= '0' && c <= '9')
+            || c == '_';
+}
+
+// Find the property of the next codepoint that isn't ignored by the word
+// boundary rules.
+static int look_ahead_word(AftCodepointIterator it)
+{
+    while(it.index < it.end)
+    {
+        int property = get_word_break(read_codepoint(&it)) & BREAK_PROPERTY_MASK;
+
+        if(!is_ignored_in_words(property))
+        {
+            return property;
+        }
+    }
+
+    return WORD_BREAK_OTHER;
+}
+
+static bool is_word_break(const WordContext* context, int right, const AftCodepointIterator* after)
+{
+    int last = context->last & BREAK_PROPERTY_MASK;
+    int right_property = right & BREAK_PROPERTY_MASK;
+
+    if(last == WORD_BREAK_CR && right_property == WORD_BREAK_LF)
+    {
+        return false;
+    }
+
+    if(is_newline(last) || is_newline(right_property))
+    {
+        return true;
+    }
+
+    if((last == WORD_BREAK_ZWJ && (right & UNICODE_EXTENDED_PICTOGRAPHIC))
+            || (last == WORD_BREAK_WSEG_SPACE && right_property == WORD_BREAK_WSEG_SPACE)
+            || is_ignored_in_words(right_property))
+    {
+        return false;
+    }
+
+    int previous = context->previous;
+    int before_previous = context->before_previous;
+
+    if(is_ah_letter(previous))
+    {
+        if(is_ah_letter(right_property)
+                || right_property == WORD_BREAK_NUMERIC
+                || right_property == WORD_BREAK_EXTEND_NUM_LET)
+        {
+            return false;
+        }
+
+        if(is_mid_letter(right_property) && is_ah_letter(look_ahead_word(*after)))
+        {
+            return false;
+        }
+    }
+
+    if(is_ah_letter(before_previous) && is_mid_letter(previous) && is_ah_letter(right_property))
+    {
+        return false;
+    }
+
+    if(previous == WORD_BREAK_HEBREW_LETTER)
+    {
+        if(right_property == WORD_BREAK_SINGLE_QUOTE)
+        {
+            return false;
+        }
+
+        if(right_property == WORD_BREAK_DOUBLE_QUOTE
+                && look_ahead_word(*after) == WORD_BREAK_HEBREW_LETTER)
+        {
+            return false;
+        }
+    }
+
+    if(before_previous == WORD_BREAK_HEBREW_LETTER
+            && previous == WORD_BREAK_DOUBLE_QUOTE
+            && right_property == WORD_BREAK_HEBREW_LETTER)
+    {
+        return false;
+    }
+
+    if(previous == WORD_BREAK_NUMERIC)
+    {
+        if(is_ah_letter(right_property)
+                || right_property == WORD_BREAK_NUMERIC
+                || right_property == WORD_BREAK_EXTEND_NUM_LET)
+        {
+            return false;
+        }
+
+        if(is_mid_num(right_property) && look_ahead_word(*after) == WORD_BREAK_NUMERIC)
+        {
+            return false;
+        }
+    }
+
+    if(before_previous == WORD_BREAK_NUMERIC
+            && is_mid_num(previous)
+            && right_property == WORD_BREAK_NUMERIC)
+    {
+        return false;
+    }
+
+    if(previous == WORD_BREAK_KATAKANA
+            && (right_property == WORD_BREAK_KATAKANA
+                    || right_property == WORD_BREAK_EXTEND_NUM_LET))
+    {
+        return false;
+    }
+
+    if(previous == WORD_BREAK_EXTEND_NUM_LET
+            && (is_ah_letter(right_property)
+                    || right_property == WORD_BREAK_NUMERIC
+                    || right_property == WORD_BREAK_KATAKANA
+                    || right_property == WORD_BREAK_EXTEND_NUM_LET))
+    {
+        return false;
+    }
+
+    if(previous == WORD_BREAK_REGIONAL_INDICATOR
+            && right_property == WORD_BREAK_REGIONAL_INDICATOR
+            && context->regional_indicator_count % 2 == 1)
+    {
+        return false;
+    }
+
+    return true;
+}
+
+static void word_context_push(WordContext* context, int property)
+{
+    int last = context->last & BREAK_PROPERTY_MASK;
+    int property_value = property & BREAK_PROPERTY_MASK;
+
+    context->last = property;
+
+    // Ignored characters take on the property of what came before them,
+    // unless that was the start of the text or a newline.
+    if(is_ignored_in_words(property_value) && !is_newline(last))
+    {
+        return;
+    }
+
+    context->before_previous = context->previous;
+    context->previous = property_value;
+
+    if(property_value == WORD_BREAK_REGIONAL_INDICATOR)
+    {
+        context->regional_indicator_count += 1;
+    }
+    else
+    {
+        context->regional_indicator_count = 0;
+    }
+}
+
+
+AftMaybeStringSlice aft_grapheme_iterator_next(AftGraphemeIterator* it)
+{
+    AFT_ASSERT(it);
+
+    int start = it->index;
+    int count = aft_string_slice_count(it->slice);
+
+    if(start >= count)
+    {
+        AftMaybeStringSlice result = {{NULL, 0}, false};
+        return result;
+    }
+
+    const char* contents = aft_string_slice_start(it->slice);
+    uint8_t byte = (uint8_t) contents[start];
+
+    // An ASCII character followed by another ASCII character is a cluster
+    // by itself, except for a CRLF pair.
+    if(byte < 0x80 && (start + 1 == count || (uint8_t) contents[start + 1] < 0x80))
+    {
+        int end = start + 1;
+
+        if(byte == '\r' && end < count && contents[end] == '\n')
+        {
+            end += 1;
+        }
+
+        it->index = end;
+
+        AftMaybeStringSlice result = {aft_string_slice(it->slice, start, end), true};
+        return result;
+    }
+
+    AftCodepointIterator codepoints;
+    aft_codepoint_iterator_set_string(&codepoints, it->slice);
+    codepoints.index = start;
+
+    int left = get_grapheme_break(read_codepoint(&codepoints));
+    PictographicState state = next_pictographic_state(PICTOGRAPHIC_STATE_NONE, left);
+    left &= BREAK_PROPERTY_MASK;
+    int regional_indicator_count = left == GRAPHEME_BREAK_REGIONAL_INDICATOR;
+
+    while(codepoints.index < count)
+    {
+        int end = codepoints.index;
+        int right = get_grapheme_break(read_codepoint(&codepoints));
+
+        if(is_grapheme_break(left, right, state, regional_indicator_count))
+        {
+            codepoints.index = end;
+            break;
+        }
+
+        state = next_pictographic_state(state, right);
+        left = right & BREAK_PROPERTY_MASK;
+
+        if(left == GRAPHEME_BREAK_REGIONAL_INDICATOR)
+        {
+            regional_indicator_count += 1;
+        }
+        else
+        {
+            regional_indicator_count = 0;
+        }
+    }
+
+    it->index = codepoints.index;
+
+    AftMaybeStringSlice result = {aft_string_slice(it->slice, start, it->index), true};
+    return result;
+}
+
+void aft_grapheme_iterator_set_string(AftGraphemeIterator* it, AftStringSlice slice)
+{
+    AFT_ASSERT(it);
+
+    it->slice = slice;
+    it->index = 0;
+}
+
+
+AftMaybeStringSlice aft_word_iterator_next(AftWordIterator* it)
+{
+    AFT_ASSERT(it);
+
+    int start = it->index;
+    int count = aft_string_slice_count(it->slice);
+
+    if(start >= count)
+    {
+        AftMaybeStringSlice result = {{NULL, 0}, false};
+        return result;
+    }
+
+    const char* contents = aft_string_slice_start(it->slice);
+
+    AftCodepointIterator codepoints;
+    aft_codepoint_iterator_set_string(&codepoints, it->slice);
+    codepoints.index = start;
+
+    // The start of the text is treated like a newline, so that the first
+    // character isn't ignored.
+    WordContext context;
+    context.last = WORD_BREAK_NEWLINE;
+    context.previous = WORD_BREAK_OTHER;
+    context.before_previous = WORD_BREAK_OTHER;
+    context.regional_indicator_count = 0;
+
+    word_context_push(&context, get_word_break(read_codepoint(&codepoints)));
+
+    while(codepoints.index < count)
+    {
+        int end = codepoints.index;
+
+        if(is_word_ascii(contents[end - 1]) && is_word_ascii(contents[end]))
+        {
+            while(end + 1 < count && is_word_ascii(contents[end + 1]))
+            {
+                end += 1;
+            }
+
+            codepoints.index = end + 1;
+            context.last = unicode_word_break_lookup(contents[end]);
+            context.previous = context.last;
+            context.before_previous = unicode_word_break_lookup(contents[end - 1]);
+            context.regional_indicator_count = 0;
+            continue;
+        }
+
+        int right = get_word_break(read_codepoint(&codepoints));
+
+        if(is_word_break(&context, right, &codepoints))
+        {
+            codepoints.index = end;
+            break;
+        }
+
+        word_context_push(&context, right);
+    }
+
+    it->index = codepoints.index;
+
+    AftMaybeStringSlice result = {aft_string_slice(it->slice, start, it->index), true};
+    return result;
+}
+
+void aft_word_iterator_set_string(AftWordIterator* it, AftStringSlice slice)
+{
+    AFT_ASSERT(it);
+
+    it->slice = slice;
+    it->index = 0;
+}
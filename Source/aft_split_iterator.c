@@ -0,0 +1,185 @@
+#include <AftString/aft_string.h>
+
+#include "byte_set.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+
+static bool memory_matches(const char* a, const char* b, int n)
+{
+    for(int byte_index = 0; byte_index < n; byte_index += 1)
+    {
+        if(a[byte_index] != b[byte_index])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void start(AftSplitIterator* it, AftStringSlice slice, const AftSplitOptions* options)
+{
+    it->slice = slice;
+    it->mask = 0;
+    it->index = 0;
+    it->mask_start = -BYTE_SET_BLOCK_SIZE;
+    it->done = false;
+    it->skip_empty = false;
+    it->trim_whitespace = false;
+
+    if(options)
+    {
+        it->skip_empty = options->skip_empty;
+        it->trim_whitespace = options->trim_whitespace;
+    }
+}
+
+static AftMaybeInt find_delimiter_byte(AftSplitIterator* it, int from)
+{
+    return byte_set_find(&it->delimiter_set, it->slice, from, &it->mask, &it->mask_start);
+}
+
+// For a delimiter string, the mask marks where its first byte appears, and
+// each of those candidates is checked for the rest of the string.
+static AftMaybeInt find_delimiter(AftSplitIterator* it, int from)
+{
+    int delimiter_count = aft_string_slice_count(it->delimiter);
+
+    if(delimiter_count <= 1)
+    {
+        return find_delimiter_byte(it, from);
+    }
+
+    const char* contents = aft_string_slice_start(it->slice);
+    const char* delimiter = aft_string_slice_start(it->delimiter);
+    int search_end = aft_string_slice_count(it->slice) - delimiter_count;
+
+    for(;;)
+    {
+        AftMaybeInt candidate = find_delimiter_byte(it, from);
+
+        if(!candidate.valid || candidate.value > search_end)
+        {
+            AftMaybeInt result = {0, false};
+            return result;
+        }
+
+        if(memory_matches(&contents[candidate.value + 1], &delimiter[1], delimiter_count - 1))
+        {
+            return candidate;
+        }
+
+        from = candidate.value + 1;
+    }
+}
+
+static AftStringSlice trim_whitespace(AftStringSlice slice)
+{
+    const char* contents = aft_string_slice_start(slice);
+    int start = 0;
+    int end = aft_string_slice_count(slice);
+
+    while(start < end && aft_ascii_is_whitespace(contents[start]))
+    {
+        start += 1;
+    }
+
+    while(end > start && aft_ascii_is_whitespace(contents[end - 1]))
+    {
+        end -= 1;
+    }
+
+    return aft_string_slice(slice, start, end);
+}
+
+
+AftMaybeStringSlice aft_split_iterator_next(AftSplitIterator* it)
+{
+    AFT_ASSERT(it);
+
+    int delimiter_count = aft_string_slice_count(it->delimiter);
+    if(delimiter_count < 1)
+    {
+        delimiter_count = 1;
+    }
+
+    while(!it->done)
+    {
+        int token_start = it->index;
+        AftMaybeInt delimiter = find_delimiter(it, token_start);
+        int token_end;
+
+        if(delimiter.valid)
+        {
+            token_end = delimiter.value;
+            it->index = token_end + delimiter_count;
+        }
+        else
+        {
+            token_end = aft_string_slice_count(it->slice);
+            it->index = token_end;
+            it->done = true;
+        }
+
+        AftStringSlice token = aft_string_slice(it->slice, token_start, token_end);
+
+        if(it->trim_whitespace)
+        {
+            token = trim_whitespace(token);
+        }
+
+        if(!it->skip_empty || aft_string_slice_count(token) > 0)
+        {
+            AftMaybeStringSlice result = {token, true};
+            return result;
+        }
+    }
+
+    AftMaybeStringSlice result = {{NULL, 0}, false};
+    return result;
+}
+
+void aft_split_iterator_set_delimiter_byte(AftSplitIterator* it, AftStringSlice slice, char delimiter, const AftSplitOptions* options)
+{
+    AFT_ASSERT(it);
+
+    start(it, slice, options);
+    it->delimiter = aft_string_slice_from_buffer(NULL, 0);
+    byte_set_clear(&it->delimiter_set);
+    byte_set_add(&it->delimiter_set, delimiter);
+}
+
+void aft_split_iterator_set_delimiter_byte_set(AftSplitIterator* it, AftStringSlice slice, AftStringSlice delimiters, const AftSplitOptions* options)
+{
+    AFT_ASSERT(it);
+    AFT_ASSERT(aft_string_slice_count(delimiters) > 0);
+
+    start(it, slice, options);
+    it->delimiter = aft_string_slice_from_buffer(NULL, 0);
+    byte_set_clear(&it->delimiter_set);
+
+    const char* contents = aft_string_slice_start(delimiters);
+    int count = aft_string_slice_count(delimiters);
+
+    for(int char_index = 0; char_index < count; char_index += 1)
+    {
+        byte_set_add(&it->delimiter_set, contents[char_index]);
+    }
+}
+
+void aft_split_iterator_set_delimiter_string(AftSplitIterator* it, AftStringSlice slice, AftStringSlice delimiter, const AftSplitOptions* options)
+{
+    AFT_ASSERT(it);
+    AFT_ASSERT(aft_string_slice_count(delimiter) > 0);
+
+    start(it, slice, options);
+    it->delimiter = delimiter;
+    byte_set_clear(&it->delimiter_set);
+    byte_set_add(&it->delimiter_set, aft_string_slice_start(delimiter)[0]);
+}
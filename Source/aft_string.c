@@ -1,13 +1,30 @@
 #include <AftString/aft_string.h>
 
 #include "aft_string_config.h"
+#include "byte_set.h"
 
 #include <assert.h>
+#include <limits.h>
 #include <stddef.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
 
 #define AFT_ASSERT(expression) \
     assert(expression)
 
+#define AFT_STRING_HANDLE_PREFIX_BYTES 4
+
+#define UTF16_HIGH_SURROGATE 0xd800
+#define UTF16_LOW_SURROGATE 0xdc00
+#define UTF16_SURROGATE_MASK 0xfc00
+
+#define CODE_PAGE_REPLACEMENT '?'
+#define UTF8_REPLACEMENT "\xef\xbf\xbd"
+
 
 #if !defined(AFT_USE_CUSTOM_ALLOCATOR) || AFT_USE_CUSTOM_ALLOCATOR == 0
 
@@ -74,6 +91,16 @@ static const uint8_t utf8_decode_type_table[] =
     11, 6, 6, 6, 5, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
 };
 
+// The codepoints of Windows-1252 bytes 0x80 to 0x9f. The five bytes it leaves
+// undefined map to the C1 controls, as in Latin-1, so any byte decodes.
+static const uint16_t windows_1252_high_codepoints[32] =
+{
+    0x20ac, 0x0081, 0x201a, 0x0192, 0x201e, 0x2026, 0x2020, 0x2021,
+    0x02c6, 0x2030, 0x0160, 0x2039, 0x0152, 0x008d, 0x017d, 0x008f,
+    0x0090, 0x2018, 0x2019, 0x201c, 0x201d, 0x2022, 0x2013, 0x2014,
+    0x02dc, 0x2122, 0x0161, 0x203a, 0x0153, 0x009d, 0x017e, 0x0178,
+};
+
 
 static bool aft_string_check_uncorrupted(const AftString* string)
 {
@@ -98,7 +125,7 @@ static void aft_string_set_count(AftString* string, int count)
     }
     else
     {
-        string->small.bytes_left = (char) (AFT_STRING_SMALL_CAP - count);
+        string->small.bytes_left = (char) (AFT_STRING_SMALL_CAP - 1 - count);
     }
 }
 
@@ -110,34 +137,247 @@ static void aft_string_set_uncorrupted(AftString* string)
 #endif // defined(AFT_CHECK_CORRUPTION)
 }
 
+// The ranges can overlap, such as when removing or inserting within a string.
 static void copy_memory(void* to, const void* from, uint64_t bytes)
 {
-    const uint8_t* p0 = from;
-    uint8_t* p1 = to;
+    memmove(to, from, (size_t) bytes);
+}
+
+// Decode the codepoint starting at the given index, stopping at the end
+// index. This returns the index after the codepoint, or -1 if the bytes
+// there aren't valid UTF-8.
+static int decode_codepoint(const char* contents, int index, int end, char32_t* codepoint)
+{
+    uint32_t state = 0;
+    uint32_t result = 0;
 
-    if(p0 < p1)
+    for(int byte_index = index; byte_index < end; byte_index += 1)
     {
-        for(p0 += bytes, p1 += bytes; bytes; bytes -= 1)
+        uint32_t byte = (uint8_t) contents[byte_index];
+        uint32_t type = utf8_decode_type_table[byte];
+
+        if(state)
+        {
+            result = (byte & 0x3fu) | (result << 6);
+        }
+        else
+        {
+            result = (0xff >> type) & byte;
+        }
+
+        state = utf8_decode_state_table[(16 * state) + type];
+
+        if(!state)
+        {
+            *codepoint = result;
+            return byte_index + 1;
+        }
+        else if(state == 1)
         {
-            p0 -= 1;
-            p1 -= 1;
-            *p1 = *p0;
+            break;
         }
     }
-    else
+
+    return -1;
+}
+
+static char32_t decode_code_page_byte(uint8_t byte, AftCodePage code_page)
+{
+    if(code_page == AFT_CODE_PAGE_WINDOWS_1252 && byte >= 0x80 && byte < 0xa0)
+    {
+        return windows_1252_high_codepoints[byte - 0x80];
+    }
+
+    return byte;
+}
+
+// Find the byte for a codepoint in a code page, or -1 if it has none.
+static int encode_code_page_codepoint(char32_t codepoint, AftCodePage code_page)
+{
+    if(codepoint < 0x80)
+    {
+        return (int) codepoint;
+    }
+
+    if(code_page == AFT_CODE_PAGE_LATIN_1)
+    {
+        return (codepoint < 0x100) ? (int) codepoint : -1;
+    }
+
+    if(codepoint >= 0xa0 && codepoint < 0x100)
+    {
+        return (int) codepoint;
+    }
+
+    for(int index = 0; index < 32; index += 1)
+    {
+        if(windows_1252_high_codepoints[index] == codepoint)
+        {
+            return 0x80 + index;
+        }
+    }
+
+    return -1;
+}
+
+// Write the UTF-8 encoding of a codepoint and return its byte count, or 0 if
+// it's past the end of the codespace.
+static int encode_codepoint(char32_t codepoint, char* bytes)
+{
+    if(codepoint < 0x80)
+    {
+        bytes[0] = (char) codepoint;
+        return 1;
+    }
+    else if(codepoint < 0x800)
+    {
+        bytes[0] = (char) ((codepoint >> 6) | 0xc0);
+        bytes[1] = (char) ((codepoint & 0x3f) | 0x80);
+        return 2;
+    }
+    else if(codepoint < 0x10000)
+    {
+        bytes[0] = (char) ((codepoint >> 12) | 0xe0);
+        bytes[1] = (char) (((codepoint >> 6) & 0x3f) | 0x80);
+        bytes[2] = (char) ((codepoint & 0x3f) | 0x80);
+        return 3;
+    }
+    else if(codepoint < 0x110000)
     {
-        for(; bytes; bytes -= 1, p0 +=1, p1 += 1)
+        bytes[0] = (char) ((codepoint >> 18) | 0xf0);
+        bytes[1] = (char) (((codepoint >> 12) & 0x3f) | 0x80);
+        bytes[2] = (char) (((codepoint >> 6) & 0x3f) | 0x80);
+        bytes[3] = (char) ((codepoint & 0x3f) | 0x80);
+        return 4;
+    }
+
+    return 0;
+}
+
+// Find the start of the first sequence at or after the given index that isn't
+// valid UTF-8, or the count if they all are. ASCII is skipped a block at a
+// time, since it's valid wherever a sequence can start.
+static int find_invalid_utf8(const char* contents, int index, int count)
+{
+    const uint8_t* bytes = (const uint8_t*) contents;
+    uint32_t state = 0;
+    int sequence_start = index;
+
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        if(state == 0 && count - index >= 16)
+        {
+            __m128i block = _mm_loadu_si128((const __m128i*) &bytes[index]);
+            uint64_t high = (uint16_t) _mm_movemask_epi8(block);
+
+            if(!high)
+            {
+                index += 16;
+                continue;
+            }
+
+            index += count_trailing_zeros64(high);
+        }
+#endif // defined(USE_SSE2)
+
+        if(state == 0)
+        {
+            sequence_start = index;
+        }
+
+        uint32_t type = utf8_decode_type_table[bytes[index]];
+        state = utf8_decode_state_table[(16 * state) + type];
+
+        if(state == 1)
+        {
+            return sequence_start;
+        }
+
+        index += 1;
+    }
+
+    return (state == 0) ? count : sequence_start;
+}
+
+// Measure the maximal subpart at an invalid sequence. That's the longest
+// start of a valid sequence there, or the one byte if none is.
+static int get_maximal_subpart_count(const char* contents, int index, int count)
+{
+    uint32_t state = 0;
+
+    for(int byte_index = index; byte_index < count; byte_index += 1)
+    {
+        uint32_t type = utf8_decode_type_table[(uint8_t) contents[byte_index]];
+        state = utf8_decode_state_table[(16 * state) + type];
+
+        if(state == 1)
         {
-            *p1 = *p0;
+            return (byte_index > index) ? byte_index - index : 1;
         }
     }
+
+    return count - index;
+}
+
+#if defined(USE_SSE2)
+
+// Widen 16 ASCII bytes to codepoints.
+static void store_ascii_block(__m128i bytes, char32_t* codepoints)
+{
+    const __m128i zero = _mm_setzero_si128();
+    __m128i low = _mm_unpacklo_epi8(bytes, zero);
+    __m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+    _mm_storeu_si128((__m128i*) &codepoints[0], _mm_unpacklo_epi16(low, zero));
+    _mm_storeu_si128((__m128i*) &codepoints[4], _mm_unpackhi_epi16(low, zero));
+    _mm_storeu_si128((__m128i*) &codepoints[8], _mm_unpacklo_epi16(high, zero));
+    _mm_storeu_si128((__m128i*) &codepoints[12], _mm_unpackhi_epi16(high, zero));
+}
+
+// Load 8 UTF-16 code units in the given byte order. SSE2 is only on
+// little-endian machines, so big-endian units are the ones to swap.
+static __m128i load_utf16_block(const char16_t* units, AftByteOrder byte_order)
+{
+    __m128i block = _mm_loadu_si128((const __m128i*) units);
+
+    if(byte_order == AFT_BYTE_ORDER_BIG_ENDIAN)
+    {
+        block = _mm_or_si128(_mm_slli_epi16(block, 8), _mm_srli_epi16(block, 8));
+    }
+
+    return block;
+}
+
+// Widen 16 ASCII bytes to UTF-16 code units in the given byte order.
+static void store_utf16_ascii_block(__m128i bytes, char16_t* units, AftByteOrder byte_order)
+{
+    const __m128i zero = _mm_setzero_si128();
+
+    if(byte_order == AFT_BYTE_ORDER_BIG_ENDIAN)
+    {
+        _mm_storeu_si128((__m128i*) &units[0], _mm_unpacklo_epi8(zero, bytes));
+        _mm_storeu_si128((__m128i*) &units[8], _mm_unpackhi_epi8(zero, bytes));
+    }
+    else
+    {
+        _mm_storeu_si128((__m128i*) &units[0], _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128((__m128i*) &units[8], _mm_unpackhi_epi8(bytes, zero));
+    }
 }
 
+#endif // defined(USE_SSE2)
+
 static int int_max(int a, int b)
 {
     return (a > b) ? a : b;
 }
 
+static int int_min(int a, int b)
+{
+    return (a < b) ? a : b;
+}
+
 static bool is_heading_byte(char c)
 {
     return (c & 0xc0) != 0x80;
@@ -167,6 +407,67 @@ static bool memory_matches(const void* a, const void* b, int n)
     return true;
 }
 
+static uint64_t load_uint64_little_endian(const char* bytes)
+{
+    const uint8_t* p = (const uint8_t*) bytes;
+
+    return (uint64_t) p[0]
+            | ((uint64_t) p[1] << 8)
+            | ((uint64_t) p[2] << 16)
+            | ((uint64_t) p[3] << 24)
+            | ((uint64_t) p[4] << 32)
+            | ((uint64_t) p[5] << 40)
+            | ((uint64_t) p[6] << 48)
+            | ((uint64_t) p[7] << 56);
+}
+
+static char16_t load_utf16_unit(const char16_t* units, int index, AftByteOrder byte_order)
+{
+    const uint8_t* bytes = (const uint8_t*) &units[index];
+
+    if(byte_order == AFT_BYTE_ORDER_BIG_ENDIAN)
+    {
+        return (char16_t) ((bytes[0] << 8) | bytes[1]);
+    }
+
+    return (char16_t) (bytes[0] | (bytes[1] << 8));
+}
+
+static uint64_t mix_hash(uint64_t hash, uint64_t value)
+{
+    hash ^= value;
+    hash *= UINT64_C(0x9e3779b97f4a7c15);
+    return hash ^ (hash >> 32);
+}
+
+static void store_utf16_unit(char16_t* units, int index, char16_t unit, AftByteOrder byte_order)
+{
+    uint8_t* bytes = (uint8_t*) &units[index];
+
+    if(byte_order == AFT_BYTE_ORDER_BIG_ENDIAN)
+    {
+        bytes[0] = (uint8_t) (unit >> 8);
+        bytes[1] = (uint8_t) unit;
+    }
+    else
+    {
+        bytes[0] = (uint8_t) unit;
+        bytes[1] = (uint8_t) (unit >> 8);
+    }
+}
+
+// Find where a slice of a string starts after the string's contents have
+// moved, or leave it alone if it isn't part of that string.
+static const char* rebase_slice_start(const char* start, const char* before, int before_count, const char* after)
+{
+    if(start >= before && start < before + before_count)
+    {
+        return after + (start - before);
+    }
+
+    return start;
+}
+
 static int string_size(const char* string)
 {
     if(string)
@@ -282,7 +583,7 @@ bool aft_ascii_is_uppercase(char c)
 
 bool aft_ascii_is_whitespace(char c)
 {
-    return c == ' ' || c - 9 <= 5;
+    return c == ' ' || (c >= '\t' && c <= '\r');
 }
 
 void aft_ascii_reverse(AftString* string)
@@ -398,6 +699,109 @@ bool aft_c_string_deallocate_with_allocator(void* allocator, char* string)
 }
 
 
+bool aft_code_page_append_utf8(AftString* encoded, AftStringSlice utf8, AftCodePage code_page, AftConversion conversion)
+{
+    AFT_ASSERT(encoded);
+    AFT_ASSERT(aft_string_check_uncorrupted(encoded));
+
+    const char* contents = aft_string_slice_start(utf8);
+    int count = aft_string_slice_count(utf8);
+
+    // Each codepoint becomes one byte, and there's one codepoint for every
+    // byte that isn't a continuation byte. That's an overcount for invalid
+    // text, but that fails anyway.
+    int encoded_count = 0;
+    int index = 0;
+
+#if defined(USE_SSE2)
+    for(; count - index >= 16; index += 16)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i*) &contents[index]);
+        __m128i starts = _mm_cmpgt_epi8(block, _mm_set1_epi8(-65));
+        encoded_count += count_set_bits64((uint16_t) _mm_movemask_epi8(starts));
+    }
+#endif // defined(USE_SSE2)
+
+    for(; index < count; index += 1)
+    {
+        encoded_count += is_heading_byte(contents[index]);
+    }
+
+    int prior_count = aft_string_get_count(encoded);
+
+    if(!aft_string_reserve(encoded, prior_count + encoded_count))
+    {
+        return false;
+    }
+
+    char* bytes = aft_string_get_contents(encoded);
+    int end = prior_count + encoded_count;
+    int byte_index = prior_count;
+    index = 0;
+
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        if(count - index >= 16 && end - byte_index >= 16)
+        {
+            __m128i block = _mm_loadu_si128((const __m128i*) &contents[index]);
+            uint64_t high = (uint16_t) _mm_movemask_epi8(block);
+            int ascii_count = high ? count_trailing_zeros64(high) : 16;
+
+            _mm_storeu_si128((__m128i*) &bytes[byte_index], block);
+            byte_index += ascii_count;
+            index += ascii_count;
+
+            if(ascii_count == 16)
+            {
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        char32_t codepoint;
+        int next;
+        uint8_t lead = (uint8_t) contents[index];
+
+        // U+0080 to U+00FF are the likeliest codepoints, so skip decoding
+        // them in full.
+        if((lead == 0xc2 || lead == 0xc3)
+                && count - index >= 2
+                && (contents[index + 1] & 0xc0) == 0x80)
+        {
+            codepoint = ((lead & 0x1f) << 6) | (contents[index + 1] & 0x3f);
+            next = index + 2;
+        }
+        else
+        {
+            next = decode_codepoint(contents, index, count, &codepoint);
+        }
+
+        int byte = (next == -1) ? -1 : encode_code_page_codepoint(codepoint, code_page);
+
+        if(byte == -1 && next != -1 && conversion == AFT_CONVERSION_LOSSY)
+        {
+            byte = CODE_PAGE_REPLACEMENT;
+        }
+
+        if(byte == -1)
+        {
+            bytes[prior_count] = '\0';
+            return false;
+        }
+
+        bytes[byte_index] = (char) byte;
+        byte_index += 1;
+        index = next;
+    }
+
+    bytes[byte_index] = '\0';
+    aft_string_set_count(encoded, byte_index);
+
+    return true;
+}
+
+
 bool aft_string_add(AftString* to, AftStringSlice from, int index)
 {
     int to_count = aft_string_get_count(to);
@@ -498,75 +902,171 @@ bool aft_string_append_char(AftString* to, char from)
     return true;
 }
 
-bool aft_string_append_slice(AftString* to, AftStringSlice from)
+bool aft_string_append_many(AftString* to, const AftStringSlice* slices, int count)
 {
     AFT_ASSERT(to);
+    AFT_ASSERT(slices || count == 0);
+    AFT_ASSERT(count >= 0);
 
     const char* to_contents_before_reserve = aft_string_get_contents_const(to);
-    bool self_append = aft_string_slice_in_string(from, to);
+    int prior_count = aft_string_get_count(to);
+    int total = prior_count;
 
-    int to_count = aft_string_get_count(to);
-    int from_count = aft_string_slice_count(from);
-    int count = to_count + from_count;
-    bool reserved = aft_string_reserve(to, count);
+    for(int slice_index = 0; slice_index < count; slice_index += 1)
+    {
+        int slice_count = aft_string_slice_count(slices[slice_index]);
 
-    if(!reserved)
+        if(slice_count > INT_MAX - total)
+        {
+            return false;
+        }
+
+        total += slice_count;
+    }
+
+    if(!aft_string_reserve(to, total))
     {
         return false;
     }
 
-    int prior_count = to_count;
-    aft_string_set_count(to, count);
     char* to_contents = aft_string_get_contents(to);
+    int index = prior_count;
 
-    const char* from_contents = aft_string_slice_start(from);
-    if(self_append)
+    for(int slice_index = 0; slice_index < count; slice_index += 1)
     {
-        ptrdiff_t start_index = from_contents - to_contents_before_reserve;
-        from_contents = to_contents + start_index;
+        AftStringSlice slice = slices[slice_index];
+        const char* from_contents = rebase_slice_start(aft_string_slice_start(slice),
+                to_contents_before_reserve, prior_count, to_contents);
+        int from_count = aft_string_slice_count(slice);
+
+        copy_memory(&to_contents[index], from_contents, from_count);
+        index += from_count;
     }
 
-    copy_memory(&to_contents[prior_count], from_contents, from_count);
-    to_contents[count] = '\0';
+    to_contents[total] = '\0';
+    aft_string_set_count(to, total);
 
     AFT_ASSERT(aft_string_check_uncorrupted(to));
 
     return true;
 }
 
-bool aft_string_assign(AftString* to, const AftString* from)
+bool aft_string_append_repeated(AftString* to, AftStringSlice from, int repeats)
 {
     AFT_ASSERT(to);
-    AFT_ASSERT(from);
+    AFT_ASSERT(repeats >= 0);
 
-    int from_count = aft_string_get_count(from);
-    bool reserved = aft_string_reserve(to, from_count);
+    const char* to_contents_before_reserve = aft_string_get_contents_const(to);
+    int prior_count = aft_string_get_count(to);
+    int from_count = aft_string_slice_count(from);
 
-    if(!reserved)
+    if(repeats > 0 && from_count > (INT_MAX - prior_count) / repeats)
+    {
+        return false;
+    }
+
+    int repeated_count = from_count * repeats;
+    int total = prior_count + repeated_count;
+
+    if(!aft_string_reserve(to, total))
     {
         return false;
     }
 
-    int count = from_count;
-    aft_string_set_count(to, count);
     char* to_contents = aft_string_get_contents(to);
-    const char* from_contents = aft_string_get_contents_const(from);
-    copy_memory(to_contents, from_contents, count);
-    to_contents[count] = '\0';
+    const char* from_contents = rebase_slice_start(aft_string_slice_start(from),
+            to_contents_before_reserve, prior_count, to_contents);
+
+    // After the first copy, keep doubling what's been written, so long runs
+    // take few copies.
+    char* repeated = &to_contents[prior_count];
+    int copied = int_min(from_count, repeated_count);
+    copy_memory(repeated, from_contents, copied);
+
+    while(copied < repeated_count)
+    {
+        int next = int_min(copied, repeated_count - copied);
+        copy_memory(&repeated[copied], repeated, next);
+        copied += next;
+    }
+
+    to_contents[total] = '\0';
+    aft_string_set_count(to, total);
 
     AFT_ASSERT(aft_string_check_uncorrupted(to));
 
     return true;
 }
 
-AftMaybeString aft_string_copy(AftString* string)
-{
-    return aft_string_copy_with_allocator(string, NULL);
-}
-
-AftMaybeString aft_string_copy_with_allocator(AftString* string, void* allocator)
+bool aft_string_append_slice(AftString* to, AftStringSlice from)
 {
-    AFT_ASSERT(string);
+    AFT_ASSERT(to);
+
+    const char* to_contents_before_reserve = aft_string_get_contents_const(to);
+    bool self_append = aft_string_slice_in_string(from, to);
+
+    int to_count = aft_string_get_count(to);
+    int from_count = aft_string_slice_count(from);
+    int count = to_count + from_count;
+    bool reserved = aft_string_reserve(to, count);
+
+    if(!reserved)
+    {
+        return false;
+    }
+
+    int prior_count = to_count;
+    aft_string_set_count(to, count);
+    char* to_contents = aft_string_get_contents(to);
+
+    const char* from_contents = aft_string_slice_start(from);
+    if(self_append)
+    {
+        ptrdiff_t start_index = from_contents - to_contents_before_reserve;
+        from_contents = to_contents + start_index;
+    }
+
+    copy_memory(&to_contents[prior_count], from_contents, from_count);
+    to_contents[count] = '\0';
+
+    AFT_ASSERT(aft_string_check_uncorrupted(to));
+
+    return true;
+}
+
+bool aft_string_assign(AftString* to, const AftString* from)
+{
+    AFT_ASSERT(to);
+    AFT_ASSERT(from);
+
+    int from_count = aft_string_get_count(from);
+    bool reserved = aft_string_reserve(to, from_count);
+
+    if(!reserved)
+    {
+        return false;
+    }
+
+    int count = from_count;
+    aft_string_set_count(to, count);
+    char* to_contents = aft_string_get_contents(to);
+    const char* from_contents = aft_string_get_contents_const(from);
+    copy_memory(to_contents, from_contents, count);
+    to_contents[count] = '\0';
+
+    AFT_ASSERT(aft_string_check_uncorrupted(to));
+
+    return true;
+}
+
+AftMaybeString aft_string_copy(AftString* string)
+{
+    return aft_string_copy_with_allocator(string, NULL);
+}
+
+AftMaybeString aft_string_copy_with_allocator(AftString* string, void* allocator)
+{
+    AFT_ASSERT(string);
 
     int count = aft_string_get_count(string);
 
@@ -574,7 +1074,7 @@ AftMaybeString aft_string_copy_with_allocator(AftString* string, void* allocator
     result.valid = true;
     result.value.allocator = allocator;
     result.value.cap = AFT_STRING_SMALL_CAP;
-    aft_string_set_count(&result.value, count);
+    aft_string_set_count(&result.value, 0);
     aft_string_set_uncorrupted(&result.value);
     bool reserved = aft_string_reserve(&result.value, count);
 
@@ -585,6 +1085,7 @@ AftMaybeString aft_string_copy_with_allocator(AftString* string, void* allocator
         return result;
     }
 
+    aft_string_set_count(&result.value, count);
     char* to_contents = aft_string_get_contents(&result.value);
     const char* from_contents = aft_string_get_contents_const(string);
     copy_memory(to_contents, from_contents, count);
@@ -631,9 +1132,14 @@ AftMaybeString aft_string_copy_c_string_with_allocator(const char* original, voi
     else
     {
         copy_memory(result.value.small.contents, original, bytes);
-        result.value.small.contents[bytes] = '\0';
         result.value.cap = AFT_STRING_SMALL_CAP;
         aft_string_set_count(&result.value, bytes);
+
+        // A full small string is terminated by its bytes_left, which is zero.
+        if(bytes < (int) (AFT_STRING_SMALL_CAP - 1))
+        {
+            result.value.small.contents[bytes] = '\0';
+        }
     }
 
     return result;
@@ -676,9 +1182,14 @@ AftMaybeString aft_string_copy_slice_with_allocator(AftStringSlice slice, void*
     else
     {
         copy_memory(result.value.small.contents, contents, count);
-        result.value.small.contents[count] = '\0';
         result.value.cap = AFT_STRING_SMALL_CAP;
         aft_string_set_count(&result.value, count);
+
+        // A full small string is terminated by its bytes_left, which is zero.
+        if(count < (int) (AFT_STRING_SMALL_CAP - 1))
+        {
+            result.value.small.contents[count] = '\0';
+        }
     }
 
     return result;
@@ -754,7 +1265,7 @@ int aft_string_get_count(const AftString* string)
     }
     else
     {
-        return AFT_STRING_SMALL_CAP - string->small.bytes_left;
+        return AFT_STRING_SMALL_CAP - 1 - string->small.bytes_left;
     }
 }
 
@@ -774,6 +1285,70 @@ void aft_string_initialise_with_allocator(AftString* string, void* allocator)
     aft_string_set_uncorrupted(string);
 }
 
+AftMaybeString aft_string_join(AftStringSlice separator, const AftStringSlice* slices, int count)
+{
+    return aft_string_join_with_allocator(separator, slices, count, NULL);
+}
+
+AftMaybeString aft_string_join_with_allocator(AftStringSlice separator, const AftStringSlice* slices, int count, void* allocator)
+{
+    AFT_ASSERT(slices || count == 0);
+    AFT_ASSERT(count >= 0);
+
+    AftMaybeString result;
+    result.valid = false;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+
+    const char* separator_contents = aft_string_slice_start(separator);
+    int separator_count = aft_string_slice_count(separator);
+    if(count > 1 && separator_count > INT_MAX / (count - 1))
+    {
+        return result;
+    }
+
+    int total = (count > 0) ? separator_count * (count - 1) : 0;
+
+    for(int slice_index = 0; slice_index < count; slice_index += 1)
+    {
+        int slice_count = aft_string_slice_count(slices[slice_index]);
+
+        if(slice_count > INT_MAX - total)
+        {
+            return result;
+        }
+
+        total += slice_count;
+    }
+
+    if(!aft_string_reserve(&result.value, total))
+    {
+        return result;
+    }
+
+    char* contents = aft_string_get_contents(&result.value);
+    int index = 0;
+
+    for(int slice_index = 0; slice_index < count; slice_index += 1)
+    {
+        if(slice_index > 0)
+        {
+            copy_memory(&contents[index], separator_contents, separator_count);
+            index += separator_count;
+        }
+
+        AftStringSlice slice = slices[slice_index];
+        int slice_count = aft_string_slice_count(slice);
+        copy_memory(&contents[index], aft_string_slice_start(slice), slice_count);
+        index += slice_count;
+    }
+
+    contents[total] = '\0';
+    aft_string_set_count(&result.value, total);
+    result.valid = true;
+
+    return result;
+}
+
 void aft_string_remove(AftString* string, int start, int end)
 {
     AFT_ASSERT(string);
@@ -856,30 +1431,32 @@ bool aft_string_reserve(AftString* string, int space)
 
         int count = aft_string_get_count(string);
 
-        if(count)
+        if(prior_cap > AFT_STRING_SMALL_CAP)
         {
-            if(prior_cap > AFT_STRING_SMALL_CAP)
+            char* prior_contents = string->big.contents;
+            copy_memory(contents, prior_contents, count);
+            AftMemoryBlock block =
             {
-                char* prior_contents = string->big.contents;
-                copy_memory(contents, prior_contents, count);
-                AftMemoryBlock block =
-                {
-                    .memory = prior_contents,
-                    .bytes = string->cap,
-                };
-                aft_deallocate(string->allocator, block);
-            }
-            else
-            {
-                char* prior_contents = string->small.contents;
-                copy_memory(contents, prior_contents, count);
-                zero_memory(prior_contents, prior_cap);
-            }
+                .memory = prior_contents,
+                .bytes = string->cap,
+            };
+            aft_deallocate(string->allocator, block);
+        }
+        else
+        {
+            char* prior_contents = string->small.contents;
+            copy_memory(contents, prior_contents, count);
+            zero_memory(prior_contents, prior_cap);
         }
 
         AFT_ASSERT(cap > AFT_STRING_SMALL_CAP);
         string->big.contents = contents;
         string->cap = cap;
+
+        // The count of a small string overlaps the big contents, so it has
+        // to be set again.
+        contents[count] = '\0';
+        aft_string_set_count(string, count);
     }
 
     AFT_ASSERT(aft_string_check_uncorrupted(string));
@@ -888,6 +1465,144 @@ bool aft_string_reserve(AftString* string, int space)
 }
 
 
+void aft_string_handle_array_from_slices(AftStringHandle* handles, const AftStringSlice* slices, int count)
+{
+    AFT_ASSERT(handles);
+    AFT_ASSERT(slices || count == 0);
+    AFT_ASSERT(count >= 0);
+
+    for(int handle_index = 0; handle_index < count; handle_index += 1)
+    {
+        handles[handle_index] = aft_string_handle_from_slice(slices[handle_index]);
+    }
+}
+
+void aft_string_handle_array_from_strings(AftStringHandle* handles, const AftString* strings, int count)
+{
+    AFT_ASSERT(handles);
+    AFT_ASSERT(strings || count == 0);
+    AFT_ASSERT(count >= 0);
+
+    for(int handle_index = 0; handle_index < count; handle_index += 1)
+    {
+        handles[handle_index] = aft_string_handle_from_string(&strings[handle_index]);
+    }
+}
+
+int aft_string_handle_compare(AftStringHandle a, AftStringHandle b)
+{
+    if(a.prefix != b.prefix)
+    {
+        return (a.prefix < b.prefix) ? -1 : 1;
+    }
+
+    int min_count = int_min(a.count, b.count);
+
+    if(min_count > AFT_STRING_HANDLE_PREFIX_BYTES)
+    {
+        const uint8_t* a_contents = (const uint8_t*) a.contents;
+        const uint8_t* b_contents = (const uint8_t*) b.contents;
+
+        for(int char_index = AFT_STRING_HANDLE_PREFIX_BYTES;
+                char_index < min_count;
+                char_index += 1)
+        {
+            if(a_contents[char_index] != b_contents[char_index])
+            {
+                return (a_contents[char_index] < b_contents[char_index]) ? -1 : 1;
+            }
+        }
+    }
+
+    return (a.count > b.count) - (a.count < b.count);
+}
+
+AftStringHandle aft_string_handle_from_slice(AftStringSlice slice)
+{
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+    int prefix_count = int_min(count, AFT_STRING_HANDLE_PREFIX_BYTES);
+
+    uint32_t prefix = 0;
+
+    for(int char_index = 0; char_index < AFT_STRING_HANDLE_PREFIX_BYTES; char_index += 1)
+    {
+        prefix <<= 8;
+
+        if(char_index < prefix_count)
+        {
+            prefix |= (uint8_t) contents[char_index];
+        }
+    }
+
+    AftStringHandle result =
+    {
+        .contents = contents,
+        .prefix = prefix,
+        .count = count,
+    };
+
+    return result;
+}
+
+AftStringHandle aft_string_handle_from_string(const AftString* string)
+{
+    AFT_ASSERT(string);
+
+    AftStringSlice slice = aft_string_slice_from_string(string);
+
+    return aft_string_handle_from_slice(slice);
+}
+
+AftStringSlice aft_string_handle_get_slice(AftStringHandle handle)
+{
+    return aft_string_slice_from_buffer(handle.contents, handle.count);
+}
+
+uint64_t aft_string_handle_hash(AftStringHandle handle)
+{
+    uint64_t hash = mix_hash((uint64_t) handle.count, handle.prefix);
+
+    int char_index = AFT_STRING_HANDLE_PREFIX_BYTES;
+
+    for(; char_index + 8 <= handle.count; char_index += 8)
+    {
+        hash = mix_hash(hash, load_uint64_little_endian(&handle.contents[char_index]));
+    }
+
+    if(char_index < handle.count)
+    {
+        uint64_t tail = 0;
+
+        for(int shift = 0; char_index < handle.count; char_index += 1, shift += 8)
+        {
+            tail |= (uint64_t) (uint8_t) handle.contents[char_index] << shift;
+        }
+
+        hash = mix_hash(hash, tail);
+    }
+
+    return hash;
+}
+
+bool aft_string_handle_matches(AftStringHandle a, AftStringHandle b)
+{
+    if(a.prefix != b.prefix || a.count != b.count)
+    {
+        return false;
+    }
+
+    if(a.count <= AFT_STRING_HANDLE_PREFIX_BYTES)
+    {
+        return true;
+    }
+
+    return memory_matches(&a.contents[AFT_STRING_HANDLE_PREFIX_BYTES],
+            &b.contents[AFT_STRING_HANDLE_PREFIX_BYTES],
+            a.count - AFT_STRING_HANDLE_PREFIX_BYTES);
+}
+
+
 bool aft_string_range_check(const AftString* string, int start, int end)
 {
     AFT_ASSERT(string);
@@ -1168,111 +1883,402 @@ bool aft_strings_match(const AftString* a, const AftString* b)
 }
 
 
-bool aft_utf32_destroy(AftUtf32String* string)
+bool aft_utf16_destroy(AftUtf16String* string)
 {
-    return aft_utf32_destroy_with_allocator(string, NULL);
+    return aft_utf16_destroy_with_allocator(string, NULL);
 }
 
-bool aft_utf32_destroy_with_allocator(AftUtf32String* string, void* allocator)
+bool aft_utf16_destroy_with_allocator(AftUtf16String* string, void* allocator)
 {
     AftMemoryBlock block =
     {
         .memory = string->contents,
-        .bytes = sizeof(char32_t) * string->count,
+        .bytes = sizeof(char16_t) * (string->count + 1),
     };
     return aft_deallocate(allocator, block);
 }
 
-AftMaybeString aft_utf32_to_utf8(const AftUtf32String* string)
+AftMaybeInt aft_utf16_get_utf8_count(const char16_t* contents, int count, AftByteOrder byte_order)
 {
-    return aft_utf32_to_utf8_with_allocator(string, NULL);
-}
+    AFT_ASSERT(contents || count == 0);
 
-AftMaybeString aft_utf32_to_utf8_with_allocator(const AftUtf32String* string, void* allocator)
-{
-    AFT_ASSERT(string);
+    AftMaybeInt result = {0, false};
+    int bytes = 0;
+    int index = 0;
 
-    AftMaybeString result;
-    aft_string_initialise_with_allocator(&result.value, allocator);
-    result.valid = true;
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        // Without surrogates, each unit is one byte plus one for being
+        // above 0x7f and one more for being above 0x7ff.
+        if(count - index >= 8)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            __m128i units = load_utf16_block(&contents[index], byte_order);
+            __m128i surrogates = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short) 0xf800)),
+                    _mm_set1_epi16((short) 0xd800));
 
-    int char_index = 0;
+            __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short) 0xff80)), zero);
+            int ascii_mask = _mm_movemask_epi8(ascii);
 
-    for(int code_index = 0; code_index < string->count; code_index += 1)
-    {
-        char32_t codepoint = string->contents[code_index];
-        bool appended = aft_utf8_append_codepoint(&result.value, codepoint);
-        if(!appended)
+            if(ascii_mask == 0xffff)
+            {
+                bytes += 8;
+                index += 8;
+                continue;
+            }
+
+            if(!_mm_movemask_epi8(surrogates))
+            {
+                __m128i narrow = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short) 0xf800)), zero);
+                int ascii_count = count_set_bits64((uint16_t) ascii_mask) / 2;
+                int narrow_count = count_set_bits64((uint16_t) _mm_movemask_epi8(narrow)) / 2;
+
+                bytes += 24 - ascii_count - narrow_count;
+                index += 8;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        char16_t unit = load_utf16_unit(contents, index, byte_order);
+
+        if(unit < 0x80)
+        {
+            bytes += 1;
+        }
+        else if(unit < 0x800)
+        {
+            bytes += 2;
+        }
+        else if((unit & UTF16_SURROGATE_MASK) == UTF16_HIGH_SURROGATE)
+        {
+            if(index + 1 == count
+                    || (load_utf16_unit(contents, index + 1, byte_order) & UTF16_SURROGATE_MASK) != UTF16_LOW_SURROGATE)
+            {
+                return result;
+            }
+
+            bytes += 4;
+            index += 1;
+        }
+        else if((unit & UTF16_SURROGATE_MASK) == UTF16_LOW_SURROGATE)
         {
-            aft_string_destroy(&result.value);
-            result.valid = false;
             return result;
         }
+        else
+        {
+            bytes += 3;
+        }
+
+        index += 1;
     }
 
+    result.value = bytes;
+    result.valid = true;
+
     return result;
 }
 
+AftMaybeString aft_utf16_to_utf8(const AftUtf16String* string, AftByteOrder byte_order)
+{
+    return aft_utf16_to_utf8_with_allocator(string, byte_order, NULL);
+}
 
-bool aft_utf8_append_codepoint(AftString* string, char32_t codepoint)
+AftMaybeInt aft_utf16_to_utf8_buffer(const char16_t* contents, int count, AftByteOrder byte_order, char* buffer, int cap)
 {
-    char buffer[5];
+    AFT_ASSERT(contents || count == 0);
+    AFT_ASSERT(buffer || cap == 0);
 
-    if(codepoint < 0x80)
-    {
-        buffer[0] = (char) codepoint;
-        buffer[1] = '\0';
-    }
-    else if(codepoint < 0x800)
+    AftMaybeInt result = {0, false};
+    int byte_index = 0;
+    int index = 0;
+
+    while(index < count)
     {
-        buffer[0] = (codepoint >> 6) | 0xc0;
-        buffer[1] = (codepoint & 0x3f) | 0x80;
-        buffer[2] = '\0';
-    }
-    else if(codepoint < 0x10000)
+#if defined(USE_SSE2)
+        if(count - index >= 8 && cap - byte_index >= 8)
+        {
+            __m128i units = load_utf16_block(&contents[index], byte_order);
+            __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16((short) 0xff80)),
+                    _mm_setzero_si128());
+
+            if(_mm_movemask_epi8(ascii) == 0xffff)
+            {
+                _mm_storel_epi64((__m128i*) &buffer[byte_index], _mm_packus_epi16(units, units));
+                byte_index += 8;
+                index += 8;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        char32_t codepoint = load_utf16_unit(contents, index, byte_order);
+        index += 1;
+
+        if((codepoint & UTF16_SURROGATE_MASK) == UTF16_HIGH_SURROGATE)
+        {
+            char16_t low = (index < count) ? load_utf16_unit(contents, index, byte_order) : 0;
+
+            if((low & UTF16_SURROGATE_MASK) != UTF16_LOW_SURROGATE)
+            {
+                return result;
+            }
+
+            codepoint = 0x10000 + ((codepoint - UTF16_HIGH_SURROGATE) << 10) + (low - UTF16_LOW_SURROGATE);
+            index += 1;
+        }
+        else if((codepoint & UTF16_SURROGATE_MASK) == UTF16_LOW_SURROGATE)
+        {
+            return result;
+        }
+
+        uint8_t* bytes = (uint8_t*) &buffer[byte_index];
+
+        if(codepoint < 0x80)
+        {
+            if(cap - byte_index < 1)
+            {
+                return result;
+            }
+
+            bytes[0] = (uint8_t) codepoint;
+            byte_index += 1;
+        }
+        else if(codepoint < 0x800)
+        {
+            if(cap - byte_index < 2)
+            {
+                return result;
+            }
+
+            bytes[0] = (uint8_t) ((codepoint >> 6) | 0xc0);
+            bytes[1] = (uint8_t) ((codepoint & 0x3f) | 0x80);
+            byte_index += 2;
+        }
+        else if(codepoint < 0x10000)
+        {
+            if(cap - byte_index < 3)
+            {
+                return result;
+            }
+
+            bytes[0] = (uint8_t) ((codepoint >> 12) | 0xe0);
+            bytes[1] = (uint8_t) (((codepoint >> 6) & 0x3f) | 0x80);
+            bytes[2] = (uint8_t) ((codepoint & 0x3f) | 0x80);
+            byte_index += 3;
+        }
+        else
+        {
+            if(cap - byte_index < 4)
+            {
+                return result;
+            }
+
+            bytes[0] = (uint8_t) ((codepoint >> 18) | 0xf0);
+            bytes[1] = (uint8_t) (((codepoint >> 12) & 0x3f) | 0x80);
+            bytes[2] = (uint8_t) (((codepoint >> 6) & 0x3f) | 0x80);
+            bytes[3] = (uint8_t) ((codepoint & 0x3f) | 0x80);
+            byte_index += 4;
+        }
+    }
+
+    result.value = byte_index;
+    result.valid = true;
+
+    return result;
+}
+
+AftMaybeString aft_utf16_to_utf8_with_allocator(const AftUtf16String* string, AftByteOrder byte_order, void* allocator)
+{
+    AFT_ASSERT(string);
+
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = false;
+
+    AftMaybeInt count = aft_utf16_get_utf8_count(string->contents, string->count, byte_order);
+
+    if(!count.valid || !aft_string_reserve(&result.value, count.value))
     {
-        buffer[0] = (codepoint >> 12) | 0xe0;
-        buffer[1] = ((codepoint >> 6) & 0x3f) | 0x80;
-        buffer[2] = (codepoint & 0x3f) | 0x80;
-        buffer[3] = '\0';
+        aft_string_destroy(&result.value);
+        return result;
     }
-    else if(codepoint < 0x110000)
+
+    char* contents = aft_string_get_contents(&result.value);
+    AftMaybeInt written = aft_utf16_to_utf8_buffer(string->contents, string->count, byte_order, contents, count.value);
+
+    if(!written.valid)
     {
-        buffer[0] = (codepoint >> 18) | 0xf0;
-        buffer[1] = ((codepoint >> 12) & 0x3f) | 0x80;
-        buffer[2] = ((codepoint >> 6) & 0x3f) | 0x80;
-        buffer[3] = (codepoint & 0x3f) | 0x80;
-        buffer[4] = '\0';
+        aft_string_destroy(&result.value);
+        return result;
     }
-    else
+
+    AFT_ASSERT(written.value == count.value);
+
+    contents[count.value] = '\0';
+    aft_string_set_count(&result.value, count.value);
+    result.valid = true;
+
+    return result;
+}
+
+
+bool aft_utf32_destroy(AftUtf32String* string)
+{
+    return aft_utf32_destroy_with_allocator(string, NULL);
+}
+
+bool aft_utf32_destroy_with_allocator(AftUtf32String* string, void* allocator)
+{
+    AftMemoryBlock block =
+    {
+        .memory = string->contents,
+        .bytes = sizeof(char32_t) * string->count,
+    };
+    return aft_deallocate(allocator, block);
+}
+
+AftMaybeString aft_utf32_to_utf8(const AftUtf32String* string)
+{
+    return aft_utf32_to_utf8_with_allocator(string, NULL);
+}
+
+AftMaybeString aft_utf32_to_utf8_with_allocator(const AftUtf32String* string, void* allocator)
+{
+    AFT_ASSERT(string);
+
+    AftMaybeString result;
+    aft_string_initialise_with_allocator(&result.value, allocator);
+    result.valid = true;
+
+    int char_index = 0;
+
+    for(int code_index = 0; code_index < string->count; code_index += 1)
+    {
+        char32_t codepoint = string->contents[code_index];
+        bool appended = aft_utf8_append_codepoint(&result.value, codepoint);
+        if(!appended)
+        {
+            aft_string_destroy(&result.value);
+            result.valid = false;
+            return result;
+        }
+    }
+
+    return result;
+}
+
+
+bool aft_utf8_append_codepoint(AftString* string, char32_t codepoint)
+{
+    char buffer[4];
+    int count = encode_codepoint(codepoint, buffer);
+
+    if(!count)
     {
         return false;
     }
 
-    return aft_string_append_c_string(string, buffer);
+    return aft_string_append_slice(string, aft_string_slice_from_buffer(buffer, count));
 }
 
-bool aft_utf8_check(const AftString* string)
+bool aft_utf8_append_code_page(AftString* string, AftStringSlice encoded, AftCodePage code_page)
 {
     AFT_ASSERT(string);
+    AFT_ASSERT(aft_string_check_uncorrupted(string));
 
-    const uint8_t* contents = (const uint8_t*) aft_string_get_contents_const(string);
-    int count = aft_string_get_count(string);
-    uint8_t state = 0;
+    const uint8_t* bytes = (const uint8_t*) aft_string_slice_start(encoded);
+    int count = aft_string_slice_count(encoded);
 
-    for(int char_index = 0; char_index < count; char_index += 1)
+    // Every byte above 0x7f takes two bytes in UTF-8, except for the
+    // Windows-1252 ones that map past U+07FF, which take three.
+    int utf8_count = count;
+    int index = 0;
+
+    while(index < count)
     {
-        uint8_t byte = contents[char_index];
-        uint8_t type = utf8_decode_type_table[byte];
-        state = utf8_decode_state_table[(16 * state) + type];
+#if defined(USE_SSE2)
+        if(count - index >= 16)
+        {
+            __m128i block = _mm_loadu_si128((const __m128i*) &bytes[index]);
+            uint64_t high = (uint16_t) _mm_movemask_epi8(block);
+            uint64_t windows_high = (code_page == AFT_CODE_PAGE_WINDOWS_1252)
+                    ? (uint16_t) _mm_movemask_epi8(_mm_cmplt_epi8(block, _mm_set1_epi8(-96)))
+                    : 0;
 
-        if(state == 1)
+            utf8_count += count_set_bits64(high);
+
+            for(; windows_high; windows_high &= windows_high - 1)
+            {
+                uint8_t byte = bytes[index + count_trailing_zeros64(windows_high)];
+                utf8_count += windows_1252_high_codepoints[byte - 0x80] >= 0x800;
+            }
+
+            index += 16;
+            continue;
+        }
+#endif // defined(USE_SSE2)
+
+        char32_t codepoint = decode_code_page_byte(bytes[index], code_page);
+        utf8_count += (codepoint >= 0x80) + (codepoint >= 0x800);
+        index += 1;
+    }
+
+    int prior_count = aft_string_get_count(string);
+
+    if(!aft_string_reserve(string, prior_count + utf8_count))
+    {
+        return false;
+    }
+
+    char* contents = aft_string_get_contents(string);
+    int byte_index = prior_count;
+    index = 0;
+
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        if(count - index >= 16)
         {
-            return false;
+            // Copy the whole block, but only keep the ASCII bytes up to the
+            // first that isn't. The rest gets written over.
+            __m128i block = _mm_loadu_si128((const __m128i*) &bytes[index]);
+            uint64_t high = (uint16_t) _mm_movemask_epi8(block);
+            int ascii_count = high ? count_trailing_zeros64(high) : 16;
+
+            _mm_storeu_si128((__m128i*) &contents[byte_index], block);
+            byte_index += ascii_count;
+            index += ascii_count;
+
+            if(ascii_count == 16)
+            {
+                continue;
+            }
         }
+#endif // defined(USE_SSE2)
+
+        char32_t codepoint = decode_code_page_byte(bytes[index], code_page);
+        byte_index += encode_codepoint(codepoint, &contents[byte_index]);
+        index += 1;
     }
 
-    return state != 0;
+    AFT_ASSERT(byte_index == prior_count + utf8_count);
+
+    contents[byte_index] = '\0';
+    aft_string_set_count(string, byte_index);
+
+    return true;
+}
+
+bool aft_utf8_check(const AftString* string)
+{
+    AFT_ASSERT(string);
+
+    const char* contents = aft_string_get_contents_const(string);
+    int count = aft_string_get_count(string);
+
+    return find_invalid_utf8(contents, 0, count) == count;
 }
 
 int aft_utf8_codepoint_count(const AftString* string)
@@ -1292,6 +2298,233 @@ int aft_utf8_codepoint_count(const AftString* string)
     return count;
 }
 
+AftMaybeInt aft_utf8_get_utf16_count(AftStringSlice slice)
+{
+    const uint8_t* contents = (const uint8_t*) aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+
+    AftMaybeInt result = {0, false};
+    uint8_t state = 0;
+    int units = 0;
+    int index = 0;
+
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        if(state == 0 && count - index >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &contents[index]);
+
+            if(!_mm_movemask_epi8(bytes))
+            {
+                units += 16;
+                index += 16;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        // Every codepoint is one unit, counted at its first byte, and those
+        // outside the basic multilingual plane take a second.
+        uint8_t byte = contents[index];
+        uint8_t type = utf8_decode_type_table[byte];
+        state = utf8_decode_state_table[(16 * state) + type];
+
+        if(state == 1)
+        {
+            return result;
+        }
+
+        units += ((byte & 0xc0) != 0x80) + (byte >= 0xf0);
+        index += 1;
+    }
+
+    if(state != 0)
+    {
+        return result;
+    }
+
+    result.value = units;
+    result.valid = true;
+
+    return result;
+}
+
+AftMaybeStringSlice aft_utf8_sanitize(AftStringSlice slice, AftString* buffer)
+{
+    AFT_ASSERT(buffer);
+
+    AftMaybeStringSlice result = {slice, true};
+
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+    int invalid = find_invalid_utf8(contents, 0, count);
+
+    if(invalid == count)
+    {
+        return result;
+    }
+
+    result.valid = false;
+
+    // There's at least one replacement, which can be longer than what it
+    // replaces. More than that only grows the buffer when it's needed.
+    int prior_count = aft_string_get_count(buffer);
+    bool appended = aft_string_reserve(buffer, prior_count + count + 2);
+    int index = 0;
+
+    while(appended && index < count)
+    {
+        appended = aft_string_append_slice(buffer, aft_string_slice(slice, index, invalid));
+
+        if(appended && invalid < count)
+        {
+            appended = aft_string_append_c_string(buffer, UTF8_REPLACEMENT);
+            index = invalid + get_maximal_subpart_count(contents, invalid, count);
+            invalid = find_invalid_utf8(contents, index, count);
+        }
+        else
+        {
+            index = count;
+        }
+    }
+
+    if(!appended)
+    {
+        aft_string_remove(buffer, prior_count, aft_string_get_count(buffer));
+        return result;
+    }
+
+    result.value = aft_string_slice_string(buffer, prior_count, aft_string_get_count(buffer));
+    result.valid = true;
+
+    return result;
+}
+
+AftMaybeUtf16String aft_utf8_to_utf16(const AftString* string, AftByteOrder byte_order)
+{
+    AFT_ASSERT(string);
+
+    AftMaybeUtf16String result;
+    result.valid = false;
+
+    AftMaybeInt count = aft_utf8_get_utf16_count(aft_string_slice_from_string(string));
+
+    if(!count.valid)
+    {
+        return result;
+    }
+
+    AftMemoryBlock block = aft_allocate(string->allocator, sizeof(char16_t) * (count.value + 1));
+    char16_t* contents = block.memory;
+
+    if(!contents)
+    {
+        return result;
+    }
+
+    AftMaybeInt written = aft_utf8_to_utf16_buffer(aft_string_slice_from_string(string), byte_order, contents, count.value);
+
+    if(!written.valid)
+    {
+        aft_deallocate(string->allocator, block);
+        return result;
+    }
+
+    AFT_ASSERT(written.value == count.value);
+
+    contents[count.value] = u'\0';
+
+    result.value.contents = contents;
+    result.value.count = count.value;
+    result.valid = true;
+
+    return result;
+}
+
+AftMaybeInt aft_utf8_to_utf16_buffer(AftStringSlice slice, AftByteOrder byte_order, char16_t* buffer, int cap)
+{
+    AFT_ASSERT(buffer || cap == 0);
+
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+
+    AftMaybeInt result = {0, false};
+    int unit_index = 0;
+    int index = 0;
+
+    while(index < count)
+    {
+#if defined(USE_SSE2)
+        if(count - index >= 16 && cap - unit_index >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &contents[index]);
+
+            if(!_mm_movemask_epi8(bytes))
+            {
+                store_utf16_ascii_block(bytes, &buffer[unit_index], byte_order);
+                unit_index += 16;
+                index += 16;
+                continue;
+            }
+        }
+#endif // defined(USE_SSE2)
+
+        uint8_t byte = (uint8_t) contents[index];
+
+        if(byte < 0x80)
+        {
+            if(cap - unit_index < 1)
+            {
+                return result;
+            }
+
+            store_utf16_unit(buffer, unit_index, byte, byte_order);
+            unit_index += 1;
+            index += 1;
+            continue;
+        }
+
+        char32_t codepoint;
+        int next = decode_codepoint(contents, index, count, &codepoint);
+
+        if(next == -1)
+        {
+            return result;
+        }
+
+        if(codepoint >= 0x10000)
+        {
+            if(cap - unit_index < 2)
+            {
+                return result;
+            }
+
+            codepoint -= 0x10000;
+            store_utf16_unit(buffer, unit_index, (char16_t) (UTF16_HIGH_SURROGATE + (codepoint >> 10)), byte_order);
+            store_utf16_unit(buffer, unit_index + 1, (char16_t) (UTF16_LOW_SURROGATE + (codepoint & 0x3ff)), byte_order);
+            unit_index += 2;
+        }
+        else
+        {
+            if(cap - unit_index < 1)
+            {
+                return result;
+            }
+
+            store_utf16_unit(buffer, unit_index, (char16_t) codepoint, byte_order);
+            unit_index += 1;
+        }
+
+        index = next;
+    }
+
+    result.value = unit_index;
+    result.valid = true;
+
+    return result;
+}
+
 AftMaybeUtf32String aft_utf8_to_utf32(const AftString* string)
 {
     AFT_ASSERT(string);
@@ -1377,102 +2610,120 @@ AftMaybeChar32 aft_codepoint_iterator_next(AftCodepointIterator* it)
 
     if(it->index < it->end)
     {
-        char32_t codepoint = 0;
-
         const char* contents = aft_string_slice_start(it->slice);
-        uint32_t state = 0;
+        uint8_t byte = (uint8_t) contents[it->index];
 
-        for(int byte_index = it->index;
-                byte_index < it->end;
-                byte_index += 1)
+        if(byte < 0x80)
         {
-            uint32_t byte = (uint8_t) contents[byte_index];
-            uint32_t type = utf8_decode_type_table[byte];
+            it->index += 1;
+            AftMaybeChar32 result = {byte, true};
+            return result;
+        }
 
-            if(state)
-            {
-                codepoint = (byte & 0x3fu) | (codepoint << 6);
-            }
-            else
-            {
-                codepoint = (0xff >> type) & byte;
-            }
+        char32_t codepoint;
+        int next = decode_codepoint(contents, it->index, it->end, &codepoint);
+
+        if(next != -1)
+        {
+            it->index = next;
+            AftMaybeChar32 result = {codepoint, true};
+            return result;
+        }
+    }
+
+    AftMaybeChar32 result = {U'\0', false};
+    return result;
+}
+
+int aft_codepoint_iterator_next_batch(AftCodepointIterator* it, char32_t* codepoints, int max)
+{
+    AFT_ASSERT(it);
+    AFT_ASSERT(codepoints || max == 0);
 
-            state = utf8_decode_state_table[(16 * state) + type];
+    const char* contents = aft_string_slice_start(it->slice);
+    int index = it->index;
+    int count = 0;
+
+    while(count < max && index < it->end)
+    {
+#if defined(USE_SSE2)
+        if(max - count >= 16 && it->end - index >= 16)
+        {
+            __m128i bytes = _mm_loadu_si128((const __m128i*) &contents[index]);
 
-            if(!state)
+            if(!_mm_movemask_epi8(bytes))
             {
-                it->index = byte_index + 1;
-                AftMaybeChar32 result = {codepoint, true};
-                return result;
+                store_ascii_block(bytes, &codepoints[count]);
+                index += 16;
+                count += 16;
+                continue;
             }
         }
+#endif // defined(USE_SSE2)
+
+        uint8_t byte = (uint8_t) contents[index];
+
+        if(byte < 0x80)
+        {
+            codepoints[count] = byte;
+            index += 1;
+            count += 1;
+            continue;
+        }
+
+        int next = decode_codepoint(contents, index, it->end, &codepoints[count]);
+
+        if(next == -1)
+        {
+            break;
+        }
+
+        index = next;
+        count += 1;
     }
 
-    AftMaybeChar32 result = {U'\0', false};
-    return result;
+    it->index = index;
+
+    return count;
 }
 
-// This steps back to the prior heading byte before the iterator and decodes
-// moving forward. Then sets the iterator to the heading byte index it started
-// decoding at.
-//
-// An alternate idea would be to decode backwards until a heading byte is found.
-// This would entail not using the state machine and instead building the
-// codepoint without error checking. Then, after, checking for overlong
-// encodings, not enough continuation bytes, and validity of the resulting
-// codepoint. It might or might not be an improvement. Also, this idea has the
-// disadvantage of not being able to determine the byte the error first occurs,
-// just that it was somewhere before it finally hit a heading byte. Which the
-// state machine does do!
+// This steps back over at most three continuation bytes to the heading byte
+// and decodes forward from there with the state machine, which has to finish
+// exactly where the iterator was. So anything malformed is caught, though
+// not the exact byte the error is at.
 AftMaybeChar32 aft_codepoint_iterator_prior(AftCodepointIterator* it)
 {
     AFT_ASSERT(it);
 
-    if(it->index - 1 >= it->start)
+    if(it->index > it->start)
     {
-        char32_t codepoint = 0;
-
         const char* contents = aft_string_slice_start(it->slice);
-        int codepoint_index = it->start;
+        int last = it->index - 1;
+        uint8_t byte = (uint8_t) contents[last];
 
-        for(int byte_index = it->index - 1;
-                byte_index >= it->start;
-                byte_index -= 1)
+        if(byte < 0x80)
         {
-            if(is_heading_byte(contents[byte_index]))
-            {
-                codepoint_index = byte_index;
-                break;
-            }
+            it->index = last;
+            AftMaybeChar32 result = {byte, true};
+            return result;
         }
 
-        uint32_t state = 0;
+        int codepoint_index = last;
+        int limit = int_max(it->start, last - 3);
 
-        for(int byte_index = codepoint_index;
-                byte_index < it->end;
-                byte_index += 1)
+        while(codepoint_index > limit && !is_heading_byte(contents[codepoint_index]))
         {
-            uint32_t byte = (uint8_t) contents[byte_index];
-            uint32_t type = utf8_decode_type_table[byte];
-
-            if(state)
-            {
-                codepoint = (byte & 0x3fu) | (codepoint << 6);
-            }
-            else
-            {
-                codepoint = (0xff >> type) & byte;
-            }
+            codepoint_index -= 1;
+        }
 
-            state = utf8_decode_state_table[(16 * state) + type];
+        char32_t codepoint = U'\0';
+        int next = decode_codepoint(contents, codepoint_index, it->index, &codepoint);
 
-            if(!state)
-            {
-                it->index = codepoint_index;
-                AftMaybeChar32 result = {codepoint, true};
-                return result;
-            }
+        if(next == it->index)
+        {
+            it->index = codepoint_index;
+            AftMaybeChar32 result = {codepoint, true};
+            return result;
         }
     }
 
@@ -0,0 +1,550 @@
+#include <AftString/aft_string.h>
+
+#include "parallel.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+#define CACHE_BYTES 8
+#define INSERTION_SORT_CAP 16
+#define PARALLEL_SORT_MIN_COUNT 16384
+#define RANGES_PER_THREAD 4
+#define RANGE_CAP (RANGES_PER_THREAD * PARALLEL_THREAD_CAP + 2)
+
+
+// Each key caches the next eight bytes of its string, from the current depth,
+// packed most significant byte first. So most comparisons during a partition
+// are a single integer comparison, and only the keys that tie on all eight
+// bytes go on to load their next eight.
+typedef struct SortKey
+{
+    uint64_t cache;
+    const char* contents;
+    int cache_count;
+    int count;
+    int index;
+} SortKey;
+
+typedef struct SortRange
+{
+    SortKey* keys;
+    int count;
+    int depth;
+    int thread_index;
+} SortRange;
+
+typedef struct ParallelSort
+{
+    SortRange ranges[RANGE_CAP];
+    int range_count;
+    AftStringSortOrder order;
+} ParallelSort;
+
+
+static int int_min(int a, int b)
+{
+    return (a < b) ? a : b;
+}
+
+static uint8_t fold_byte(uint8_t c, AftStringSortOrder order)
+{
+    if(order == AFT_STRING_SORT_ORDER_ASCII_CASE_INSENSITIVE
+            && c >= 'a' && c <= 'z')
+    {
+        return c - ('a' - 'A');
+    }
+    else
+    {
+        return c;
+    }
+}
+
+static uint64_t fold_word(uint64_t word, AftStringSortOrder order)
+{
+    if(order != AFT_STRING_SORT_ORDER_ASCII_CASE_INSENSITIVE)
+    {
+        return word;
+    }
+
+    const uint64_t ones = UINT64_C(0x0101010101010101);
+    const uint64_t high_bits = UINT64_C(0x8080808080808080);
+
+    uint64_t low_bits = word & ~high_bits;
+    uint64_t at_least_a = low_bits + ((0x80 - 'a') * ones);
+    uint64_t above_z = low_bits + ((0x80 - 'z' - 1) * ones);
+    uint64_t lowercase = at_least_a & ~above_z & ~word & high_bits;
+
+    return word ^ (lowercase >> 2);
+}
+
+static void load_cache(SortKey* key, int depth, AftStringSortOrder order)
+{
+    const uint8_t* bytes = (const uint8_t*) key->contents + depth;
+    int remaining = key->count - depth;
+
+    uint64_t cache = 0;
+
+    if(remaining >= CACHE_BYTES)
+    {
+        for(int byte_index = 0; byte_index < CACHE_BYTES; byte_index += 1)
+        {
+            cache = (cache << 8) | bytes[byte_index];
+        }
+
+        key->cache_count = CACHE_BYTES;
+    }
+    else
+    {
+        for(int byte_index = 0; byte_index < CACHE_BYTES; byte_index += 1)
+        {
+            cache <<= 8;
+
+            if(byte_index < remaining)
+            {
+                cache |= bytes[byte_index];
+            }
+        }
+
+        key->cache_count = remaining;
+    }
+
+    key->cache = fold_word(cache, order);
+}
+
+// Strings that end inside the cache are padded with zeros. So when two caches
+// are equal, the one with fewer bytes is the start of the other and goes first.
+static int compare_caches(const SortKey* a, const SortKey* b)
+{
+    if(a->cache != b->cache)
+    {
+        return (a->cache < b->cache) ? -1 : 1;
+    }
+
+    return a->cache_count - b->cache_count;
+}
+
+static int compare_from_depth(const SortKey* a, const SortKey* b, int depth, AftStringSortOrder order)
+{
+    int compare = compare_caches(a, b);
+
+    if(compare || a->cache_count < CACHE_BYTES)
+    {
+        return compare;
+    }
+
+    const uint8_t* a_contents = (const uint8_t*) a->contents;
+    const uint8_t* b_contents = (const uint8_t*) b->contents;
+    int min_count = int_min(a->count, b->count);
+
+    for(int char_index = depth + CACHE_BYTES; char_index < min_count; char_index += 1)
+    {
+        uint8_t c0 = fold_byte(a_contents[char_index], order);
+        uint8_t c1 = fold_byte(b_contents[char_index], order);
+
+        if(c0 != c1)
+        {
+            return (c0 < c1) ? -1 : 1;
+        }
+    }
+
+    return (a->count > b->count) - (a->count < b->count);
+}
+
+static void swap_keys(SortKey* a, SortKey* b)
+{
+    SortKey temp = *a;
+    *a = *b;
+    *b = temp;
+}
+
+static const SortKey* median_of_three(const SortKey* a, const SortKey* b, const SortKey* c)
+{
+    if(compare_caches(a, b) < 0)
+    {
+        if(compare_caches(b, c) < 0)
+        {
+            return b;
+        }
+        else
+        {
+            return (compare_caches(a, c) < 0) ? c : a;
+        }
+    }
+    else
+    {
+        if(compare_caches(a, c) < 0)
+        {
+            return a;
+        }
+        else
+        {
+            return (compare_caches(b, c) < 0) ? c : b;
+        }
+    }
+}
+
+static void insertion_sort(SortRange range, AftStringSortOrder order)
+{
+    SortKey* keys = range.keys;
+
+    for(int key_index = 1; key_index < range.count; key_index += 1)
+    {
+        SortKey key = keys[key_index];
+        int insert_index = key_index;
+
+        for(; insert_index > 0; insert_index -= 1)
+        {
+            if(compare_from_depth(&keys[insert_index - 1], &key, range.depth, order) <= 0)
+            {
+                break;
+            }
+
+            keys[insert_index] = keys[insert_index - 1];
+        }
+
+        keys[insert_index] = key;
+    }
+}
+
+// Split a range three ways around a pivot: the keys before it, the keys whose
+// caches equal it, and the keys after it. The equal keys move on to the next
+// eight bytes, unless their strings all ended within the cache, in which case
+// they're identical and already sorted. Any part with nothing left to sort
+// comes back with a count of zero.
+static void partition(SortRange range, AftStringSortOrder order, SortRange parts[3])
+{
+    SortKey* keys = range.keys;
+    SortKey pivot = *median_of_three(&keys[0], &keys[range.count / 2], &keys[range.count - 1]);
+
+    int less_end = 0;
+    int greater_start = range.count;
+
+    for(int key_index = 0; key_index < greater_start;)
+    {
+        int compare = compare_caches(&keys[key_index], &pivot);
+
+        if(compare < 0)
+        {
+            swap_keys(&keys[less_end], &keys[key_index]);
+            less_end += 1;
+            key_index += 1;
+        }
+        else if(compare > 0)
+        {
+            greater_start -= 1;
+            swap_keys(&keys[key_index], &keys[greater_start]);
+        }
+        else
+        {
+            key_index += 1;
+        }
+    }
+
+    parts[0].keys = keys;
+    parts[0].count = less_end;
+    parts[0].depth = range.depth;
+
+    parts[1].keys = &keys[less_end];
+    parts[1].count = 0;
+    parts[1].depth = range.depth + CACHE_BYTES;
+
+    parts[2].keys = &keys[greater_start];
+    parts[2].count = range.count - greater_start;
+    parts[2].depth = range.depth;
+
+    if(pivot.cache_count == CACHE_BYTES)
+    {
+        parts[1].count = greater_start - less_end;
+
+        for(int key_index = 0; key_index < parts[1].count; key_index += 1)
+        {
+            load_cache(&parts[1].keys[key_index], parts[1].depth, order);
+        }
+    }
+}
+
+// This is multikey quicksort, as described by Bentley and Sedgewick in "Fast
+// Algorithms for Sorting and Searching Strings", comparing eight cached bytes
+// at a time rather than one. The two smaller parts of each partition are
+// sorted recursively and the largest by looping, which keeps the recursion
+// depth logarithmic.
+static void multikey_quicksort(SortRange range, AftStringSortOrder order)
+{
+    while(range.count > INSERTION_SORT_CAP)
+    {
+        SortRange parts[3];
+        partition(range, order, parts);
+
+        int largest = 0;
+        for(int part_index = 1; part_index < 3; part_index += 1)
+        {
+            if(parts[part_index].count > parts[largest].count)
+            {
+                largest = part_index;
+            }
+        }
+
+        for(int part_index = 0; part_index < 3; part_index += 1)
+        {
+            if(part_index != largest && parts[part_index].count > 1)
+            {
+                multikey_quicksort(parts[part_index], order);
+            }
+        }
+
+        range = parts[largest];
+    }
+
+    if(range.count > 1)
+    {
+        insertion_sort(range, order);
+    }
+}
+
+static void sort_ranges_task(void* data, int task_index)
+{
+    ParallelSort* sort = (ParallelSort*) data;
+
+    for(int range_index = 0; range_index < sort->range_count; range_index += 1)
+    {
+        if(sort->ranges[range_index].thread_index == task_index)
+        {
+            multikey_quicksort(sort->ranges[range_index], sort->order);
+        }
+    }
+}
+
+static int find_largest_range(const ParallelSort* sort)
+{
+    int largest = 0;
+
+    for(int range_index = 1; range_index < sort->range_count; range_index += 1)
+    {
+        if(sort->ranges[range_index].count > sort->ranges[largest].count)
+        {
+            largest = range_index;
+        }
+    }
+
+    return largest;
+}
+
+// Partition serially until there are several independent ranges per thread,
+// or the largest range is already small enough to be a fair share of the work.
+// Then hand the ranges out largest first, each to the least loaded thread.
+static void sort_keys_in_parallel(SortKey* keys, int count, AftStringSortOrder order, int thread_count)
+{
+    ParallelSort sort;
+    sort.order = order;
+    sort.range_count = 1;
+    sort.ranges[0].keys = keys;
+    sort.ranges[0].count = count;
+    sort.ranges[0].depth = 0;
+
+    int range_target = RANGES_PER_THREAD * thread_count;
+    int fair_share = count / range_target;
+
+    while(sort.range_count < range_target)
+    {
+        int largest = find_largest_range(&sort);
+        SortRange range = sort.ranges[largest];
+
+        if(range.count <= fair_share || range.count <= INSERTION_SORT_CAP)
+        {
+            break;
+        }
+
+        SortRange parts[3];
+        partition(range, order, parts);
+
+        sort.range_count -= 1;
+        sort.ranges[largest] = sort.ranges[sort.range_count];
+
+        for(int part_index = 0; part_index < 3; part_index += 1)
+        {
+            if(parts[part_index].count > 1)
+            {
+                sort.ranges[sort.range_count] = parts[part_index];
+                sort.range_count += 1;
+            }
+        }
+    }
+
+    for(int range_index = 1; range_index < sort.range_count; range_index += 1)
+    {
+        SortRange range = sort.ranges[range_index];
+        int insert_index = range_index;
+
+        for(; insert_index > 0 && sort.ranges[insert_index - 1].count < range.count; insert_index -= 1)
+        {
+            sort.ranges[insert_index] = sort.ranges[insert_index - 1];
+        }
+
+        sort.ranges[insert_index] = range;
+    }
+
+    int loads[PARALLEL_THREAD_CAP] = {0};
+
+    for(int range_index = 0; range_index < sort.range_count; range_index += 1)
+    {
+        int least_loaded = 0;
+
+        for(int thread_index = 1; thread_index < thread_count; thread_index += 1)
+        {
+            if(loads[thread_index] < loads[least_loaded])
+            {
+                least_loaded = thread_index;
+            }
+        }
+
+        sort.ranges[range_index].thread_index = least_loaded;
+        loads[least_loaded] += sort.ranges[range_index].count;
+    }
+
+    parallel_run(sort_ranges_task, &sort, thread_count);
+}
+
+static void sort_keys(SortKey* keys, int count, const AftStringSortOptions* options)
+{
+    for(int key_index = 0; key_index < count; key_index += 1)
+    {
+        load_cache(&keys[key_index], 0, options->order);
+    }
+
+    int thread_count = parallel_clamp_thread_count(options->thread_count);
+
+    if(thread_count > 1 && count >= PARALLEL_SORT_MIN_COUNT)
+    {
+        sort_keys_in_parallel(keys, count, options->order, thread_count);
+    }
+    else
+    {
+        SortRange range =
+        {
+            .keys = keys,
+            .count = count,
+            .depth = 0,
+        };
+        multikey_quicksort(range, options->order);
+    }
+}
+
+static SortKey* allocate_keys(int count, void* allocator, AftMemoryBlock* block)
+{
+    *block = aft_allocate(allocator, sizeof(SortKey) * (uint64_t) count);
+    return (SortKey*) block->memory;
+}
+
+
+bool aft_string_sort(AftString* strings, int count, const AftStringSortOptions* options)
+{
+    return aft_string_sort_with_allocator(strings, count, options, NULL);
+}
+
+bool aft_string_sort_with_allocator(AftString* strings, int count, const AftStringSortOptions* options, void* allocator)
+{
+    AFT_ASSERT(strings || count == 0);
+    AFT_ASSERT(count >= 0);
+    AFT_ASSERT(options);
+
+    if(count < 2)
+    {
+        return true;
+    }
+
+    AftMemoryBlock block;
+    SortKey* keys = allocate_keys(count, allocator, &block);
+
+    if(!keys)
+    {
+        return false;
+    }
+
+    for(int string_index = 0; string_index < count; string_index += 1)
+    {
+        keys[string_index].contents = aft_string_get_contents_const(&strings[string_index]);
+        keys[string_index].count = aft_string_get_count(&strings[string_index]);
+        keys[string_index].index = string_index;
+    }
+
+    sort_keys(keys, count, options);
+
+    // Move each string into place by following the cycles of the permutation,
+    // marking each position done by pointing its key back at itself.
+    for(int cycle_start = 0; cycle_start < count; cycle_start += 1)
+    {
+        if(keys[cycle_start].index == cycle_start)
+        {
+            continue;
+        }
+
+        AftString first = strings[cycle_start];
+        int position = cycle_start;
+
+        for(;;)
+        {
+            int source = keys[position].index;
+            keys[position].index = position;
+
+            if(source == cycle_start)
+            {
+                strings[position] = first;
+                break;
+            }
+
+            strings[position] = strings[source];
+            position = source;
+        }
+    }
+
+    aft_deallocate(allocator, block);
+
+    return true;
+}
+
+bool aft_string_slice_sort(AftStringSlice* slices, int count, const AftStringSortOptions* options)
+{
+    return aft_string_slice_sort_with_allocator(slices, count, options, NULL);
+}
+
+bool aft_string_slice_sort_with_allocator(AftStringSlice* slices, int count, const AftStringSortOptions* options, void* allocator)
+{
+    AFT_ASSERT(slices || count == 0);
+    AFT_ASSERT(count >= 0);
+    AFT_ASSERT(options);
+
+    if(count < 2)
+    {
+        return true;
+    }
+
+    AftMemoryBlock block;
+    SortKey* keys = allocate_keys(count, allocator, &block);
+
+    if(!keys)
+    {
+        return false;
+    }
+
+    for(int slice_index = 0; slice_index < count; slice_index += 1)
+    {
+        keys[slice_index].contents = aft_string_slice_start(slices[slice_index]);
+        keys[slice_index].count = aft_string_slice_count(slices[slice_index]);
+        keys[slice_index].index = slice_index;
+    }
+
+    sort_keys(keys, count, options);
+
+    for(int slice_index = 0; slice_index < count; slice_index += 1)
+    {
+        slices[slice_index] = aft_string_slice_from_buffer(keys[slice_index].contents, keys[slice_index].count);
+    }
+
+    aft_deallocate(allocator, block);
+
+    return true;
+}
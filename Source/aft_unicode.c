@@ -0,0 +1,122 @@
+#include <AftString/aft_unicode.h>
+
+#include "unicode_data.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+#define AFT_CLASSIFY_BATCH_CAP 64
+#define AFT_CODEPOINT_MAX 0x10ffff
+
+
+static bool category_in_range(char32_t c, AftUnicodeCategory first, AftUnicodeCategory last)
+{
+    AftUnicodeCategory category = aft_unicode_get_category(c);
+    return category >= first && category <= last;
+}
+
+
+AftMaybeInt aft_unicode_classify(AftStringSlice slice, uint8_t* classes, int cap)
+{
+    AFT_ASSERT(classes || cap == 0);
+
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, slice);
+
+    char32_t codepoints[AFT_CLASSIFY_BATCH_CAP];
+    int count = 0;
+
+    for(;;)
+    {
+        int max = cap - count;
+        if(max > AFT_CLASSIFY_BATCH_CAP)
+        {
+            max = AFT_CLASSIFY_BATCH_CAP;
+        }
+
+        int batch_count = aft_codepoint_iterator_next_batch(&it, codepoints, max);
+
+        for(int codepoint_index = 0; codepoint_index < batch_count; codepoint_index += 1)
+        {
+            classes[count + codepoint_index] = unicode_class_lookup(codepoints[codepoint_index]);
+        }
+
+        count += batch_count;
+
+        if(batch_count < max || count == cap)
+        {
+            break;
+        }
+    }
+
+    // Stopping early means either the slice wasn't valid UTF-8 or there
+    // wasn't room for every class.
+    AftMaybeInt result;
+    result.value = count;
+    result.valid = aft_codepoint_iterator_get_index(&it) == aft_string_slice_count(slice);
+    return result;
+}
+
+AftUnicodeCategory aft_unicode_get_category(char32_t c)
+{
+    return (AftUnicodeCategory) (aft_unicode_get_class(c) & AFT_UNICODE_CLASS_CATEGORY_MASK);
+}
+
+uint8_t aft_unicode_get_class(char32_t c)
+{
+    if(c > AFT_CODEPOINT_MAX)
+    {
+        return AFT_UNICODE_CATEGORY_UNASSIGNED;
+    }
+
+    return unicode_class_lookup(c);
+}
+
+bool aft_unicode_is_alphabetic(char32_t c)
+{
+    return aft_unicode_get_class(c) & AFT_UNICODE_CLASS_ALPHABETIC;
+}
+
+bool aft_unicode_is_alphanumeric(char32_t c)
+{
+    return aft_unicode_is_alphabetic(c) || aft_unicode_is_numeric(c);
+}
+
+bool aft_unicode_is_letter(char32_t c)
+{
+    return category_in_range(c, AFT_UNICODE_CATEGORY_UPPERCASE_LETTER, AFT_UNICODE_CATEGORY_OTHER_LETTER);
+}
+
+bool aft_unicode_is_lowercase(char32_t c)
+{
+    return aft_unicode_get_category(c) == AFT_UNICODE_CATEGORY_LOWERCASE_LETTER;
+}
+
+bool aft_unicode_is_mark(char32_t c)
+{
+    return category_in_range(c, AFT_UNICODE_CATEGORY_NONSPACING_MARK, AFT_UNICODE_CATEGORY_ENCLOSING_MARK);
+}
+
+bool aft_unicode_is_numeric(char32_t c)
+{
+    return aft_unicode_get_category(c) == AFT_UNICODE_CATEGORY_DECIMAL_NUMBER;
+}
+
+bool aft_unicode_is_punctuation(char32_t c)
+{
+    return category_in_range(c, AFT_UNICODE_CATEGORY_CONNECTOR_PUNCTUATION, AFT_UNICODE_CATEGORY_OTHER_PUNCTUATION);
+}
+
+bool aft_unicode_is_uppercase(char32_t c)
+{
+    return aft_unicode_get_category(c) == AFT_UNICODE_CATEGORY_UPPERCASE_LETTER;
+}
+
+bool aft_unicode_is_whitespace(char32_t c)
+{
+    return aft_unicode_get_class(c) & AFT_UNICODE_CLASS_WHITESPACE;
+}
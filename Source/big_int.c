@@ -352,6 +352,33 @@ BigInt big_int_multiply_by_pow10(const BigInt* a, uint32_t exponent)
     return *current_temp;
 }
 
+BigInt big_int_multiply_by_pow5(const BigInt* a, uint32_t exponent)
+{
+    // 5^13 is the largest power of five that fits in 32 bits.
+    const uint32_t pow5_13 = UINT32_C(1220703125);
+
+    BigInt result = *a;
+
+    for(; exponent >= 13; exponent -= 13)
+    {
+        result = big_int_multiply_uint32(&result, pow5_13);
+    }
+
+    uint32_t small_power = 1;
+
+    for(; exponent > 0; exponent -= 1)
+    {
+        small_power *= 5;
+    }
+
+    if(small_power != 1)
+    {
+        result = big_int_multiply_uint32(&result, small_power);
+    }
+
+    return result;
+}
+
 BigInt big_int_multiply_by_2(const BigInt* a)
 {
     BigInt result;
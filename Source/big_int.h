@@ -4,7 +4,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#define BIG_INT_BLOCK_CAP 35
+// This is enough for the 800 significant digits that parsing a double
+// compares exactly, which is more than formatting one needs.
+#define BIG_INT_BLOCK_CAP 85
 
 typedef struct BigInt
 {
@@ -20,6 +22,7 @@ void big_int_double(BigInt* a);
 bool big_int_is_zero(const BigInt* a);
 BigInt big_int_multiply(const BigInt* a, const BigInt* b);
 BigInt big_int_multiply_by_pow10(const BigInt* a, uint32_t exponent);
+BigInt big_int_multiply_by_pow5(const BigInt* a, uint32_t exponent);
 BigInt big_int_multiply_by_2(const BigInt* a);
 BigInt big_int_multiply_uint32(const BigInt* a, uint32_t b);
 BigInt big_int_pow10(uint32_t exponent);
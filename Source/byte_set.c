@@ -0,0 +1,231 @@
+#include "byte_set.h"
+
+#include <assert.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+#define BYTE_SET_VECTOR_CAP 4
+
+
+void byte_set_add(AftByteSet* set, char c)
+{
+    AFT_ASSERT(set);
+
+    if(byte_set_contains(set, c))
+    {
+        return;
+    }
+
+    uint8_t byte = (uint8_t) c;
+    set->bits[byte >> 6] |= UINT64_C(1) << (byte & 63);
+
+    if(set->count < BYTE_SET_VECTOR_CAP)
+    {
+        set->bytes[set->count] = c;
+    }
+
+    set->count += 1;
+}
+
+void byte_set_clear(AftByteSet* set)
+{
+    AFT_ASSERT(set);
+
+    for(int word_index = 0; word_index < 4; word_index += 1)
+    {
+        set->bits[word_index] = 0;
+    }
+
+    set->count = 0;
+}
+
+bool byte_set_contains(const AftByteSet* set, char c)
+{
+    AFT_ASSERT(set);
+
+    uint8_t byte = (uint8_t) c;
+    return (set->bits[byte >> 6] >> (byte & 63)) & 1;
+}
+
+// Find the next byte in the set at or after the given index. The mask of the
+// block that index is in is kept by the caller, so that a series of searches
+// moving forward through a string only match each block once. The mask start
+// should be set to -BYTE_SET_BLOCK_SIZE before the first search.
+AftMaybeInt byte_set_find(const AftByteSet* set, AftStringSlice slice, int from, uint64_t* mask, int* mask_start)
+{
+    AFT_ASSERT(set);
+    AFT_ASSERT(mask);
+    AFT_ASSERT(mask_start);
+
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+
+    while(from < count)
+    {
+        int block_start = from - (from % BYTE_SET_BLOCK_SIZE);
+
+        if(block_start != *mask_start)
+        {
+            int block_count = count - block_start;
+            if(block_count > BYTE_SET_BLOCK_SIZE)
+            {
+                block_count = BYTE_SET_BLOCK_SIZE;
+            }
+
+            *mask = byte_set_match_block(set, &contents[block_start], block_count);
+            *mask_start = block_start;
+        }
+
+        uint64_t remaining = *mask & (~UINT64_C(0) << (from - block_start));
+
+        if(remaining)
+        {
+            AftMaybeInt result = {block_start + count_trailing_zeros64(remaining), true};
+            return result;
+        }
+
+        from = block_start + BYTE_SET_BLOCK_SIZE;
+    }
+
+    AftMaybeInt result = {0, false};
+    return result;
+}
+
+static uint64_t match_block_by_table(const AftByteSet* set, const char* block, int count)
+{
+    uint64_t mask = 0;
+
+    for(int byte_index = 0; byte_index < count; byte_index += 1)
+    {
+        uint64_t match = byte_set_contains(set, block[byte_index]);
+        mask |= match << byte_index;
+    }
+
+    return mask;
+}
+
+#if defined(USE_SSE2)
+
+static uint64_t match_full_block_sse2(const AftByteSet* set, const char* block)
+{
+    uint64_t mask = 0;
+
+    for(int lane = 0; lane < 4; lane += 1)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*) &block[16 * lane]);
+        __m128i matches = _mm_setzero_si128();
+
+        for(int set_index = 0; set_index < set->count; set_index += 1)
+        {
+            __m128i delimiter = _mm_set1_epi8(set->bytes[set_index]);
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(bytes, delimiter));
+        }
+
+        uint64_t lane_mask = (uint32_t) _mm_movemask_epi8(matches);
+        mask |= lane_mask << (16 * lane);
+    }
+
+    return mask;
+}
+
+#endif // defined(USE_SSE2)
+
+// Produce a mask with a bit set for each byte of the block that's in the set,
+// with the first byte in the lowest bit. Sets of a few bytes are compared
+// sixteen bytes at a time when vector instructions are available.
+uint64_t byte_set_match_block(const AftByteSet* set, const char* block, int count)
+{
+    AFT_ASSERT(set);
+    AFT_ASSERT(count >= 0 && count <= BYTE_SET_BLOCK_SIZE);
+
+#if defined(USE_SSE2)
+    if(set->count <= BYTE_SET_VECTOR_CAP)
+    {
+        if(count == BYTE_SET_BLOCK_SIZE)
+        {
+            return match_full_block_sse2(set, block);
+        }
+        else if(count > 0)
+        {
+            char padded[BYTE_SET_BLOCK_SIZE] = {0};
+
+            for(int byte_index = 0; byte_index < count; byte_index += 1)
+            {
+                padded[byte_index] = block[byte_index];
+            }
+
+            uint64_t valid = (UINT64_C(1) << count) - 1;
+            return match_full_block_sse2(set, padded) & valid;
+        }
+        else
+        {
+            return 0;
+        }
+    }
+#endif // defined(USE_SSE2)
+
+    return match_block_by_table(set, block, count);
+}
+
+int count_leading_zeros64(uint64_t value)
+{
+    AFT_ASSERT(value);
+
+#if defined(__GNUC__)
+    return __builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return 63 - (int) index;
+#else
+    int count = 0;
+    for(; !(value & UINT64_C(0x8000000000000000)); value <<= 1)
+    {
+        count += 1;
+    }
+    return count;
+#endif
+}
+
+int count_set_bits64(uint64_t value)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(value);
+#else
+    value = value - ((value >> 1) & UINT64_C(0x5555555555555555));
+    value = (value & UINT64_C(0x3333333333333333)) + ((value >> 2) & UINT64_C(0x3333333333333333));
+    value = (value + (value >> 4)) & UINT64_C(0x0f0f0f0f0f0f0f0f);
+    return (int) ((value * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+int count_trailing_zeros64(uint64_t value)
+{
+    AFT_ASSERT(value);
+
+#if defined(__GNUC__)
+    return __builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return (int) index;
+#else
+    int count = 0;
+    for(; !(value & 1); value >>= 1)
+    {
+        count += 1;
+    }
+    return count;
+#endif
+}
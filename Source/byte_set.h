@@ -0,0 +1,20 @@
+#ifndef BYTE_SET_H_
+#define BYTE_SET_H_
+
+#include <AftString/aft_string.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BYTE_SET_BLOCK_SIZE 64
+
+void byte_set_add(AftByteSet* set, char c);
+void byte_set_clear(AftByteSet* set);
+bool byte_set_contains(const AftByteSet* set, char c);
+AftMaybeInt byte_set_find(const AftByteSet* set, AftStringSlice slice, int from, uint64_t* mask, int* mask_start);
+uint64_t byte_set_match_block(const AftByteSet* set, const char* block, int count);
+int count_leading_zeros64(uint64_t value);
+int count_set_bits64(uint64_t value);
+int count_trailing_zeros64(uint64_t value);
+
+#endif // BYTE_SET_H_
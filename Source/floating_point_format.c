@@ -1,6 +1,7 @@
 #include "floating_point_format.h"
 
 #include "big_int.h"
+#include "power_tables.h"
 
 #include <assert.h>
 #include <math.h>
@@ -10,6 +11,13 @@
 #define AFT_ASSERT(expression) \
     assert(expression)
 
+#define FIXED_FRACTION_MARGIN 64
+#define FIXED_MAX_DIGITS 18
+
+#if defined(__SIZEOF_INT128__)
+#define USE_UINT128
+#endif
+
 
 typedef union Ieee754Binary32OrFloat
 {
@@ -45,6 +53,22 @@ typedef struct FloatParts
     bool sign;
 } FloatParts;
 
+typedef struct FixedPoint
+{
+    uint64_t integer;
+    uint64_t fraction;
+} FixedPoint;
+
+// How the rest of a value past its last digit compares with half of that
+// digit's place.
+typedef enum Remainder
+{
+    REMAINDER_ZERO,
+    REMAINDER_BELOW_HALF,
+    REMAINDER_HALF,
+    REMAINDER_ABOVE_HALF,
+} Remainder;
+
 
 static uint32_t log2_uint32(uint32_t x)
 {
@@ -91,6 +115,17 @@ static uint32_t log2_uint32(uint32_t x)
     return log_table[x];
 }
 
+static uint32_t log2_uint64(uint64_t x)
+{
+    uint32_t high = (uint32_t) (x >> 32);
+    if(high)
+    {
+        return 32 + log2_uint32(high);
+    }
+
+    return log2_uint32((uint32_t) x);
+}
+
 static FloatParts unpack_binary32(const Ieee754Binary32OrFloat* binary32)
 {
     if(binary32->exponent != 0)
@@ -144,7 +179,7 @@ static FloatParts unpack_binary64(const Ieee754Binary64OrDouble* binary64)
         FloatParts result =
         {
             .mantissa = binary64->fraction,
-            .mantissa_high_bit = log2_uint32((uint32_t) binary64->fraction),
+            .mantissa_high_bit = log2_uint64(binary64->fraction),
             .exponent = 1 - 1023,
             .factored_exponent = 1 - 1023 - 52,
             .has_unequal_margins = false,
@@ -155,10 +190,10 @@ static FloatParts unpack_binary64(const Ieee754Binary64OrDouble* binary64)
     }
 }
 
-static DecimalQuantity handle_nan_or_infinity(const FloatParts* value, void* allocator)
+static DecimalQuantity handle_nan_or_infinity(const FloatParts* value)
 {
     DecimalQuantity result;
-    aft_string_initialise_with_allocator(&result.digits, allocator);
+    result.digits_count = 0;
 
     if((((UINT64_C(1) << value->mantissa_high_bit) - 1) & value->mantissa) == 0)
     {
@@ -173,15 +208,158 @@ static DecimalQuantity handle_nan_or_infinity(const FloatParts* value, void* all
     return result;
 }
 
-static DecimalQuantity dragon4(const FloatParts* parts, const FloatFormat* format, void* allocator)
+static bool should_round_down(AftDecimalFormatRoundingMode rounding_mode, bool sign, Remainder remainder, uint32_t output_digit)
+{
+    bool round_down = false;
+
+    switch(rounding_mode)
+    {
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_CEILING:
+        {
+            round_down = remainder == REMAINDER_ZERO || sign;
+            break;
+        }
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_DOWN:
+        {
+            round_down = true;
+            break;
+        }
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_FLOOR:
+        {
+            round_down = remainder == REMAINDER_ZERO || !sign;
+            break;
+        }
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_HALF_DOWN:
+        {
+            round_down = remainder <= REMAINDER_HALF;
+            break;
+        }
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_HALF_EVEN:
+        {
+            round_down = remainder < REMAINDER_HALF
+                    || (remainder == REMAINDER_HALF && (output_digit & 1) == 0);
+            break;
+        }
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_HALF_UP:
+        {
+            round_down = remainder < REMAINDER_HALF;
+            break;
+        }
+        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_UP:
+        {
+            round_down = remainder == REMAINDER_ZERO;
+            break;
+        }
+    }
+
+    return round_down;
+}
+
+static void append_digit(DecimalQuantity* quantity, uint32_t digit)
+{
+    AFT_ASSERT(quantity->digits_count < DECIMAL_QUANTITY_DIGITS_CAP);
+    quantity->digits[quantity->digits_count] = (char) digit;
+    quantity->digits_count += 1;
+}
+
+static void set_digits(DecimalQuantity* quantity, uint64_t value)
+{
+    int count = 1;
+
+    for(uint64_t rest = value / 10; rest; rest /= 10)
+    {
+        count += 1;
+    }
+
+    for(int digit_index = count - 1; digit_index >= 0; digit_index -= 1)
+    {
+        quantity->digits[digit_index] = (char) (value % 10);
+        value /= 10;
+    }
+
+    quantity->digits_count = count;
+}
+
+// Append the last digit, rounded up if needed, then drop the trailing zeros
+// past the minimum number of digits.
+static void finish_digits(DecimalQuantity* result, const FloatFormat* format, uint32_t output_digit, bool round_down)
+{
+    if(round_down)
+    {
+        append_digit(result, output_digit);
+    }
+    else
+    {
+        if(output_digit == 9)
+        {
+            for(int digit_index = result->digits_count;;)
+            {
+                if(digit_index == 0)
+                {
+                    append_digit(result, 1);
+                    result->exponent += 1;
+                    break;
+                }
+
+                digit_index -= 1;
+
+                if(result->digits[digit_index] != 9)
+                {
+                    result->digits[digit_index] += 1;
+                    break;
+                }
+
+                result->digits_count -= 1;
+            }
+        }
+        else
+        {
+            append_digit(result, output_digit + 1);
+        }
+    }
+
+    int min_digits = 1;
+    switch(format->cutoff_mode)
+    {
+        case CUTOFF_MODE_FRACTION_DIGITS:
+        {
+            int integer_digits = result->digits_count - result->exponent;
+            min_digits = integer_digits + format->min_fraction_digits;
+            break;
+        }
+        case CUTOFF_MODE_SIGNIFICANT_DIGITS:
+        {
+            min_digits = format->min_significant_digits;
+            break;
+        }
+        case CUTOFF_MODE_SHORTEST:
+        {
+            // Shortest digits come from shortest_quantity, never dragon4.
+            AFT_ASSERT(false);
+            break;
+        }
+    }
+
+    while(result->digits_count > min_digits && result->digits[result->digits_count - 1] == 0)
+    {
+        result->digits_count -= 1;
+    }
+
+    if(result->digits_count == 1 && result->digits[0] == 0)
+    {
+        result->sign = false;
+    }
+}
+
+static DecimalQuantity dragon4(const FloatParts* parts, const FloatFormat* format)
 {
     DecimalQuantity result;
-    aft_string_initialise_with_allocator(&result.digits, allocator);
+    result.digits_count = 0;
     result.type = DECIMAL_QUANTITY_TYPE_NORMAL;
 
     if(parts->mantissa == 0)
     {
-        aft_string_append_char(&result.digits, 0);
+        append_digit(&result, 0);
         result.exponent = 0;
         result.sign = false;
         return result;
@@ -236,8 +414,11 @@ static DecimalQuantity dragon4(const FloatParts* parts, const FloatFormat* forma
         scaled_margin_high = &scaled_margin_low;
     }
 
+    // Estimate from the highest set bit, since a subnormal mantissa doesn't
+    // start at bit 52.
     const double log10_2 = 0.30102999566398119521373889472449;
-    int32_t estimated_exponent = (int32_t) ceil(log10_2 * parts->exponent - 0.69);
+    int32_t high_bit_exponent = (int32_t) parts->mantissa_high_bit + parts->factored_exponent;
+    int32_t estimated_exponent = (int32_t) ceil(log10_2 * high_bit_exponent - 0.69);
 
     if(format->cutoff_mode == CUTOFF_MODE_FRACTION_DIGITS
             && estimated_exponent <= -(int32_t) format->max_fraction_digits)
@@ -277,7 +458,7 @@ static DecimalQuantity dragon4(const FloatParts* parts, const FloatFormat* forma
     }
 
     int32_t digit_exponent = estimated_exponent;
-    int32_t cutoff_exponent;
+    int32_t cutoff_exponent = digit_exponent;
 
     switch(format->cutoff_mode)
     {
@@ -291,6 +472,11 @@ static DecimalQuantity dragon4(const FloatParts* parts, const FloatFormat* forma
             cutoff_exponent = digit_exponent - (int32_t) format->max_significant_digits;
             break;
         }
+        case CUTOFF_MODE_SHORTEST:
+        {
+            AFT_ASSERT(false);
+            break;
+        }
     }
 
     result.exponent = digit_exponent;
@@ -328,177 +514,674 @@ static DecimalQuantity dragon4(const FloatParts* parts, const FloatFormat* forma
             break;
         }
 
-        aft_string_append_char(&result.digits, output_digit);
+        append_digit(&result, output_digit);
 
         big_int_decuple(&scaled_value);
     }
 
-    bool round_down = false;
+    Remainder remainder = REMAINDER_ZERO;
 
-    switch(format->rounding_mode)
+    if(!big_int_is_zero(&scaled_value))
     {
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_CEILING:
+        big_int_double(&scaled_value);
+        int32_t compare = big_int_compare(&scaled_value, &scale);
+
+        if(compare < 0)
         {
-            round_down = big_int_is_zero(&scaled_value) || result.sign;
-            break;
+            remainder = REMAINDER_BELOW_HALF;
         }
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_DOWN:
+        else if(compare == 0)
         {
-            round_down = true;
-            break;
+            remainder = REMAINDER_HALF;
         }
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_FLOOR:
+        else
         {
-            round_down = big_int_is_zero(&scaled_value) || !result.sign;
-            break;
+            remainder = REMAINDER_ABOVE_HALF;
         }
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_HALF_DOWN:
-        {
-            big_int_double(&scaled_value);
-            int32_t compare = big_int_compare(&scaled_value, &scale);
-            round_down = compare < 0;
+    }
+
+    bool round_down = should_round_down(format->rounding_mode, result.sign, remainder, output_digit);
+    finish_digits(&result, format, output_digit, round_down);
+
+    return result;
+}
+
+// This is the Ryū algorithm, from "Ryū: Fast Float-to-String Conversion" by
+// Ulf Adams. It finds the shortest digits that still read back as the same
+// value using the bounds of the interval that rounds to it, each scaled by a
+// power of ten with one 64 × 128-bit multiply.
+
+// The bit length of 5^e, for e >= 1, and 1 for e = 0.
+static int32_t pow5_bits(int32_t e)
+{
+    return (int32_t) (((uint32_t) e * 1217359) >> 19) + 1;
+}
+
+// floor(log10(2^e)), for 0 <= e <= 1650.
+static int32_t log10_pow2(int32_t e)
+{
+    return (int32_t) (((uint32_t) e * 78913) >> 18);
+}
+
+// floor(log10(5^e)), for 0 <= e <= 2620.
+static int32_t log10_pow5(int32_t e)
+{
+    return (int32_t) (((uint32_t) e * 732923) >> 20);
+}
 
-            if(compare == 0)
+static int pow5_factor(uint64_t value)
+{
+    int count = 0;
+
+    while(value % 5 == 0)
+    {
+        value /= 5;
+        count += 1;
+    }
+
+    return count;
+}
+
+static bool is_multiple_of_pow5(uint64_t value, int32_t p)
+{
+    return pow5_factor(value) >= p;
+}
+
+static bool is_multiple_of_pow2(uint64_t value, int32_t p)
+{
+    return (value & ((UINT64_C(1) << p) - 1)) == 0;
+}
+
+#if !defined(USE_UINT128)
+
+static uint64_t multiply_128(uint64_t a, uint64_t b, uint64_t* high)
+{
+    uint64_t a_low = (uint32_t) a;
+    uint64_t a_high = a >> 32;
+    uint64_t b_low = (uint32_t) b;
+    uint64_t b_high = b >> 32;
+
+    uint64_t low_low = a_low * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t high_low = a_high * b_low;
+    uint64_t high_high = a_high * b_high;
+
+    uint64_t middle = (low_low >> 32) + (uint32_t) high_low + (uint32_t) low_high;
+    *high = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+
+    return (middle << 32) | (uint32_t) low_low;
+}
+
+#endif // !defined(USE_UINT128)
+
+// Multiply by a 128-bit table entry and shift the product right by j, for
+// 64 <= j < 128.
+static uint64_t multiply_shift(uint64_t m, const uint64_t* factor, int32_t j)
+{
+    AFT_ASSERT(j >= 64 && j < 128);
+
+#if defined(USE_UINT128)
+    unsigned __int128 low = (unsigned __int128) m * factor[0];
+    unsigned __int128 high = (unsigned __int128) m * factor[1];
+    return (uint64_t) (((low >> 64) + high) >> (j - 64));
+#else
+    uint64_t low_high;
+    multiply_128(m, factor[0], &low_high);
+
+    uint64_t high_high;
+    uint64_t high_low = multiply_128(m, factor[1], &high_high);
+
+    uint64_t sum = high_low + low_high;
+    high_high += sum < high_low;
+
+    int32_t shift = j - 64;
+    if(shift == 0)
+    {
+        return sum;
+    }
+    return (high_high << (64 - shift)) | (sum >> shift);
+#endif // defined(USE_UINT128)
+}
+
+static DecimalFloat shortest(const FloatParts* parts)
+{
+    DecimalFloat result = {0, 0};
+
+    if(parts->mantissa == 0)
+    {
+        return result;
+    }
+
+    // The interval is worked out in units of a quarter of the last place,
+    // so its bounds are whole numbers. The lower margin is half as wide at
+    // a power of two, except the smallest normal one.
+    int32_t e2 = parts->factored_exponent - 2;
+    uint64_t m2 = parts->mantissa;
+    uint64_t mv = 4 * m2;
+    uint64_t mm_shift = !parts->has_unequal_margins;
+    bool accept_bounds = (m2 & 1) == 0;
+
+    uint64_t vr;
+    uint64_t vp;
+    uint64_t vm;
+    int32_t e10;
+    bool vm_is_trailing_zeros = false;
+    bool vr_is_trailing_zeros = false;
+
+    if(e2 >= 0)
+    {
+        int32_t q = log10_pow2(e2) - (e2 > 3);
+        int32_t k = POW5_INVERSE_BITCOUNT + pow5_bits(q) - 1;
+        int32_t i = -e2 + q + k;
+        const uint64_t* factor = pow5_inverse_split[q];
+
+        e10 = q;
+        vr = multiply_shift(mv, factor, i);
+        vp = multiply_shift(mv + 2, factor, i);
+        vm = multiply_shift(mv - 1 - mm_shift, factor, i);
+
+        // The digits removed are only all zeros when the scaled number is a
+        // multiple of 5^q, which can't happen for a larger q. At most one of
+        // the value and its bounds can be a multiple of 5.
+        if(q <= 21)
+        {
+            if(mv % 5 == 0)
             {
-                round_down = true;
+                vr_is_trailing_zeros = is_multiple_of_pow5(mv, q);
+            }
+            else if(accept_bounds)
+            {
+                vm_is_trailing_zeros = is_multiple_of_pow5(mv - 1 - mm_shift, q);
+            }
+            else
+            {
+                vp -= is_multiple_of_pow5(mv + 2, q);
             }
-            break;
         }
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_HALF_EVEN:
+    }
+    else
+    {
+        int32_t q = log10_pow5(-e2) - (-e2 > 1);
+        int32_t i = -e2 - q;
+        int32_t k = pow5_bits(i) - POW5_BITCOUNT;
+        int32_t j = q - k;
+        const uint64_t* factor = pow5_split[i];
+
+        e10 = q + e2;
+        vr = multiply_shift(mv, factor, j);
+        vp = multiply_shift(mv + 2, factor, j);
+        vm = multiply_shift(mv - 1 - mm_shift, factor, j);
+
+        if(q <= 1)
         {
-            big_int_double(&scaled_value);
-            int32_t compare = big_int_compare(&scaled_value, &scale);
-            round_down = compare < 0;
+            // The value is four times the mantissa, so it always has at
+            // least two trailing zero bits.
+            vr_is_trailing_zeros = true;
 
-            if(compare == 0)
+            if(accept_bounds)
             {
-                round_down = (output_digit & 1) == 0;
+                vm_is_trailing_zeros = mm_shift == 1;
+            }
+            else
+            {
+                vp -= 1;
             }
-            break;
         }
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_HALF_UP:
+        else if(q < 63)
+        {
+            vr_is_trailing_zeros = is_multiple_of_pow2(mv, q);
+        }
+    }
+
+    // Remove digits while the bounds still differ, keeping the last one
+    // removed from the value to round by.
+    int32_t removed = 0;
+    int last_removed_digit = 0;
+    uint64_t output;
+
+    if(vm_is_trailing_zeros || vr_is_trailing_zeros)
+    {
+        for(; vp / 10 > vm / 10; removed += 1)
         {
-            big_int_double(&scaled_value);
-            int32_t compare = big_int_compare(&scaled_value, &scale);
-            round_down = compare < 0;
+            vm_is_trailing_zeros = vm_is_trailing_zeros && vm % 10 == 0;
+            vr_is_trailing_zeros = vr_is_trailing_zeros && last_removed_digit == 0;
+            last_removed_digit = (int) (vr % 10);
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
 
-            if(compare == 0)
+        if(vm_is_trailing_zeros)
+        {
+            for(; vm % 10 == 0; removed += 1)
             {
-                round_down = false;
+                vr_is_trailing_zeros = vr_is_trailing_zeros && last_removed_digit == 0;
+                last_removed_digit = (int) (vr % 10);
+                vr /= 10;
+                vp /= 10;
+                vm /= 10;
             }
-            break;
         }
-        case AFT_DECIMAL_FORMAT_ROUNDING_MODE_UP:
+
+        // Exactly halfway rounds to even.
+        if(vr_is_trailing_zeros && last_removed_digit == 5 && vr % 2 == 0)
         {
-            round_down = big_int_is_zero(&scaled_value);
-            break;
+            last_removed_digit = 4;
         }
+
+        bool at_lower_bound = vr == vm && (!accept_bounds || !vm_is_trailing_zeros);
+        output = vr + (at_lower_bound || last_removed_digit >= 5);
     }
+    else
+    {
+        bool round_up = false;
 
-    if(round_down)
+        if(vp / 100 > vm / 100)
+        {
+            round_up = vr % 100 >= 50;
+            vr /= 100;
+            vp /= 100;
+            vm /= 100;
+            removed += 2;
+        }
+
+        for(; vp / 10 > vm / 10; removed += 1)
+        {
+            round_up = vr % 10 >= 5;
+            vr /= 10;
+            vp /= 10;
+            vm /= 10;
+        }
+
+        output = vr + (vr == vm || round_up);
+    }
+
+    int32_t exponent = e10 + removed;
+
+    while(output % 10 == 0)
     {
-        aft_string_append_char(&result.digits, output_digit);
+        output /= 10;
+        exponent += 1;
     }
-    else
+
+    result.significand = output;
+    result.exponent = exponent;
+
+    return result;
+}
+
+static DecimalQuantity shortest_quantity(const FloatParts* parts)
+{
+    DecimalQuantity result;
+    result.type = DECIMAL_QUANTITY_TYPE_NORMAL;
+    result.sign = parts->sign && parts->mantissa != 0;
+
+    DecimalFloat decimal = shortest(parts);
+    set_digits(&result, decimal.significand);
+    result.exponent = parts->mantissa ? decimal.exponent + result.digits_count : 0;
+
+    return result;
+}
+
+// Fixed precision digits without big integers. The value is scaled by a
+// power of ten to put the last digit wanted in the ones place, using the
+// same tables as Ryū. That product is off by a few units of its 64 fraction
+// bits at most, so a fraction too close to zero or a half to call is checked
+// exactly. When that can't settle it either, dragon4 is left to do it.
+
+// floor(log10(2^e)), for -1650 <= e <= 1650.
+static int32_t floor_log10_pow2(int32_t e)
+{
+    return e >= 0 ? log10_pow2(e) : -log10_pow2(-e) - 1;
+}
+
+static uint64_t get_product_word(const uint64_t* product, int index)
+{
+    return index < 3 ? product[index] : 0;
+}
+
+// Multiply by a 128-bit table entry and shift the product right by j, giving
+// a number with 64 integer bits and 64 fraction bits.
+static bool multiply_shift_fixed(uint64_t m, const uint64_t* factor, int32_t j, FixedPoint* result)
+{
+    if(j <= 0 || j >= 192)
     {
-        if(output_digit == 9)
+        return false;
+    }
+
+    uint64_t product[3];
+
+#if defined(USE_UINT128)
+    unsigned __int128 low = (unsigned __int128) m * factor[0];
+    unsigned __int128 high = (unsigned __int128) m * factor[1] + (uint64_t) (low >> 64);
+    product[0] = (uint64_t) low;
+    product[1] = (uint64_t) high;
+    product[2] = (uint64_t) (high >> 64);
+#else
+    uint64_t low_high;
+    product[0] = multiply_128(m, factor[0], &low_high);
+
+    uint64_t high_high;
+    uint64_t high_low = multiply_128(m, factor[1], &high_high);
+
+    product[1] = high_low + low_high;
+    product[2] = high_high + (product[1] < high_low);
+#endif // defined(USE_UINT128)
+
+    int word = j / 64;
+    int shift = j % 64;
+    uint64_t words[3];
+
+    for(int word_index = 0; word_index < 3; word_index += 1)
+    {
+        words[word_index] = get_product_word(product, word + word_index) >> shift;
+
+        if(shift)
         {
-            char* contents = aft_string_get_contents(&result.digits);
+            words[word_index] |= get_product_word(product, word + word_index + 1) << (64 - shift);
+        }
+    }
 
-            for(int digit_index = aft_string_get_count(&result.digits);;)
-            {
-                if(digit_index == 0)
-                {
-                    aft_string_append_char(&result.digits, 1);
-                    result.exponent += 1;
-                    break;
-                }
+    if(words[2])
+    {
+        return false;
+    }
 
-                digit_index -= 1;
+    result->fraction = words[0];
+    result->integer = words[1];
 
-                if(contents[digit_index] != 9)
-                {
-                    contents[digit_index] += 1;
-                    break;
-                }
+    return true;
+}
 
-                aft_string_remove(&result.digits, digit_index, digit_index + 1);
-            }
+// Approximate the value × 10^k.
+static bool scale_by_pow10(const FloatParts* parts, int32_t k, FixedPoint* result)
+{
+    int32_t e2 = parts->factored_exponent;
+
+    if(k >= 0)
+    {
+        if(k >= (int32_t) (sizeof(pow5_split) / sizeof(*pow5_split)))
+        {
+            return false;
         }
-        else
+
+        int32_t j = POW5_BITCOUNT - 64 - pow5_bits(k) - e2 - k;
+        return multiply_shift_fixed(parts->mantissa, pow5_split[k], j, result);
+    }
+    else
+    {
+        if(-k >= (int32_t) (sizeof(pow5_inverse_split) / sizeof(*pow5_inverse_split)))
         {
-            aft_string_append_char(&result.digits, output_digit + 1);
+            return false;
         }
+
+        int32_t j = POW5_INVERSE_BITCOUNT - 64 + pow5_bits(-k) - 1 - e2 - k;
+        return multiply_shift_fixed(parts->mantissa, pow5_inverse_split[-k], j, result);
     }
+}
+
+static FixedPoint divide_fixed_by_10(FixedPoint value)
+{
+    // Divide the remainder and fraction 32 bits at a time.
+    uint64_t high = ((value.integer % 10) << 32) | (value.fraction >> 32);
+    uint64_t low = ((high % 10) << 32) | (uint32_t) value.fraction;
+
+    FixedPoint result;
+    result.integer = value.integer / 10;
+    result.fraction = ((high / 10) << 32) | (low / 10);
+
+    return result;
+}
+
+// Whether the value × 2^pow2 × 10^k is a whole number.
+static bool is_exact_scaled(const FloatParts* parts, int32_t k, int32_t pow2)
+{
+    int32_t e2 = parts->factored_exponent + k + pow2;
+
+    if(e2 < 0 && (e2 <= -64 || !is_multiple_of_pow2(parts->mantissa, -e2)))
+    {
+        return false;
+    }
+
+    return k >= 0 || is_multiple_of_pow5(parts->mantissa, -k);
+}
+
+// Work out how the rest of the value × 10^k compares with a half, from its
+// approximation. That's corrected if it's just under a whole number.
+static bool get_remainder(const FloatParts* parts, int32_t k, FixedPoint* value, Remainder* remainder)
+{
+    const uint64_t half = UINT64_C(1) << 63;
+    uint64_t fraction = value->fraction;
+
+    if(fraction >= FIXED_FRACTION_MARGIN && fraction <= half - FIXED_FRACTION_MARGIN)
+    {
+        *remainder = REMAINDER_BELOW_HALF;
+    }
+    else if(fraction >= half + FIXED_FRACTION_MARGIN && fraction <= UINT64_MAX - FIXED_FRACTION_MARGIN)
+    {
+        *remainder = REMAINDER_ABOVE_HALF;
+    }
+    else if(is_exact_scaled(parts, k, 0))
+    {
+        if(fraction >= half)
+        {
+            value->integer += 1;
+        }
+
+        *remainder = REMAINDER_ZERO;
+    }
+    else if(fraction > FIXED_FRACTION_MARGIN
+            && fraction < UINT64_MAX - FIXED_FRACTION_MARGIN
+            && is_exact_scaled(parts, k, 1))
+    {
+        *remainder = REMAINDER_HALF;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+// Find the same digits as dragon4, or return false if they can't be found
+// this way.
+static bool fixed_quantity(const FloatParts* parts, const FloatFormat* format, DecimalQuantity* result)
+{
+    static const uint64_t powers_of_ten[FIXED_MAX_DIGITS + 2] =
+    {
+        UINT64_C(1),
+        UINT64_C(10),
+        UINT64_C(100),
+        UINT64_C(1000),
+        UINT64_C(10000),
+        UINT64_C(100000),
+        UINT64_C(1000000),
+        UINT64_C(10000000),
+        UINT64_C(100000000),
+        UINT64_C(1000000000),
+        UINT64_C(10000000000),
+        UINT64_C(100000000000),
+        UINT64_C(1000000000000),
+        UINT64_C(10000000000000),
+        UINT64_C(100000000000000),
+        UINT64_C(1000000000000000),
+        UINT64_C(10000000000000000),
+        UINT64_C(100000000000000000),
+        UINT64_C(1000000000000000000),
+        UINT64_C(10000000000000000000),
+    };
+
+    AFT_ASSERT(parts->mantissa != 0);
+
+    // The value is at least 10^(digit_exponent - 1) and less than
+    // 10^(digit_exponent + 1).
+    int32_t digit_exponent = floor_log10_pow2(parts->exponent) + 1;
+    FixedPoint value = {0, 0};
+    Remainder remainder = REMAINDER_BELOW_HALF;
 
-    int min_digits;
     switch(format->cutoff_mode)
     {
         case CUTOFF_MODE_FRACTION_DIGITS:
         {
-            int integer_digits = aft_string_get_count(&result.digits) - result.exponent;
-            min_digits = integer_digits + format->min_fraction_digits;
+            int32_t k = format->max_fraction_digits;
+
+            if(k < 0 || digit_exponent + k > FIXED_MAX_DIGITS + 1)
+            {
+                return false;
+            }
+
+            // A value under a tenth of the last place leaves a zero digit.
+            if(digit_exponent + k >= 0
+                    && !(scale_by_pow10(parts, k, &value) && get_remainder(parts, k, &value, &remainder)))
+            {
+                return false;
+            }
+
+            digit_exponent = 1 - k;
+
+            for(uint64_t rest = value.integer / 10; rest; rest /= 10)
+            {
+                digit_exponent += 1;
+            }
             break;
         }
         case CUTOFF_MODE_SIGNIFICANT_DIGITS:
         {
-            min_digits = format->min_significant_digits;
+            int digits = format->max_significant_digits;
+
+            if(digits < 1 || digits > FIXED_MAX_DIGITS)
+            {
+                return false;
+            }
+
+            int32_t k = digits - digit_exponent;
+
+            if(!scale_by_pow10(parts, k, &value))
+            {
+                return false;
+            }
+
+            if(value.integer >= powers_of_ten[digits])
+            {
+                value = divide_fixed_by_10(value);
+                digit_exponent += 1;
+                k -= 1;
+            }
+
+            if(!get_remainder(parts, k, &value, &remainder))
+            {
+                return false;
+            }
+
+            if(value.integer == powers_of_ten[digits])
+            {
+                value.integer /= 10;
+                digit_exponent += 1;
+            }
+
+            if(value.integer < powers_of_ten[digits - 1])
+            {
+                return false;
+            }
             break;
         }
+        default:
+        {
+            return false;
+        }
     }
 
-    int digits_count = aft_string_get_count(&result.digits);
-    const char* digits_contents = aft_string_get_contents_const(&result.digits);
+    set_digits(result, value.integer);
 
-    for(int digit_index = digits_count - 1;
-            digit_index >= min_digits;
-            digit_index -= 1)
+    // Dragon4 stops after the last nonzero digit of a value it can write
+    // out exactly.
+    if(remainder == REMAINDER_ZERO)
     {
-        int digit = digits_contents[digit_index];
-
-        if(digit != 0)
+        while(result->digits_count > 1 && result->digits[result->digits_count - 1] == 0)
         {
-            break;
+            result->digits_count -= 1;
         }
-
-        aft_string_remove(&result.digits, digit_index, digit_index + 1);
     }
 
-    if(aft_string_get_count(&result.digits) == 1 && digits_contents[0] == 0)
-    {
-        result.sign = false;
-    }
+    result->exponent = digit_exponent;
+    result->type = DECIMAL_QUANTITY_TYPE_NORMAL;
+    result->sign = parts->sign;
 
-    return result;
-}
+    // The last digit is put back with rounding.
+    result->digits_count -= 1;
+    uint32_t output_digit = result->digits[result->digits_count];
+
+    bool round_down = should_round_down(format->rounding_mode, result->sign, remainder, output_digit);
+    finish_digits(result, format, output_digit, round_down);
 
+    return true;
+}
 
-DecimalQuantity format_double(double value, const FloatFormat* format, void* allocator)
+DecimalQuantity format_double(double value, const FloatFormat* format)
 {
     Ieee754Binary64OrDouble binary64 = {.value = value};
     FloatParts parts = unpack_binary64(&binary64);
 
     if(parts.exponent == 1024)
     {
-        return handle_nan_or_infinity(&parts, allocator);
+        return handle_nan_or_infinity(&parts);
+    }
+    else if(format->cutoff_mode == CUTOFF_MODE_SHORTEST)
+    {
+        return shortest_quantity(&parts);
     }
     else
     {
-        return dragon4(&parts, format, allocator);
+        // Subnormal values are left to dragon4.
+        DecimalQuantity result;
+        if(binary64.exponent != 0 && fixed_quantity(&parts, format, &result))
+        {
+            return result;
+        }
+
+        return dragon4(&parts, format);
     }
 }
 
-DecimalQuantity format_float(float value, const FloatFormat* format, void* allocator)
+DecimalQuantity format_float(float value, const FloatFormat* format)
 {
     Ieee754Binary32OrFloat binary32 = {.value = value};
     FloatParts parts = unpack_binary32(&binary32);
 
     if(parts.exponent == 128)
     {
-        return handle_nan_or_infinity(&parts, allocator);
+        return handle_nan_or_infinity(&parts);
+    }
+    else if(format->cutoff_mode == CUTOFF_MODE_SHORTEST)
+    {
+        return shortest_quantity(&parts);
     }
     else
     {
-        return dragon4(&parts, format, allocator);
+        // Subnormal values are left to dragon4.
+        DecimalQuantity result;
+        if(binary32.exponent != 0 && fixed_quantity(&parts, format, &result))
+        {
+            return result;
+        }
+
+        return dragon4(&parts, format);
     }
 }
+
+DecimalFloat shortest_double(double value)
+{
+    Ieee754Binary64OrDouble binary64 = {.value = value};
+    FloatParts parts = unpack_binary64(&binary64);
+    AFT_ASSERT(parts.exponent != 1024);
+    return shortest(&parts);
+}
+
+DecimalFloat shortest_float(float value)
+{
+    Ieee754Binary32OrFloat binary32 = {.value = value};
+    FloatParts parts = unpack_binary32(&binary32);
+    AFT_ASSERT(parts.exponent != 128);
+    return shortest(&parts);
+}
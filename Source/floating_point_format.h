@@ -5,6 +5,9 @@
 #include <AftString/aft_string.h>
 
 #include <stdbool.h>
+#include <stdint.h>
+
+#define DECIMAL_QUANTITY_DIGITS_CAP 768
 
 
 typedef enum DecimalQuantityType
@@ -18,12 +21,24 @@ typedef enum CutoffMode
 {
     CUTOFF_MODE_SIGNIFICANT_DIGITS,
     CUTOFF_MODE_FRACTION_DIGITS,
+    CUTOFF_MODE_SHORTEST,
 } CutoffMode;
 
 
+// A number that's significand × 10^exponent.
+typedef struct DecimalFloat
+{
+    uint64_t significand;
+    int exponent;
+} DecimalFloat;
+
+// The digits are values from 0 to 9, and the decimal point goes the exponent
+// number of places after the first. Writing out any double in full, from
+// the first place dragon4 estimates down to 2^-1074, takes at most 768.
 typedef struct DecimalQuantity
 {
-    AftString digits;
+    char digits[DECIMAL_QUANTITY_DIGITS_CAP];
+    int digits_count;
     int exponent;
     DecimalQuantityType type;
     bool sign;
@@ -48,7 +63,9 @@ typedef struct FloatFormat
     AftDecimalFormatRoundingMode rounding_mode;
 } FloatFormat;
 
-DecimalQuantity format_double(double value, const FloatFormat* format, void* allocator);
-DecimalQuantity format_float(float value, const FloatFormat* format, void* allocator);
+DecimalQuantity format_double(double value, const FloatFormat* format);
+DecimalQuantity format_float(float value, const FloatFormat* format);
+DecimalFloat shortest_double(double value);
+DecimalFloat shortest_float(float value);
 
 #endif // FLOATING_POINT_FORMAT_H_
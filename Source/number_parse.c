@@ -0,0 +1,866 @@
+#include "number_parse.h"
+
+#include "big_int.h"
+#include "byte_set.h"
+#include "power_tables.h"
+
+#include <assert.h>
+#include <float.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+// A halfway point between two doubles has at most 767 significant digits,
+// so any digits past this can only break a tie.
+#define BIG_DIGITS_MAX 800
+#define BIG_DIGITS_CHUNK 9
+#define EXPONENT_NUMBER_LIMIT 0x10000000
+#define MANTISSA_MAX_DIGITS 19
+#define MANTISSA_MIN_19_DIGITS UINT64_C(1000000000000000000)
+#define UINT64_MAX_DECIMAL_DIGITS 20
+
+#if defined(__SIZEOF_INT128__)
+#define USE_UINT128
+#endif
+
+// Multiplying or dividing by an exact power of ten is only correctly rounded
+// when it isn't done in a wider precision first, like on an x87 FPU.
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+#define USE_CLINGER_FAST_PATH
+#endif
+
+
+typedef union DoubleBits
+{
+    double value;
+    uint64_t bits;
+} DoubleBits;
+
+typedef union FloatBits
+{
+    float value;
+    uint32_t bits;
+} FloatBits;
+
+// The limits of an IEEE 754 binary format, with exponents biased. Powers of
+// ten outside min_power_of_ten to max_power_of_ten always give zero or
+// infinity. Only the powers of ten from min_exponent_round_to_even to
+// max_exponent_round_to_even can give an exact tie between two values.
+typedef struct BinaryFormat
+{
+    int infinite_power;
+    int mantissa_bits;
+    int max_exponent_round_to_even;
+    int max_power_of_ten;
+    int min_exponent;
+    int min_exponent_round_to_even;
+    int min_power_of_ten;
+} BinaryFormat;
+
+// A rounded binary float, as the bits of its biased exponent and mantissa.
+typedef struct AdjustedMantissa
+{
+    uint64_t mantissa;
+    int power2;
+} AdjustedMantissa;
+
+// Significant digits collected into a big integer, nine at a time. Sticky is
+// set when there's a nonzero digit past the maximum.
+typedef struct BigDigits
+{
+    BigInt value;
+    uint32_t chunk;
+    int chunk_count;
+    int count;
+    bool sticky;
+} BigDigits;
+
+typedef struct Uint128
+{
+    uint64_t low;
+    uint64_t high;
+} Uint128;
+
+
+static const BinaryFormat binary32 = {0xff, 23, 10, 38, -127, -17, -64};
+static const BinaryFormat binary64 = {0x7ff, 52, 23, 308, -1023, -4, -342};
+
+static const double double_powers_of_ten[23] =
+{
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const float float_powers_of_ten[11] =
+{
+    1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f,
+};
+
+static const uint32_t powers_of_ten_uint32[10] =
+{
+    UINT32_C(1),
+    UINT32_C(10),
+    UINT32_C(100),
+    UINT32_C(1000),
+    UINT32_C(10000),
+    UINT32_C(100000),
+    UINT32_C(1000000),
+    UINT32_C(10000000),
+    UINT32_C(100000000),
+    UINT32_C(1000000000),
+};
+
+
+static bool is_digit(char c)
+{
+    return (unsigned char) (c - '0') < 10;
+}
+
+// Get the value of a digit in any base up to 36, where letters in either
+// case come after 9. Anything else gives 36, which isn't a digit in any
+// base.
+static int get_digit_value(char c)
+{
+    if(is_digit(c))
+    {
+        return c - '0';
+    }
+
+    char lowercase = c | 0x20;
+
+    if(lowercase >= 'a' && lowercase <= 'z')
+    {
+        return lowercase - 'a' + 10;
+    }
+
+    return 36;
+}
+
+static Uint128 multiply_128(uint64_t a, uint64_t b)
+{
+    Uint128 result;
+
+#if defined(USE_UINT128)
+    unsigned __int128 product = (unsigned __int128) a * b;
+    result.low = (uint64_t) product;
+    result.high = (uint64_t) (product >> 64);
+#else
+    uint64_t a_low = (uint32_t) a;
+    uint64_t a_high = a >> 32;
+    uint64_t b_low = (uint32_t) b;
+    uint64_t b_high = b >> 32;
+
+    uint64_t low_low = a_low * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t high_low = a_high * b_low;
+    uint64_t high_high = a_high * b_high;
+
+    uint64_t middle = (low_low >> 32) + (uint32_t) high_low + (uint32_t) low_high;
+    result.high = high_high + (high_low >> 32) + (low_high >> 32) + (middle >> 32);
+    result.low = (middle << 32) | (uint32_t) low_low;
+#endif // defined(USE_UINT128)
+
+    return result;
+}
+
+// Multiply by 5^q from the table, keeping the top 128 bits. The low half of
+// the table entry is only needed when it could carry into the bits that
+// are kept.
+static Uint128 multiply_by_pow5(int q, uint64_t w, int precision_bits)
+{
+    const uint64_t* factor = pow5_parse[q - POW5_PARSE_MIN_EXPONENT];
+    Uint128 first = multiply_128(w, factor[1]);
+    uint64_t precision_mask = UINT64_MAX >> precision_bits;
+
+    if((first.high & precision_mask) == precision_mask)
+    {
+        Uint128 second = multiply_128(w, factor[0]);
+        first.low += second.high;
+
+        if(second.high > first.low)
+        {
+            first.high += 1;
+        }
+    }
+
+    return first;
+}
+
+// This is floor(log2(10^q)) + 63, using 217706 / 2^16 as log2(10). That's
+// exact for any power of ten in the table.
+static int power_of_ten_to_two(int q)
+{
+    int product = 217706 * q;
+    int quotient = product >= 0 ? product >> 16 : -((-product + 0xffff) >> 16);
+    return quotient + 63;
+}
+
+// This is the Eisel-Lemire algorithm, from "Number Parsing at a Gigabyte per
+// Second" by Daniel Lemire. It rounds w × 10^q correctly for any w that fits
+// in 64 bits.
+static AdjustedMantissa compute_float(const BinaryFormat* format, int64_t q, uint64_t w)
+{
+    AdjustedMantissa answer;
+    answer.mantissa = 0;
+    answer.power2 = 0;
+
+    if(w == 0 || q < format->min_power_of_ten)
+    {
+        return answer;
+    }
+
+    if(q > format->max_power_of_ten)
+    {
+        answer.power2 = format->infinite_power;
+        return answer;
+    }
+
+    int leading_zeros = count_leading_zeros64(w);
+    w <<= leading_zeros;
+
+    // Keep one more bit than the mantissa for rounding, and two more to
+    // normalise.
+    Uint128 product = multiply_by_pow5((int) q, w, format->mantissa_bits + 3);
+    int upper_bit = (int) (product.high >> 63);
+    int shift = upper_bit + 64 - format->mantissa_bits - 3;
+
+    answer.mantissa = product.high >> shift;
+    answer.power2 = power_of_ten_to_two((int) q) + upper_bit - leading_zeros - format->min_exponent;
+
+    if(answer.power2 <= 0)
+    {
+        // The value is subnormal, so shift off the bits that don't fit. Ties
+        // can't happen this far down.
+        if(-answer.power2 + 1 >= 64)
+        {
+            answer.mantissa = 0;
+            answer.power2 = 0;
+            return answer;
+        }
+
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+
+        // Rounding up can give the smallest normal value.
+        answer.power2 = answer.mantissa < (UINT64_C(1) << format->mantissa_bits) ? 0 : 1;
+
+        return answer;
+    }
+
+    // When the product is exactly halfway, round to even instead of up.
+    if(product.low <= 1
+            && q >= format->min_exponent_round_to_even
+            && q <= format->max_exponent_round_to_even
+            && (answer.mantissa & 3) == 1
+            && (answer.mantissa << shift) == product.high)
+    {
+        answer.mantissa &= ~UINT64_C(1);
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+
+    if(answer.mantissa >= (UINT64_C(2) << format->mantissa_bits))
+    {
+        answer.mantissa = UINT64_C(1) << format->mantissa_bits;
+        answer.power2 += 1;
+    }
+
+    answer.mantissa &= ~(UINT64_C(1) << format->mantissa_bits);
+
+    if(answer.power2 >= format->infinite_power)
+    {
+        answer.mantissa = 0;
+        answer.power2 = format->infinite_power;
+    }
+
+    return answer;
+}
+
+static void flush_big_digits(BigDigits* digits)
+{
+    if(digits->chunk_count == 0)
+    {
+        return;
+    }
+
+    BigInt chunk;
+    big_int_set_uint32(&chunk, digits->chunk);
+
+    digits->value = big_int_multiply_uint32(&digits->value, powers_of_ten_uint32[digits->chunk_count]);
+    digits->value = big_int_add(&digits->value, &chunk);
+    digits->chunk = 0;
+    digits->chunk_count = 0;
+}
+
+static void push_big_digits(BigDigits* digits, AftStringSlice slice)
+{
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+
+    for(int char_index = 0; char_index < count; char_index += 1)
+    {
+        char c = contents[char_index];
+
+        if(digits->count == 0 && c == '0')
+        {
+            continue;
+        }
+
+        if(digits->count == BIG_DIGITS_MAX)
+        {
+            digits->sticky = digits->sticky || c != '0';
+            continue;
+        }
+
+        digits->chunk = (10 * digits->chunk) + (c - '0');
+        digits->chunk_count += 1;
+        digits->count += 1;
+
+        if(digits->chunk_count == BIG_DIGITS_CHUNK)
+        {
+            flush_big_digits(digits);
+        }
+    }
+}
+
+// Compare digits × 10^decimal_exponent with the point halfway between
+// significand × 2^binary_exponent and the next value up.
+static int compare_halfway(const BigInt* digits, int decimal_exponent, uint64_t significand, int binary_exponent)
+{
+    BigInt scaled = *digits;
+    BigInt halfway;
+    big_int_set_uint64(&halfway, (2 * significand) + 1);
+
+    int shift = binary_exponent - 1;
+
+    if(decimal_exponent >= 0)
+    {
+        scaled = big_int_multiply_by_pow10(&scaled, (uint32_t) decimal_exponent);
+    }
+    else
+    {
+        halfway = big_int_multiply_by_pow5(&halfway, (uint32_t) -decimal_exponent);
+        shift -= decimal_exponent;
+    }
+
+    if(shift > 0)
+    {
+        big_int_shift_left(&halfway, (uint32_t) shift);
+    }
+    else if(shift < 0)
+    {
+        big_int_shift_left(&scaled, (uint32_t) -shift);
+    }
+
+    return big_int_compare(&scaled, &halfway);
+}
+
+// When the mantissa was cut short, the answer is either the value just below
+// or the one above, so find out which side of the halfway point between them
+// the digits fall on.
+static AdjustedMantissa compare_digits(const BinaryFormat* format, const ParsedDecimal* decimal, AdjustedMantissa below)
+{
+    BigDigits digits;
+    big_int_set_uint32(&digits.value, 0);
+    digits.chunk = 0;
+    digits.chunk_count = 0;
+    digits.count = 0;
+    digits.sticky = false;
+
+    push_big_digits(&digits, decimal->integer_digits);
+    push_big_digits(&digits, decimal->fraction_digits);
+    flush_big_digits(&digits);
+
+    int decimal_exponent = (int) decimal->exponent + MANTISSA_MAX_DIGITS - digits.count;
+
+    uint64_t significand = below.mantissa;
+    int binary_exponent = 1 + format->min_exponent - format->mantissa_bits;
+
+    if(below.power2 > 0)
+    {
+        significand |= UINT64_C(1) << format->mantissa_bits;
+        binary_exponent = below.power2 + format->min_exponent - format->mantissa_bits;
+    }
+
+    int comparison = compare_halfway(&digits.value, decimal_exponent, significand, binary_exponent);
+
+    if(comparison > 0 || (comparison == 0 && (digits.sticky || (below.mantissa & 1))))
+    {
+        below.mantissa += 1;
+
+        if(below.mantissa == UINT64_C(1) << format->mantissa_bits)
+        {
+            below.mantissa = 0;
+            below.power2 += 1;
+        }
+    }
+
+    return below;
+}
+
+static AdjustedMantissa decimal_to_binary(const BinaryFormat* format, const ParsedDecimal* decimal)
+{
+    AdjustedMantissa answer = compute_float(format, decimal->exponent, decimal->mantissa);
+
+    if(decimal->too_many_digits)
+    {
+        AdjustedMantissa above = compute_float(format, decimal->exponent, decimal->mantissa + 1);
+
+        if(above.mantissa != answer.mantissa || above.power2 != answer.power2)
+        {
+            answer = compare_digits(format, decimal, answer);
+        }
+    }
+
+    return answer;
+}
+
+static int scan_digits(const char* contents, int index, int count, uint64_t* mantissa)
+{
+    uint64_t value = *mantissa;
+
+    while(count - index >= 8)
+    {
+        uint64_t chunk = load_eight_bytes(&contents[index]);
+
+        if(!is_eight_digits(chunk))
+        {
+            break;
+        }
+
+        value = (UINT64_C(100000000) * value) + parse_eight_digits(chunk);
+        index += 8;
+    }
+
+    while(index < count && is_digit(contents[index]))
+    {
+        value = (10 * value) + (uint64_t) (contents[index] - '0');
+        index += 1;
+    }
+
+    *mantissa = value;
+
+    return index;
+}
+
+// Decimal digits get a fast path, since they're what's parsed most. Up to 19
+// digits can't overflow, so those are read eight at a time without any
+// checks. Only a twentieth can overflow, and anything past that always
+// does.
+static int scan_decimal_uint64(const char* contents, int count, uint64_t* value, bool* overflow)
+{
+    int index = 0;
+
+    while(index < count && contents[index] == '0')
+    {
+        index += 1;
+    }
+
+    int digits_start = index;
+    uint64_t result = 0;
+
+    while(count - index >= 8 && index - digits_start <= UINT64_MAX_DECIMAL_DIGITS - 9)
+    {
+        uint64_t chunk = load_eight_bytes(&contents[index]);
+
+        if(!is_eight_digits(chunk))
+        {
+            break;
+        }
+
+        result = (UINT64_C(100000000) * result) + parse_eight_digits(chunk);
+        index += 8;
+    }
+
+    while(index < count
+            && index - digits_start < UINT64_MAX_DECIMAL_DIGITS - 1
+            && is_digit(contents[index]))
+    {
+        result = (10 * result) + (uint64_t) (contents[index] - '0');
+        index += 1;
+    }
+
+    if(index < count && is_digit(contents[index]))
+    {
+        uint64_t digit = (uint64_t) (contents[index] - '0');
+
+        if(result > UINT64_MAX / 10 || (result == UINT64_MAX / 10 && digit > UINT64_MAX % 10))
+        {
+            *overflow = true;
+        }
+        else
+        {
+            result = (10 * result) + digit;
+        }
+
+        index += 1;
+
+        while(index < count && is_digit(contents[index]))
+        {
+            *overflow = true;
+            index += 1;
+        }
+    }
+
+    *value = result;
+
+    return index;
+}
+
+static int scan_uint64(const char* contents, int count, int base, uint64_t* value, bool* overflow)
+{
+    *overflow = false;
+
+    if(base == 10)
+    {
+        return scan_decimal_uint64(contents, count, value, overflow);
+    }
+
+    const uint64_t max_before_digit = UINT64_MAX / (uint64_t) base;
+    const uint64_t max_last_digit = UINT64_MAX % (uint64_t) base;
+
+    uint64_t result = 0;
+    int index = 0;
+
+    for(; index < count; index += 1)
+    {
+        int digit = get_digit_value(contents[index]);
+
+        if(digit >= base)
+        {
+            break;
+        }
+
+        if(result > max_before_digit || (result == max_before_digit && (uint64_t) digit > max_last_digit))
+        {
+            *overflow = true;
+        }
+        else
+        {
+            result = (result * (uint64_t) base) + (uint64_t) digit;
+        }
+    }
+
+    *value = result;
+
+    return index;
+}
+
+static int scan_exponent(const char* contents, int index, int count, int64_t* exponent)
+{
+    bool sign = false;
+
+    if(index < count && (contents[index] == '-' || contents[index] == '+'))
+    {
+        sign = contents[index] == '-';
+        index += 1;
+    }
+
+    if(index >= count || !is_digit(contents[index]))
+    {
+        return -1;
+    }
+
+    int64_t value = 0;
+
+    while(index < count && is_digit(contents[index]))
+    {
+        // Past this, the result is zero or infinity anyway.
+        if(value < EXPONENT_NUMBER_LIMIT)
+        {
+            value = (10 * value) + (contents[index] - '0');
+        }
+
+        index += 1;
+    }
+
+    *exponent = sign ? -value : value;
+
+    return index;
+}
+
+
+// Give the signed value of a magnitude, when it's no more than max. Negative
+// numbers can go one further.
+bool apply_sign(bool sign, uint64_t magnitude, int64_t max, int64_t* value)
+{
+    AFT_ASSERT(max > 0);
+    AFT_ASSERT(value);
+
+    uint64_t limit = sign ? (uint64_t) max + 1 : (uint64_t) max;
+
+    if(magnitude > limit)
+    {
+        return false;
+    }
+
+    if(sign && magnitude != 0)
+    {
+        *value = -(int64_t) (magnitude - 1) - 1;
+    }
+    else
+    {
+        *value = (int64_t) magnitude;
+    }
+
+    return true;
+}
+
+double decimal_to_double(const ParsedDecimal* decimal)
+{
+    AFT_ASSERT(decimal);
+
+#if defined(USE_CLINGER_FAST_PATH)
+    // When the mantissa and power of ten are both exact doubles, a single
+    // correctly rounded operation gives the answer.
+    if(!decimal->too_many_digits
+            && decimal->mantissa <= (UINT64_C(1) << 53)
+            && decimal->exponent >= -22
+            && decimal->exponent <= 22)
+    {
+        double value = (double) decimal->mantissa;
+
+        if(decimal->exponent < 0)
+        {
+            value /= double_powers_of_ten[-decimal->exponent];
+        }
+        else
+        {
+            value *= double_powers_of_ten[decimal->exponent];
+        }
+
+        return decimal->sign ? -value : value;
+    }
+#endif // defined(USE_CLINGER_FAST_PATH)
+
+    AdjustedMantissa answer = decimal_to_binary(&binary64, decimal);
+
+    DoubleBits result;
+    result.bits = answer.mantissa
+            | ((uint64_t) answer.power2 << 52)
+            | ((uint64_t) decimal->sign << 63);
+
+    return result.value;
+}
+
+float decimal_to_float(const ParsedDecimal* decimal)
+{
+    AFT_ASSERT(decimal);
+
+#if defined(USE_CLINGER_FAST_PATH)
+    if(!decimal->too_many_digits
+            && decimal->mantissa <= (UINT64_C(1) << 24)
+            && decimal->exponent >= -10
+            && decimal->exponent <= 10)
+    {
+        float value = (float) decimal->mantissa;
+
+        if(decimal->exponent < 0)
+        {
+            value /= float_powers_of_ten[-decimal->exponent];
+        }
+        else
+        {
+            value *= float_powers_of_ten[decimal->exponent];
+        }
+
+        return decimal->sign ? -value : value;
+    }
+#endif // defined(USE_CLINGER_FAST_PATH)
+
+    AdjustedMantissa answer = decimal_to_binary(&binary32, decimal);
+
+    FloatBits result;
+    result.bits = (uint32_t) answer.mantissa
+            | ((uint32_t) answer.power2 << 23)
+            | ((uint32_t) decimal->sign << 31);
+
+    return result.value;
+}
+
+// Check that all eight bytes are from '0' to '9'. Adding 0x46 carries into
+// the top bit of a byte above '9', and subtracting 0x30 borrows into it
+// below '0'.
+bool is_eight_digits(uint64_t chunk)
+{
+    return (((chunk + UINT64_C(0x4646464646464646)) | (chunk - UINT64_C(0x3030303030303030)))
+            & UINT64_C(0x8080808080808080)) == 0;
+}
+
+// Load bytes so the first is the lowest, whatever the byte order. Compilers
+// turn this into a single load.
+uint64_t load_eight_bytes(const char* bytes)
+{
+    uint64_t chunk = 0;
+
+    for(int byte_index = 0; byte_index < 8; byte_index += 1)
+    {
+        chunk |= (uint64_t) (uint8_t) bytes[byte_index] << (8 * byte_index);
+    }
+
+    return chunk;
+}
+
+// Parse a number of the form [+-]digits[.digits][(e|E)[+-]digits], where
+// either the integer or fraction digits can be left out. It gives the number
+// of bytes read, or zero when there's no number at the start.
+int parse_decimal(AftStringSlice slice, ParsedDecimal* decimal)
+{
+    AFT_ASSERT(decimal);
+
+    const char* contents = aft_string_slice_start(slice);
+    int count = aft_string_slice_count(slice);
+    int index = 0;
+
+    decimal->sign = false;
+    decimal->too_many_digits = false;
+
+    if(index < count && (contents[index] == '-' || contents[index] == '+'))
+    {
+        decimal->sign = contents[index] == '-';
+        index += 1;
+    }
+
+    uint64_t mantissa = 0;
+
+    int integer_start = index;
+    index = scan_digits(contents, index, count, &mantissa);
+    int integer_end = index;
+
+    int fraction_start = index;
+    int fraction_end = index;
+
+    if(index < count && contents[index] == '.')
+    {
+        fraction_start = index + 1;
+        index = scan_digits(contents, fraction_start, count, &mantissa);
+        fraction_end = index;
+    }
+
+    int digit_count = (integer_end - integer_start) + (fraction_end - fraction_start);
+
+    if(digit_count == 0)
+    {
+        return 0;
+    }
+
+    // An exponent marker without digits after it isn't part of the number.
+    int64_t explicit_exponent = 0;
+
+    if(index < count && (contents[index] == 'e' || contents[index] == 'E'))
+    {
+        int exponent_end = scan_exponent(contents, index + 1, count, &explicit_exponent);
+
+        if(exponent_end >= 0)
+        {
+            index = exponent_end;
+        }
+    }
+
+    decimal->integer_digits = aft_string_slice(slice, integer_start, integer_end);
+    decimal->fraction_digits = aft_string_slice(slice, fraction_start, fraction_end);
+    decimal->mantissa = mantissa;
+    decimal->exponent = explicit_exponent - (fraction_end - fraction_start);
+
+    if(digit_count > MANTISSA_MAX_DIGITS)
+    {
+        // Leading zeros aren't significant.
+        for(int char_index = integer_start;
+                char_index < fraction_end && (contents[char_index] == '0' || contents[char_index] == '.');
+                char_index += 1)
+        {
+            if(contents[char_index] == '0')
+            {
+                digit_count -= 1;
+            }
+        }
+    }
+
+    if(digit_count > MANTISSA_MAX_DIGITS)
+    {
+        // The mantissa overflowed, so keep only its first 19 significant
+        // digits.
+        decimal->too_many_digits = true;
+        mantissa = 0;
+
+        int char_index = integer_start;
+
+        while(mantissa < MANTISSA_MIN_19_DIGITS && char_index < integer_end)
+        {
+            mantissa = (10 * mantissa) + (uint64_t) (contents[char_index] - '0');
+            char_index += 1;
+        }
+
+        if(mantissa >= MANTISSA_MIN_19_DIGITS)
+        {
+            decimal->exponent = explicit_exponent + (integer_end - char_index);
+        }
+        else
+        {
+            char_index = fraction_start;
+
+            while(mantissa < MANTISSA_MIN_19_DIGITS && char_index < fraction_end)
+            {
+                mantissa = (10 * mantissa) + (uint64_t) (contents[char_index] - '0');
+                char_index += 1;
+            }
+
+            decimal->exponent = explicit_exponent - (char_index - fraction_start);
+        }
+
+        decimal->mantissa = mantissa;
+    }
+
+    return index;
+}
+
+// Read an optional sign and then digits in the given base. The count is the
+// number of bytes read, or zero when there's no number at the start.
+bool parse_integer(AftStringSlice slice, int base, bool allow_minus, int* count, bool* sign, uint64_t* magnitude)
+{
+    AFT_ASSERT(base >= 2 && base <= 36);
+    AFT_ASSERT(count);
+
+    const char* contents = aft_string_slice_start(slice);
+    int slice_count = aft_string_slice_count(slice);
+    int index = 0;
+
+    *sign = false;
+
+    if(index < slice_count && (contents[index] == '+' || (allow_minus && contents[index] == '-')))
+    {
+        *sign = contents[index] == '-';
+        index += 1;
+    }
+
+    bool overflow;
+    int digit_count = scan_uint64(&contents[index], slice_count - index, base, magnitude, &overflow);
+
+    if(digit_count == 0)
+    {
+        *count = 0;
+        return false;
+    }
+
+    *count = index + digit_count;
+
+    return !overflow;
+}
+
+// Turn eight digit bytes into their value, combining pairs of digits, then
+// pairs of those, and then the two halves.
+uint32_t parse_eight_digits(uint64_t chunk)
+{
+    const uint64_t mask = UINT64_C(0x000000ff000000ff);
+    const uint64_t multiplier_low = UINT64_C(0x000f424000000064);
+    const uint64_t multiplier_high = UINT64_C(0x0000271000000001);
+
+    chunk -= UINT64_C(0x3030303030303030);
+    chunk = (chunk * 10) + (chunk >> 8);
+    chunk = (((chunk & mask) * multiplier_low) + (((chunk >> 16) & mask) * multiplier_high)) >> 32;
+
+    return (uint32_t) chunk;
+}
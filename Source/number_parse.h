@@ -0,0 +1,33 @@
+#ifndef NUMBER_PARSE_H_
+#define NUMBER_PARSE_H_
+
+#include <AftString/aft_string.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// A decimal number as written, that's mantissa × 10^exponent. When there
+// are more than 19 significant digits, the mantissa only holds the first 19
+// and the rest are still in the digit slices.
+typedef struct ParsedDecimal
+{
+    AftStringSlice integer_digits;
+    AftStringSlice fraction_digits;
+    uint64_t mantissa;
+    int64_t exponent;
+    bool sign;
+    bool too_many_digits;
+} ParsedDecimal;
+
+
+bool apply_sign(bool sign, uint64_t magnitude, int64_t max, int64_t* value);
+double decimal_to_double(const ParsedDecimal* decimal);
+float decimal_to_float(const ParsedDecimal* decimal);
+bool is_eight_digits(uint64_t chunk);
+uint64_t load_eight_bytes(const char* bytes);
+int parse_decimal(AftStringSlice slice, ParsedDecimal* decimal);
+bool parse_integer(AftStringSlice slice, int base, bool allow_minus, int* count, bool* sign, uint64_t* magnitude);
+uint32_t parse_eight_digits(uint64_t chunk);
+
+#endif // NUMBER_PARSE_H_
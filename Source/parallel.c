@@ -0,0 +1,147 @@
+#include "parallel.h"
+
+#include "aft_string_config.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+
+#define AFT_ASSERT(expression) \
+    assert(expression)
+
+
+typedef struct TaskStart
+{
+    ParallelTask task;
+    void* data;
+    int task_index;
+} TaskStart;
+
+
+#if defined(AFT_USE_THREADS) && AFT_USE_THREADS == 1
+
+#if defined(_WIN32)
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+typedef HANDLE Thread;
+
+static DWORD WINAPI run_task(LPVOID parameter)
+{
+    TaskStart* start = (TaskStart*) parameter;
+    start->task(start->data, start->task_index);
+    return 0;
+}
+
+static bool thread_start(Thread* thread, TaskStart* start)
+{
+    *thread = CreateThread(NULL, 0, run_task, start, 0, NULL);
+    return *thread != NULL;
+}
+
+static void thread_join(Thread thread)
+{
+    WaitForSingleObject(thread, INFINITE);
+    CloseHandle(thread);
+}
+
+#else
+
+#include <pthread.h>
+
+typedef pthread_t Thread;
+
+static void* run_task(void* parameter)
+{
+    TaskStart* start = (TaskStart*) parameter;
+    start->task(start->data, start->task_index);
+    return NULL;
+}
+
+static bool thread_start(Thread* thread, TaskStart* start)
+{
+    return pthread_create(thread, NULL, run_task, start) == 0;
+}
+
+static void thread_join(Thread thread)
+{
+    pthread_join(thread, NULL);
+}
+
+#endif // defined(_WIN32)
+
+int parallel_clamp_thread_count(int thread_count)
+{
+    if(thread_count < 1)
+    {
+        return 1;
+    }
+    else if(thread_count > PARALLEL_THREAD_CAP)
+    {
+        return PARALLEL_THREAD_CAP;
+    }
+    else
+    {
+        return thread_count;
+    }
+}
+
+// The calling thread runs the first task itself. Any task whose thread fails to
+// start is also run on the calling thread, so every task always runs exactly
+// once no matter how many threads could be made.
+void parallel_run(ParallelTask task, void* data, int task_count)
+{
+    AFT_ASSERT(task);
+    AFT_ASSERT(task_count >= 0 && task_count <= PARALLEL_THREAD_CAP);
+
+    TaskStart starts[PARALLEL_THREAD_CAP];
+    Thread threads[PARALLEL_THREAD_CAP];
+    bool started[PARALLEL_THREAD_CAP];
+
+    for(int task_index = 1; task_index < task_count; task_index += 1)
+    {
+        starts[task_index].task = task;
+        starts[task_index].data = data;
+        starts[task_index].task_index = task_index;
+        started[task_index] = thread_start(&threads[task_index], &starts[task_index]);
+    }
+
+    if(task_count > 0)
+    {
+        task(data, 0);
+    }
+
+    for(int task_index = 1; task_index < task_count; task_index += 1)
+    {
+        if(started[task_index])
+        {
+            thread_join(threads[task_index]);
+        }
+        else
+        {
+            task(data, task_index);
+        }
+    }
+}
+
+#else
+
+int parallel_clamp_thread_count(int thread_count)
+{
+    (void) thread_count;
+    return 1;
+}
+
+void parallel_run(ParallelTask task, void* data, int task_count)
+{
+    AFT_ASSERT(task);
+
+    for(int task_index = 0; task_index < task_count; task_index += 1)
+    {
+        task(data, task_index);
+    }
+}
+
+#endif // defined(AFT_USE_THREADS) && AFT_USE_THREADS == 1
@@ -0,0 +1,11 @@
+#ifndef PARALLEL_H_
+#define PARALLEL_H_
+
+#define PARALLEL_THREAD_CAP 64
+
+typedef void (*ParallelTask)(void* data, int task_index);
+
+int parallel_clamp_thread_count(int thread_count);
+void parallel_run(ParallelTask task, void* data, int task_count);
+
+#endif // PARALLEL_H_
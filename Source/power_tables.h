@@ -0,0 +1,17 @@
+// Generated by Tools/generate_power_tables.py. Don't edit this by hand.
+
+#ifndef POWER_TABLES_H_
+#define POWER_TABLES_H_
+
+#include <stdint.h>
+
+#define POW5_BITCOUNT 125
+#define POW5_INVERSE_BITCOUNT 125
+#define POW5_PARSE_MAX_EXPONENT 308
+#define POW5_PARSE_MIN_EXPONENT (-342)
+
+extern const uint64_t pow5_inverse_split[342][2];
+extern const uint64_t pow5_parse[651][2];
+extern const uint64_t pow5_split[326][2];
+
+#endif // POWER_TABLES_H_
@@ -0,0 +1,4045 @@
+// Generated by Tools/generate_unicode_data.py from the Unicode Character
+// Database 14.0.0. Don't edit this by hand.
+
+#include "unicode_data.h"
+
+const uint8_t unicode_case_fold_stage1[1088] =
+{
+    0, 1, 2, 2, 3, 2, 2, 4, 5, 6, 2, 7, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 8, 9, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 10, 11,
+    2, 12, 2, 13, 2, 2, 14, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 15, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 16, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+};
+
+const uint8_t unicode_case_fold_stage2[1088] =
+{
+    0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 3, 4, 5, 0, 0,
+    6, 6, 6, 7, 8, 6, 6, 9, 10, 11, 12, 13, 14, 15, 6, 16,
+    6, 6, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 20, 0, 0, 21, 22, 23, 24, 25, 26, 27, 6, 28,
+    29, 4, 4, 0, 0, 0, 6, 6, 30, 6, 6, 6, 31, 6, 6, 6,
+    6, 6, 6, 32, 33, 34, 0, 0, 35, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 36, 36, 37, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 38,
+    0, 0, 0, 0, 0, 0, 0, 0, 39, 40, 40, 41, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 42, 6, 6, 6, 6, 6, 6,
+    43, 38, 43, 43, 38, 44, 43, 0, 45, 46, 47, 48, 49, 50, 51, 52,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 53, 54, 0, 0, 55, 0, 56, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 58, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 0, 0, 0, 59, 60, 6, 6, 6, 6, 6, 6, 61, 62,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 6, 6, 63, 0, 6, 64, 0, 0, 0, 0, 0, 0,
+    0, 0, 65, 65, 6, 6, 6, 66, 67, 68, 69, 70, 71, 72, 0, 73,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 74, 74, 74, 74, 74, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    75, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    77, 77, 78, 0, 0, 0, 0, 0, 0, 0, 0, 77, 77, 79, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 80, 80, 81, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 82, 82, 82, 83, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    84, 84, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint8_t unicode_case_fold_stage3[1376] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 3,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    5, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 6, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 7, 4, 0, 4, 0, 4, 0, 8,
+    0, 9, 4, 0, 4, 0, 10, 4, 0, 11, 11, 4, 0, 0, 12, 13,
+    14, 4, 0, 11, 15, 0, 16, 17, 4, 0, 0, 0, 16, 18, 0, 19,
+    4, 0, 4, 0, 4, 0, 20, 4, 0, 20, 0, 0, 4, 0, 20, 4,
+    0, 21, 21, 4, 0, 4, 0, 22, 4, 0, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 23, 4, 0, 23, 4, 0, 23, 4, 0, 4, 0, 4,
+    0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 4, 0,
+    24, 23, 4, 0, 4, 0, 25, 26, 4, 0, 4, 0, 4, 0, 4, 0,
+    27, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 28, 4, 0, 29, 30, 0,
+    0, 4, 0, 31, 32, 33, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    0, 0, 0, 0, 0, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 34,
+    0, 0, 0, 0, 0, 0, 35, 0, 36, 36, 36, 0, 37, 0, 38, 38,
+    39, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41,
+    42, 43, 0, 0, 0, 44, 45, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    46, 47, 0, 0, 48, 49, 0, 4, 0, 50, 4, 0, 0, 27, 27, 27,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0,
+    52, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0,
+    0, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53, 53,
+    53, 53, 53, 53, 53, 53, 53, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 0,
+    55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55, 55,
+    55, 55, 55, 55, 55, 55, 0, 55, 0, 0, 0, 0, 0, 55, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 0, 0,
+    57, 58, 59, 60, 60, 61, 62, 63, 64, 0, 0, 0, 0, 0, 0, 0,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65,
+    65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 65, 0, 0, 65, 65, 65,
+    4, 0, 4, 0, 4, 0, 66, 67, 68, 69, 70, 71, 0, 0, 72, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 56, 56, 56, 56, 56, 56, 56, 56,
+    73, 0, 74, 0, 75, 0, 76, 0, 0, 56, 0, 56, 0, 56, 0, 56,
+    77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92,
+    93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124,
+    0, 0, 125, 126, 127, 0, 128, 129, 56, 56, 130, 130, 131, 0, 132, 0,
+    0, 0, 133, 134, 135, 0, 136, 137, 138, 138, 138, 138, 139, 0, 0, 0,
+    0, 0, 140, 141, 0, 0, 142, 143, 56, 56, 144, 144, 0, 0, 0, 0,
+    0, 0, 145, 146, 147, 0, 148, 149, 56, 56, 150, 150, 50, 0, 0, 0,
+    0, 0, 151, 152, 153, 0, 154, 155, 156, 156, 157, 157, 158, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 159, 0, 0, 0, 160, 161, 0, 0, 0, 0,
+    0, 0, 162, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163, 163,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+    164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164, 164,
+    4, 0, 165, 166, 167, 0, 0, 4, 0, 4, 0, 4, 0, 168, 169, 170,
+    171, 0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 172, 172,
+    4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 173, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 0, 174, 0, 0,
+    4, 0, 4, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 175, 176, 177, 178, 175, 0,
+    179, 180, 181, 182, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 47, 183, 184, 4, 0, 4, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185, 185,
+    186, 187, 188, 189, 190, 191, 192, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 193, 194, 195, 196, 197, 0, 0, 0, 0, 0, 0, 0, 0,
+    198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198, 198,
+    198, 198, 198, 198, 198, 198, 198, 198, 0, 0, 0, 0, 0, 0, 0, 0,
+    198, 198, 198, 198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 199, 0, 199, 199, 199, 199,
+    199, 199, 199, 0, 199, 199, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200, 200,
+    200, 200, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint8_t unicode_class_stage1[2176] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 27, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    28, 26, 29, 30, 31, 32, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 34, 34, 34,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 36, 37, 38, 39,
+    40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55,
+    26, 56, 57, 58, 58, 58, 58, 59, 26, 26, 60, 58, 58, 58, 58, 58,
+    58, 58, 26, 61, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 26, 62, 58, 63, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 64, 26, 26, 65, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 66, 67, 68, 58, 58, 58, 58, 69, 58,
+    58, 58, 58, 58, 58, 58, 58, 70, 71, 72, 73, 74, 75, 76, 58, 77,
+    78, 79, 58, 80, 81, 58, 82, 83, 84, 85, 75, 86, 87, 88, 58, 58,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 89, 26, 26, 26, 26, 26, 26, 26, 90, 91, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 92, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 93, 58, 58, 58, 58, 58, 58, 26, 94, 58, 58,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 95, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    96, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58, 58,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 97,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35,
+    35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 35, 97,
+};
+
+const uint16_t unicode_class_stage2[3136] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 1, 9, 10, 11, 12, 13, 14,
+    15, 15, 15, 16, 17, 15, 15, 18, 19, 20, 21, 22, 23, 24, 15, 25,
+    15, 15, 15, 26, 27, 13, 13, 13, 13, 28, 13, 29, 30, 31, 32, 33,
+    34, 34, 34, 34, 35, 34, 34, 36, 37, 38, 39, 13, 40, 41, 15, 42,
+    11, 11, 11, 13, 13, 13, 15, 15, 43, 15, 15, 15, 44, 15, 15, 15,
+    15, 15, 15, 45, 11, 46, 13, 13, 47, 48, 34, 49, 50, 51, 52, 53,
+    54, 55, 51, 51, 56, 57, 58, 59, 51, 51, 51, 51, 51, 60, 61, 62,
+    63, 64, 51, 65, 66, 51, 51, 51, 51, 51, 67, 68, 69, 51, 70, 71,
+    51, 72, 73, 74, 51, 75, 76, 51, 77, 78, 51, 51, 79, 80, 81, 65,
+    82, 51, 51, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    96, 89, 90, 97, 98, 99, 100, 101, 102, 103, 90, 104, 105, 106, 94, 107,
+    108, 89, 90, 109, 110, 111, 94, 112, 113, 114, 115, 116, 117, 118, 100, 119,
+    120, 121, 90, 122, 123, 124, 94, 125, 126, 121, 90, 127, 128, 129, 94, 130,
+    131, 121, 51, 132, 133, 134, 94, 135, 136, 137, 51, 138, 139, 140, 100, 141,
+    142, 51, 51, 143, 144, 145, 146, 146, 147, 51, 148, 149, 150, 151, 146, 146,
+    152, 153, 154, 155, 156, 51, 157, 158, 159, 160, 65, 161, 162, 163, 146, 146,
+    51, 51, 164, 165, 166, 167, 168, 169, 170, 171, 11, 11, 172, 13, 13, 173,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 174, 175, 51, 51, 174, 51, 51, 176, 177, 178, 51, 51,
+    51, 177, 51, 51, 51, 179, 180, 181, 51, 182, 11, 11, 11, 11, 11, 183,
+    184, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 185, 51, 186, 187, 51, 51, 51, 51, 188, 189,
+    51, 190, 51, 191, 51, 192, 193, 194, 51, 51, 51, 195, 196, 197, 198, 199,
+    200, 198, 51, 51, 201, 51, 51, 202, 203, 51, 204, 51, 51, 51, 51, 205,
+    51, 206, 207, 208, 209, 51, 210, 211, 51, 51, 212, 51, 213, 214, 215, 215,
+    51, 216, 51, 51, 51, 217, 218, 219, 198, 198, 220, 221, 222, 146, 146, 146,
+    223, 51, 51, 224, 225, 166, 226, 227, 228, 51, 229, 69, 51, 51, 230, 231,
+    51, 51, 232, 233, 234, 69, 51, 235, 236, 11, 11, 237, 238, 239, 240, 241,
+    13, 13, 242, 29, 29, 29, 243, 244, 13, 245, 29, 29, 34, 34, 246, 247,
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 248, 15, 15, 15, 15, 15, 15,
+    249, 250, 249, 249, 250, 251, 249, 252, 253, 253, 253, 254, 255, 256, 257, 258,
+    259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 269, 270, 271, 272, 273,
+    274, 275, 276, 277, 278, 279, 280, 280, 281, 282, 283, 215, 284, 285, 215, 286,
+    287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287,
+    288, 215, 289, 215, 215, 215, 215, 290, 215, 291, 287, 292, 215, 293, 294, 215,
+    215, 215, 295, 146, 296, 146, 279, 279, 279, 297, 215, 298, 299, 299, 300, 279,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 301, 302, 215, 215, 303,
+    215, 215, 215, 215, 215, 215, 304, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 305, 306, 279, 307, 215, 215, 308, 287, 309, 287,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    287, 287, 287, 287, 287, 287, 287, 287, 310, 311, 287, 287, 287, 312, 287, 313,
+    287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287, 287,
+    215, 215, 215, 287, 314, 215, 215, 315, 215, 316, 215, 215, 215, 215, 215, 215,
+    11, 11, 11, 13, 13, 13, 317, 318, 15, 15, 15, 15, 15, 15, 319, 320,
+    13, 13, 321, 51, 51, 51, 322, 323, 51, 324, 325, 325, 325, 325, 65, 65,
+    326, 327, 328, 329, 330, 331, 146, 146, 215, 332, 215, 215, 215, 215, 215, 333,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 334, 146, 335,
+    336, 337, 338, 339, 142, 51, 51, 51, 51, 340, 184, 51, 51, 51, 51, 341,
+    342, 51, 51, 142, 51, 51, 51, 51, 206, 343, 51, 51, 215, 215, 333, 51,
+    215, 344, 345, 215, 346, 347, 215, 215, 345, 215, 215, 347, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 215, 215, 215, 215,
+    51, 348, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 157, 215, 215, 215, 295, 51, 51, 235,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    349, 51, 350, 146, 15, 15, 351, 352, 15, 353, 51, 51, 51, 51, 354, 355,
+    33, 356, 357, 358, 15, 15, 15, 359, 360, 361, 362, 363, 364, 365, 146, 366,
+    367, 51, 368, 369, 51, 51, 51, 370, 371, 51, 51, 372, 373, 198, 34, 374,
+    69, 51, 375, 51, 376, 377, 51, 157, 82, 51, 51, 378, 379, 380, 381, 382,
+    51, 51, 383, 384, 385, 386, 51, 387, 51, 51, 51, 388, 389, 390, 391, 392,
+    393, 394, 325, 13, 13, 395, 396, 13, 13, 13, 13, 13, 51, 51, 397, 198,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 398, 51, 399, 51, 51, 212,
+    400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400,
+    400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400, 400,
+    401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+    401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+    401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 210, 51, 51, 51, 51, 51, 51, 213, 146, 146,
+    402, 403, 404, 405, 406, 51, 51, 51, 51, 51, 51, 407, 408, 409, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 410, 215, 51, 51, 51, 51, 411, 51, 51, 412, 146, 146, 413,
+    34, 414, 34, 415, 416, 417, 418, 419, 51, 51, 51, 51, 51, 51, 51, 420,
+    421, 3, 4, 5, 6, 422, 423, 424, 51, 425, 51, 206, 426, 427, 428, 429,
+    430, 51, 178, 431, 210, 210, 146, 146, 51, 51, 51, 51, 51, 51, 51, 76,
+    432, 279, 279, 433, 280, 280, 280, 434, 435, 436, 437, 146, 146, 215, 215, 438,
+    146, 146, 146, 146, 146, 146, 146, 146, 51, 157, 51, 51, 51, 106, 439, 440,
+    51, 51, 441, 51, 442, 51, 51, 443, 51, 444, 51, 51, 445, 446, 146, 146,
+    11, 11, 447, 13, 13, 51, 51, 51, 51, 210, 198, 11, 11, 448, 13, 449,
+    51, 51, 450, 51, 51, 51, 451, 452, 452, 453, 454, 455, 146, 146, 146, 146,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 324, 51, 205, 450, 146, 456, 29, 29, 457, 146, 146, 146, 146,
+    458, 51, 51, 459, 51, 460, 51, 461, 51, 206, 462, 146, 146, 146, 51, 463,
+    51, 464, 51, 465, 146, 146, 146, 146, 51, 51, 51, 466, 279, 467, 279, 279,
+    468, 469, 51, 470, 471, 472, 51, 473, 51, 474, 146, 146, 475, 51, 476, 477,
+    51, 51, 51, 478, 51, 479, 51, 480, 51, 481, 482, 146, 146, 146, 146, 146,
+    51, 51, 51, 51, 202, 146, 146, 146, 11, 11, 11, 483, 13, 13, 13, 484,
+    51, 51, 485, 198, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 279, 486, 51, 51, 487, 488, 146, 146, 146, 146,
+    51, 474, 489, 51, 490, 491, 146, 51, 492, 146, 146, 51, 493, 146, 51, 324,
+    494, 51, 51, 495, 496, 467, 497, 498, 499, 51, 51, 500, 501, 51, 202, 198,
+    502, 51, 503, 504, 505, 51, 51, 506, 228, 51, 51, 507, 508, 509, 510, 511,
+    51, 103, 512, 513, 146, 146, 146, 146, 514, 515, 516, 51, 51, 517, 518, 198,
+    519, 89, 90, 520, 521, 522, 523, 524, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 51, 525, 526, 527, 488, 146, 51, 51, 51, 528, 529, 198, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 51, 51, 530, 531, 532, 533, 146, 146,
+    51, 51, 51, 534, 535, 198, 536, 146, 51, 51, 537, 538, 198, 146, 146, 146,
+    51, 539, 540, 541, 324, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 512, 542, 146, 146, 146, 146, 146, 146, 11, 11, 13, 13, 154, 543,
+    544, 545, 51, 546, 547, 198, 146, 146, 146, 146, 548, 51, 51, 549, 550, 146,
+    551, 51, 51, 552, 553, 554, 51, 51, 555, 556, 557, 51, 51, 51, 51, 202,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    90, 51, 530, 558, 559, 154, 181, 560, 51, 561, 562, 563, 146, 146, 146, 146,
+    564, 51, 51, 565, 566, 198, 567, 51, 568, 569, 198, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 51, 570,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 106, 279, 571, 572, 573,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 213, 146, 146, 146, 146, 146, 146,
+    280, 280, 280, 280, 280, 280, 574, 575, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 398, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 51, 51, 51, 51, 51, 51, 576,
+    51, 51, 206, 577, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 51, 51, 324, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 51, 202, 51, 206, 380, 51, 51, 51, 51, 206, 198, 51, 210, 578,
+    51, 51, 51, 579, 580, 581, 582, 583, 51, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 11, 11, 13, 13, 279, 584, 146, 146, 146, 146, 146, 146,
+    51, 51, 51, 51, 585, 586, 587, 587, 588, 589, 146, 146, 146, 146, 590, 591,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 450,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 205, 146, 146,
+    202, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 592,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 593, 146, 146, 593, 594, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 212,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 51, 51, 51, 51, 76, 157, 202, 595, 596, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    34, 34, 597, 34, 598, 215, 215, 215, 215, 215, 215, 215, 333, 146, 146, 146,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 334,
+    215, 215, 599, 215, 215, 215, 600, 601, 602, 215, 603, 215, 215, 215, 296, 146,
+    215, 215, 215, 215, 604, 146, 146, 146, 146, 146, 146, 146, 146, 146, 279, 605,
+    215, 215, 215, 215, 215, 295, 279, 471, 146, 146, 146, 146, 146, 146, 146, 146,
+    11, 606, 13, 607, 608, 609, 249, 11, 610, 611, 612, 613, 614, 11, 606, 13,
+    615, 616, 13, 617, 618, 619, 620, 11, 621, 13, 11, 606, 13, 607, 608, 13,
+    249, 11, 610, 620, 11, 621, 13, 11, 606, 13, 622, 11, 623, 624, 625, 626,
+    13, 627, 11, 628, 629, 630, 631, 13, 632, 11, 633, 13, 634, 635, 635, 635,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    34, 34, 34, 636, 34, 34, 637, 638, 639, 640, 48, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    641, 642, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    643, 644, 645, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 157, 646, 647, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 51, 648, 146, 51, 51, 649, 650,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 651, 206,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 652, 598, 146, 146,
+    11, 11, 610, 13, 653, 380, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 510, 279, 279, 654, 655, 146, 146, 146, 146,
+    510, 279, 656, 657, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    658, 51, 659, 660, 661, 662, 663, 664, 665, 212, 666, 212, 146, 146, 146, 667,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    215, 215, 335, 215, 215, 215, 215, 215, 215, 333, 344, 668, 668, 668, 215, 334,
+    669, 215, 215, 299, 670, 299, 670, 299, 670, 215, 671, 146, 146, 146, 672, 215,
+    673, 215, 215, 335, 674, 675, 334, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 676,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 677, 436, 436,
+    215, 215, 215, 215, 215, 215, 215, 333, 215, 215, 215, 215, 215, 674, 335, 437,
+    335, 215, 215, 215, 678, 182, 215, 215, 678, 215, 671, 675, 146, 146, 146, 146,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215, 215,
+    215, 215, 215, 215, 215, 333, 671, 679, 295, 215, 436, 296, 334, 182, 678, 295,
+    215, 215, 215, 215, 215, 215, 215, 215, 215, 680, 215, 215, 296, 146, 146, 198,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 146, 146,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 202, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 210, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 488, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 106, 146,
+    51, 210, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 51, 76, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146, 146,
+    681, 146, 682, 682, 682, 682, 682, 682, 146, 146, 146, 146, 146, 146, 146, 146,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 146,
+    401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401,
+    401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 401, 683,
+};
+
+const uint8_t unicode_class_stage3[10944] =
+{
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 90, 90, 90, 90, 90, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    87, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 19, 19, 19, 18,
+    18, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 14, 18, 15, 21, 12,
+    21, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 14, 19, 15, 19, 26,
+    26, 26, 26, 26, 26, 90, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    87, 18, 20, 20, 20, 20, 22, 18, 21, 22, 37, 16, 19, 27, 22, 21,
+    22, 19, 11, 11, 21, 34, 18, 18, 21, 11, 37, 17, 11, 11, 11, 18,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 19, 33, 33, 33, 33, 33, 33, 33, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 19, 34, 34, 34, 34, 34, 34, 34, 34,
+    33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34, 33, 34, 33, 34, 33,
+    34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34, 33, 34, 33, 34,
+    33, 34, 33, 34, 33, 34, 33, 34, 33, 33, 34, 33, 34, 33, 34, 34,
+    34, 33, 33, 34, 33, 34, 33, 33, 34, 33, 33, 33, 34, 34, 33, 33,
+    33, 33, 34, 33, 33, 34, 33, 33, 33, 34, 34, 34, 33, 33, 34, 33,
+    33, 34, 33, 34, 33, 34, 33, 33, 34, 33, 34, 34, 33, 34, 33, 33,
+    34, 33, 33, 33, 34, 33, 34, 33, 33, 34, 34, 37, 33, 34, 34, 34,
+    37, 37, 37, 37, 33, 35, 34, 33, 35, 34, 33, 35, 34, 33, 34, 33,
+    34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34, 33, 34,
+    34, 33, 35, 34, 33, 34, 33, 33, 33, 34, 33, 34, 33, 34, 33, 34,
+    33, 34, 33, 34, 34, 34, 34, 34, 34, 34, 33, 33, 34, 33, 33, 34,
+    34, 33, 34, 33, 33, 33, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    34, 34, 34, 34, 37, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 21, 21, 21, 21, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    36, 36, 36, 36, 36, 21, 21, 21, 21, 21, 21, 21, 36, 21, 36, 21,
+    21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 38, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    33, 34, 33, 34, 36, 21, 33, 34, 0, 0, 36, 34, 34, 34, 18, 33,
+    0, 0, 0, 0, 21, 21, 33, 18, 33, 33, 33, 0, 33, 0, 33, 33,
+    34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33,
+    34, 34, 33, 33, 33, 34, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    34, 34, 34, 34, 33, 34, 19, 33, 34, 33, 33, 34, 34, 33, 33, 33,
+    33, 34, 22, 6, 6, 6, 6, 6, 8, 8, 33, 34, 33, 34, 33, 34,
+    33, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 34,
+    0, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 0, 0, 36, 18, 18, 18, 18, 18, 18,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 18, 13, 0, 0, 22, 22, 20,
+    0, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 13, 38,
+    18, 38, 38, 18, 38, 38, 18, 38, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 37,
+    37, 37, 37, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 19, 19, 19, 18, 18, 20, 18, 18, 22, 22,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 18, 27, 18, 18, 18,
+    36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 6, 38, 38, 38, 38, 38, 38, 38,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 37, 37,
+    38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 18, 37, 38, 38, 38, 38, 38, 38, 38, 27, 22, 6,
+    6, 38, 38, 38, 38, 36, 36, 38, 38, 22, 6, 6, 6, 38, 37, 37,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 37, 37, 37, 22, 22, 37,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 27,
+    37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 36, 36, 22, 18, 18, 18, 36, 0, 0, 6, 20, 20,
+    37, 37, 37, 37, 37, 37, 38, 38, 6, 6, 36, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 36, 38, 38, 38, 36, 38, 38, 38, 38, 6, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 0, 0, 18, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 21, 37, 37, 37, 37, 37, 37, 0,
+    27, 27, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6, 6, 6, 6,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    6, 6, 27, 38, 38, 38, 38, 38, 38, 38, 6, 6, 6, 6, 6, 6,
+    38, 38, 38, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 39, 6, 37, 39, 39,
+    39, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39, 39, 6, 39, 39,
+    37, 6, 6, 6, 6, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 38, 38, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    18, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 38, 39, 39, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 37,
+    37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37,
+    37, 0, 37, 0, 0, 0, 37, 37, 37, 37, 0, 0, 6, 37, 39, 39,
+    39, 38, 38, 38, 38, 0, 0, 39, 39, 0, 0, 39, 39, 6, 37, 0,
+    0, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 37, 37, 0, 37,
+    37, 37, 38, 38, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    37, 37, 20, 20, 11, 11, 11, 11, 11, 11, 22, 20, 37, 18, 6, 0,
+    0, 38, 38, 39, 0, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 37,
+    37, 0, 37, 37, 0, 37, 37, 0, 37, 37, 0, 0, 6, 0, 39, 39,
+    39, 38, 38, 0, 0, 0, 0, 38, 38, 0, 0, 38, 38, 6, 0, 0,
+    0, 38, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37, 37, 0, 37, 0,
+    0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    38, 38, 37, 37, 37, 38, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 38, 38, 39, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37,
+    37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 0, 37, 37, 0, 37, 37, 37, 37, 37, 0, 0, 6, 37, 39, 39,
+    39, 38, 38, 38, 38, 38, 0, 38, 38, 39, 0, 39, 39, 6, 0, 0,
+    37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 20, 0, 0, 0, 0, 0, 0, 0, 37, 38, 38, 38, 6, 6, 6,
+    0, 38, 39, 39, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 37,
+    37, 0, 37, 37, 0, 37, 37, 37, 37, 37, 0, 0, 6, 37, 39, 38,
+    39, 38, 38, 38, 38, 0, 0, 39, 39, 0, 0, 39, 39, 6, 0, 0,
+    0, 0, 0, 0, 0, 6, 38, 39, 0, 0, 0, 0, 37, 37, 0, 37,
+    22, 37, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 38, 37, 0, 37, 37, 37, 37, 37, 37, 0, 0, 0, 37, 37,
+    37, 0, 37, 37, 37, 37, 0, 0, 0, 37, 37, 0, 37, 0, 37, 37,
+    0, 0, 0, 37, 37, 0, 0, 0, 37, 37, 37, 0, 0, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 39, 39,
+    38, 39, 39, 0, 0, 0, 39, 39, 39, 0, 39, 39, 39, 6, 0, 0,
+    37, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 22, 22, 22, 22, 22, 22, 20, 22, 0, 0, 0, 0, 0,
+    38, 39, 39, 39, 6, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37,
+    37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 6, 37, 38, 38,
+    38, 39, 39, 39, 39, 0, 38, 38, 38, 0, 38, 38, 38, 6, 0, 0,
+    0, 0, 0, 0, 0, 38, 38, 0, 37, 37, 37, 0, 0, 37, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 18, 11, 11, 11, 11, 11, 11, 11, 22,
+    37, 38, 39, 39, 18, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37,
+    37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 0, 0, 6, 37, 39, 38,
+    39, 39, 39, 39, 39, 0, 38, 39, 39, 0, 39, 39, 38, 6, 0, 0,
+    0, 0, 0, 0, 0, 39, 39, 0, 0, 0, 0, 0, 0, 37, 37, 0,
+    0, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    38, 38, 39, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 37, 39, 39,
+    39, 38, 38, 38, 38, 0, 39, 39, 39, 0, 39, 39, 39, 6, 37, 22,
+    0, 0, 0, 0, 37, 37, 37, 39, 11, 11, 11, 11, 11, 11, 11, 37,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 37, 37, 37, 37, 37, 37,
+    0, 38, 39, 39, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 37, 37, 37, 37, 37, 37,
+    37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 6, 0, 0, 0, 0, 39,
+    39, 39, 38, 38, 38, 0, 38, 0, 39, 39, 39, 39, 39, 39, 39, 39,
+    0, 0, 39, 39, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 38, 37, 37, 38, 38, 38, 38, 38, 38, 38, 0, 0, 0, 0, 20,
+    37, 37, 37, 37, 37, 37, 36, 6, 6, 6, 6, 6, 6, 38, 6, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 37, 37, 0, 37, 0, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37,
+    37, 37, 37, 37, 0, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 38, 37, 37, 38, 38, 38, 38, 38, 38, 6, 38, 38, 37, 0, 0,
+    37, 37, 37, 37, 37, 0, 36, 0, 6, 6, 6, 6, 6, 38, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 37, 37, 37, 37,
+    37, 22, 22, 22, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 22, 18, 22, 22, 22, 6, 6, 22, 22, 22, 22, 22, 22,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 22, 6, 22, 6, 22, 6, 14, 15, 14, 15, 7, 7,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0,
+    0, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+    38, 38, 6, 6, 6, 18, 6, 6, 37, 37, 37, 37, 37, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 0, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 0, 22, 22,
+    22, 22, 22, 22, 22, 22, 6, 22, 22, 22, 22, 22, 22, 0, 22, 22,
+    18, 18, 18, 18, 18, 22, 22, 22, 22, 18, 18, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 38, 38, 38,
+    38, 39, 38, 38, 38, 38, 38, 6, 39, 6, 6, 39, 39, 38, 38, 37,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 18, 18, 18, 18,
+    37, 37, 37, 37, 37, 37, 39, 39, 38, 38, 37, 37, 37, 37, 38, 38,
+    38, 37, 39, 39, 39, 37, 37, 39, 39, 39, 39, 39, 39, 39, 37, 37,
+    37, 38, 38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 38, 39, 39, 38, 38, 39, 39, 39, 39, 39, 39, 38, 37, 39,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 39, 39, 39, 38, 22, 22,
+    33, 33, 33, 33, 33, 33, 0, 33, 0, 0, 0, 0, 0, 33, 0, 0,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 18, 36, 34, 34, 34,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 0, 37, 37, 37, 37, 0, 0,
+    37, 0, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 0,
+    37, 0, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 6, 6, 6,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 0, 0, 34, 34, 34, 34, 34, 34, 0, 0,
+    13, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 22, 18, 37,
+    87, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 14, 15, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 18, 18, 18, 42, 42,
+    42, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 38, 38, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37,
+    37, 37, 38, 38, 7, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37,
+    37, 0, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 6, 6, 39, 38, 38, 38, 38, 38, 38, 38, 39, 39,
+    39, 39, 39, 39, 39, 39, 38, 39, 39, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 18, 18, 18, 36, 18, 18, 18, 20, 37, 6, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 13, 18, 18, 18, 18, 6, 6, 6, 27, 6,
+    37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 37, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0,
+    38, 38, 38, 39, 39, 39, 39, 38, 38, 39, 39, 39, 0, 0, 0, 0,
+    39, 39, 38, 39, 39, 39, 39, 39, 39, 6, 6, 6, 0, 0, 0, 0,
+    22, 0, 0, 0, 18, 18, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0,
+    37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 0, 0, 0, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    37, 37, 37, 37, 37, 37, 37, 38, 38, 39, 39, 38, 0, 0, 18, 18,
+    37, 37, 37, 37, 37, 39, 38, 39, 38, 38, 38, 38, 38, 38, 38, 0,
+    6, 39, 38, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 39,
+    39, 39, 39, 38, 38, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0, 6,
+    18, 18, 18, 18, 18, 18, 18, 36, 18, 18, 18, 18, 18, 18, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 38,
+    38, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 38, 38, 38, 0,
+    38, 38, 38, 38, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 6, 39, 38, 38, 38, 38, 38, 39, 38, 39, 39, 39,
+    39, 39, 38, 39, 7, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0,
+    18, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 18, 18, 0,
+    38, 38, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 39, 38, 38, 38, 38, 39, 39, 38, 38, 7, 6, 38, 38, 37, 37,
+    37, 37, 37, 37, 37, 37, 6, 39, 38, 38, 39, 39, 39, 38, 39, 38,
+    38, 38, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18,
+    37, 37, 37, 37, 39, 39, 39, 39, 39, 39, 39, 39, 38, 38, 38, 38,
+    38, 38, 38, 38, 39, 39, 38, 6, 0, 0, 0, 18, 18, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 36, 36, 36, 36, 36, 36, 18, 18,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 0, 33, 33, 33,
+    18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 18, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 7, 6, 6, 6, 6, 6, 6, 6, 37, 37, 37, 37, 6, 37, 37,
+    37, 37, 37, 37, 6, 37, 37, 7, 6, 6, 37, 0, 0, 0, 0, 0,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 36, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 36, 36, 36, 36,
+    6, 6, 6, 6, 6, 6, 6, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    33, 34, 33, 34, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33,
+    34, 34, 34, 34, 34, 34, 0, 0, 33, 33, 33, 33, 33, 33, 0, 0,
+    34, 34, 34, 34, 34, 34, 34, 34, 0, 33, 0, 33, 0, 33, 0, 33,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0,
+    34, 34, 34, 34, 34, 34, 34, 34, 35, 35, 35, 35, 35, 35, 35, 35,
+    34, 34, 34, 34, 34, 0, 34, 34, 33, 33, 33, 33, 35, 21, 34, 21,
+    21, 21, 34, 34, 34, 0, 34, 34, 33, 33, 33, 33, 35, 21, 21, 21,
+    34, 34, 34, 34, 0, 0, 34, 34, 33, 33, 33, 33, 0, 21, 21, 21,
+    34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 21, 21, 21,
+    0, 0, 34, 34, 34, 0, 34, 34, 33, 33, 33, 33, 35, 21, 21, 0,
+    87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 87, 27, 27, 27, 27, 27,
+    13, 13, 13, 13, 13, 13, 18, 18, 16, 17, 14, 16, 16, 17, 14, 16,
+    18, 18, 18, 18, 18, 18, 18, 18, 88, 89, 27, 27, 27, 27, 27, 87,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 16, 17, 18, 18, 18, 18, 12,
+    12, 18, 18, 18, 19, 14, 15, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 19, 18, 12, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 87,
+    27, 27, 27, 27, 27, 0, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    11, 36, 0, 0, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 36,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 19, 19, 19, 14, 15, 0,
+    36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0,
+    20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+    20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 8, 8, 8,
+    8, 6, 8, 8, 8, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 33, 22, 22, 22, 22, 33, 22, 22, 34, 33, 33, 33, 34, 34,
+    33, 33, 33, 34, 22, 33, 22, 22, 19, 33, 33, 33, 33, 33, 22, 22,
+    22, 22, 22, 22, 33, 22, 33, 22, 33, 22, 33, 33, 33, 33, 22, 34,
+    33, 33, 33, 33, 34, 37, 37, 37, 37, 34, 22, 22, 34, 34, 33, 33,
+    19, 19, 19, 19, 19, 33, 34, 34, 34, 34, 22, 19, 22, 22, 34, 22,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    42, 42, 42, 33, 34, 42, 42, 42, 42, 11, 22, 22, 0, 0, 0, 0,
+    19, 19, 19, 19, 19, 22, 22, 22, 22, 22, 19, 19, 22, 22, 22, 22,
+    19, 22, 22, 19, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 19, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19,
+    22, 22, 19, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 22, 22, 22, 22,
+    19, 19, 22, 22, 22, 22, 22, 22, 22, 14, 15, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19,
+    19, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 11, 11, 11, 11, 11, 11,
+    22, 22, 22, 22, 22, 22, 22, 19, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 19, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 19, 19, 19, 19, 19, 19, 19, 19,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 19,
+    22, 22, 22, 22, 22, 22, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    19, 19, 19, 19, 19, 14, 15, 19, 19, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    19, 19, 19, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 19, 19, 19, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 14, 15, 19, 19, 19, 19,
+    19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 19, 14, 15, 19, 19,
+    19, 19, 19, 19, 19, 22, 22, 19, 19, 19, 19, 19, 19, 22, 22, 22,
+    22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    33, 34, 33, 33, 33, 34, 34, 33, 34, 33, 34, 33, 34, 33, 33, 33,
+    33, 34, 33, 34, 34, 33, 34, 34, 34, 34, 34, 34, 36, 36, 33, 33,
+    33, 34, 33, 34, 34, 22, 22, 22, 22, 22, 22, 33, 34, 33, 34, 6,
+    6, 6, 33, 34, 0, 0, 0, 0, 0, 18, 18, 18, 18, 11, 18, 18,
+    34, 34, 34, 34, 34, 34, 0, 34, 0, 0, 0, 0, 0, 34, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 36,
+    18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 0,
+    18, 18, 16, 17, 16, 17, 18, 18, 18, 16, 17, 18, 16, 17, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 13, 18, 18, 13, 18, 16, 17, 18, 18,
+    16, 17, 14, 15, 14, 15, 14, 15, 14, 15, 18, 18, 18, 18, 18, 36,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 13, 13, 18, 18, 18, 18,
+    13, 18, 14, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    22, 22, 18, 18, 18, 14, 15, 14, 15, 14, 15, 14, 15, 13, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0,
+    87, 18, 18, 18, 22, 36, 37, 42, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 22, 22, 14, 15, 14, 15, 14, 15, 14, 15, 13, 14, 15, 15,
+    22, 42, 42, 42, 42, 42, 42, 42, 42, 42, 6, 6, 6, 6, 7, 7,
+    13, 36, 36, 36, 36, 36, 22, 22, 42, 42, 42, 36, 37, 18, 22, 22,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 6, 6, 21, 21, 36, 36, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 18, 36, 36, 36, 37,
+    0, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    22, 22, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 11, 11, 11, 11, 11, 11,
+    22, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    37, 37, 37, 37, 37, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 37, 37, 0, 0, 0, 0,
+    33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 37, 6,
+    8, 8, 8, 18, 38, 38, 38, 38, 38, 38, 38, 38, 6, 6, 18, 36,
+    33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 36, 36, 38, 38,
+    37, 37, 37, 37, 37, 37, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42,
+    6, 6, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    21, 21, 21, 21, 21, 21, 21, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    21, 21, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    34, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    36, 34, 34, 34, 34, 34, 34, 34, 34, 33, 34, 33, 34, 33, 33, 34,
+    33, 34, 33, 34, 33, 34, 33, 34, 36, 21, 21, 33, 34, 33, 34, 37,
+    33, 34, 33, 34, 34, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 33, 33, 33, 33, 34,
+    33, 33, 33, 33, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34, 33, 34,
+    33, 34, 33, 34, 33, 33, 33, 33, 34, 33, 34, 0, 0, 0, 0, 0,
+    33, 34, 0, 34, 0, 34, 33, 34, 33, 34, 0, 0, 0, 0, 0, 0,
+    0, 0, 36, 36, 36, 33, 34, 37, 36, 36, 34, 37, 37, 37, 37, 37,
+    37, 37, 38, 37, 37, 37, 6, 37, 37, 37, 37, 38, 37, 37, 37, 37,
+    37, 37, 37, 39, 39, 38, 38, 39, 22, 22, 22, 22, 6, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 22, 22, 20, 22, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 6, 38, 0, 0, 0, 0, 0, 0, 0, 0, 18, 18,
+    6, 6, 37, 37, 37, 37, 37, 37, 18, 18, 18, 37, 18, 37, 37, 38,
+    37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 6, 6, 6, 18, 18,
+    37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 39, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    37, 37, 37, 6, 39, 39, 38, 38, 38, 38, 39, 39, 38, 38, 39, 39,
+    7, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 36,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 18, 18,
+    37, 37, 37, 37, 37, 38, 36, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 37, 37, 37, 37, 37, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 39,
+    39, 38, 38, 39, 39, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 38, 37, 37, 37, 37, 37, 37, 37, 37, 38, 39, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 18, 18, 18, 18,
+    36, 37, 37, 37, 37, 37, 37, 22, 22, 22, 37, 39, 38, 39, 37, 37,
+    38, 37, 38, 38, 38, 37, 37, 38, 38, 37, 37, 37, 37, 37, 38, 6,
+    37, 6, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 36, 18, 18,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 38, 38, 39, 39,
+    18, 18, 37, 36, 36, 39, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 37, 37, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 37, 37, 0,
+    0, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 21, 36, 36, 36, 36,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 36, 21, 21, 0, 0, 0, 0,
+    37, 37, 37, 39, 39, 38, 39, 39, 38, 39, 39, 18, 7, 6, 0, 0,
+    37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 37, 37, 37, 37, 37,
+    28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29,
+    34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 37, 38, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 19, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 0, 37, 0,
+    37, 37, 0, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21, 21,
+    21, 21, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 15, 14,
+    0, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 22,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 20, 22, 22, 22,
+    18, 18, 18, 18, 18, 18, 18, 14, 15, 18, 0, 0, 0, 0, 0, 0,
+    18, 13, 13, 12, 12, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 18, 18, 14, 15, 18, 18, 18, 18, 12, 12, 12,
+    18, 18, 18, 0, 18, 18, 18, 18, 13, 14, 15, 14, 15, 14, 15, 18,
+    18, 18, 19, 13, 19, 19, 19, 0, 18, 20, 18, 18, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 27,
+    0, 18, 18, 18, 20, 18, 18, 18, 14, 15, 18, 19, 18, 13, 18, 18,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 14, 19, 15, 19, 14,
+    15, 18, 14, 15, 18, 18, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    36, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 36, 36,
+    0, 0, 37, 37, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 37, 37,
+    0, 0, 37, 37, 37, 37, 37, 37, 0, 0, 37, 37, 37, 0, 0, 0,
+    20, 20, 19, 21, 22, 20, 20, 0, 22, 19, 19, 19, 19, 22, 22, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 27, 27, 22, 22, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 0, 37,
+    18, 18, 18, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    42, 42, 42, 42, 42, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 11, 11, 22, 22, 22, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0,
+    22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 0, 0,
+    6, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+    11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 37, 37,
+    37, 42, 37, 37, 37, 37, 37, 37, 37, 37, 42, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 18,
+    37, 37, 37, 37, 0, 0, 0, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    18, 42, 42, 42, 42, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34,
+    33, 33, 33, 33, 0, 0, 0, 0, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 0, 33, 33, 33, 33,
+    33, 33, 33, 0, 33, 33, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 0, 34, 34, 34, 34, 34, 34, 34, 0, 34, 34, 0, 0, 0,
+    36, 36, 36, 36, 36, 36, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 0, 36, 36, 36, 36, 36, 36, 36, 36, 36, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 0, 0, 37, 0, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 0, 37, 37, 0, 0, 0, 37, 0, 0, 37,
+    37, 37, 37, 37, 37, 37, 0, 18, 11, 11, 11, 11, 11, 11, 11, 11,
+    37, 37, 37, 37, 37, 37, 37, 22, 22, 11, 11, 11, 11, 11, 11, 11,
+    0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    37, 37, 37, 0, 37, 37, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+    37, 37, 37, 37, 37, 37, 11, 11, 11, 11, 11, 11, 0, 0, 0, 18,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 18,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 11, 11, 37, 37,
+    0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    37, 38, 38, 38, 0, 38, 38, 0, 0, 0, 0, 0, 38, 38, 38, 38,
+    37, 37, 37, 37, 0, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 0, 0, 6, 6, 6, 0, 0, 0, 0, 6,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 11, 11, 18,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 11, 11, 11,
+    37, 37, 37, 37, 37, 37, 37, 37, 22, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 6, 6, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+    18, 18, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 0, 0, 0, 18, 18, 18, 18, 18, 18, 18,
+    37, 37, 37, 37, 37, 37, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11,
+    37, 37, 37, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11,
+    37, 37, 0, 0, 0, 0, 0, 0, 0, 18, 18, 18, 18, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11,
+    33, 33, 33, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    34, 34, 34, 0, 0, 0, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11,
+    37, 37, 37, 37, 38, 38, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 38, 38, 13, 0, 0,
+    37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 37, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 11, 11, 11, 11, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    37, 37, 6, 6, 6, 6, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+    39, 38, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 6, 18, 18, 18, 18, 18, 18, 18, 0, 0,
+    11, 11, 11, 11, 11, 11, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 37, 37, 38, 38, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6,
+    6, 6, 39, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    39, 39, 39, 38, 38, 38, 38, 39, 39, 6, 6, 18, 18, 27, 18, 18,
+    18, 18, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 0, 0,
+    38, 38, 38, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 39, 38, 38, 38,
+    38, 38, 38, 6, 6, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    18, 18, 18, 18, 37, 39, 39, 37, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 6, 18, 18, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 38, 39,
+    7, 37, 37, 37, 37, 18, 18, 18, 18, 6, 6, 6, 6, 18, 39, 38,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 37, 18, 37, 18, 18, 18,
+    0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 38,
+    38, 38, 39, 39, 38, 7, 6, 38, 18, 18, 18, 18, 18, 18, 38, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 0, 37, 37, 37, 37, 0, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 18, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38,
+    39, 39, 39, 38, 38, 38, 38, 38, 38, 6, 6, 0, 0, 0, 0, 0,
+    38, 38, 39, 39, 0, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 37,
+    37, 0, 37, 37, 0, 37, 37, 37, 37, 37, 0, 6, 6, 37, 39, 39,
+    38, 39, 39, 39, 39, 0, 0, 39, 39, 0, 0, 39, 39, 7, 0, 0,
+    37, 0, 0, 0, 0, 0, 0, 39, 0, 0, 0, 0, 0, 37, 37, 37,
+    37, 37, 39, 39, 0, 0, 6, 6, 6, 6, 6, 6, 6, 0, 0, 0,
+    6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38,
+    39, 39, 6, 38, 38, 39, 6, 37, 37, 37, 37, 18, 18, 18, 18, 18,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 18, 18, 0, 18, 6, 37,
+    39, 39, 39, 38, 38, 38, 38, 38, 38, 39, 38, 39, 39, 39, 39, 38,
+    38, 39, 6, 6, 37, 37, 18, 37, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39,
+    39, 39, 38, 38, 38, 38, 0, 0, 39, 39, 39, 39, 38, 38, 39, 6,
+    6, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+    18, 18, 18, 18, 18, 18, 18, 18, 37, 37, 37, 37, 38, 38, 0, 0,
+    39, 39, 39, 38, 38, 38, 38, 38, 38, 38, 38, 39, 39, 38, 39, 6,
+    38, 18, 18, 18, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 39, 38, 39, 39,
+    38, 38, 38, 38, 38, 38, 7, 6, 37, 18, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 38, 38, 38,
+    39, 39, 38, 38, 38, 38, 39, 38, 38, 38, 38, 6, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 11, 11, 18, 18, 18, 22,
+    38, 38, 38, 38, 38, 38, 38, 38, 39, 6, 6, 18, 0, 0, 0, 0,
+    11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37,
+    37, 37, 37, 37, 37, 37, 37, 0, 0, 37, 0, 0, 37, 37, 37, 37,
+    37, 37, 37, 37, 0, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37,
+    39, 39, 39, 39, 39, 39, 0, 39, 39, 0, 0, 38, 38, 7, 6, 37,
+    39, 37, 39, 6, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 37, 37, 37, 37, 37, 37,
+    37, 39, 39, 39, 38, 38, 38, 38, 0, 0, 38, 38, 39, 39, 39, 39,
+    6, 37, 18, 37, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 37, 37, 37, 37, 37,
+    37, 37, 37, 6, 6, 38, 38, 38, 38, 39, 37, 38, 38, 38, 38, 18,
+    18, 18, 18, 18, 18, 18, 18, 6, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 38, 38, 38, 38, 38, 38, 39, 39, 38, 38, 38, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 39, 6, 6, 18, 18, 18, 37, 18, 18,
+    18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    38, 38, 38, 38, 38, 38, 38, 0, 38, 38, 38, 38, 38, 38, 39, 6,
+    37, 18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 18, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    0, 0, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 0, 39, 38, 38, 38, 38, 38, 38,
+    38, 39, 38, 38, 39, 38, 38, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 0, 37, 37, 37, 37, 37,
+    37, 38, 38, 38, 38, 38, 38, 0, 0, 0, 38, 0, 38, 38, 0, 38,
+    38, 38, 6, 38, 6, 6, 37, 38, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 0, 37, 37, 0, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 39, 39, 39, 39, 39, 0,
+    38, 38, 0, 39, 39, 38, 39, 6, 37, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 38, 38, 39, 39, 18, 18, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 22, 22, 22, 22, 22, 22, 22, 22, 20, 20, 20,
+    20, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 42, 0,
+    18, 18, 18, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 18, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 18, 18, 18, 18, 18, 22, 22, 22, 22,
+    36, 36, 36, 36, 18, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 11, 11, 11, 11, 11,
+    11, 11, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 0, 37, 37, 37,
+    11, 11, 11, 11, 11, 11, 11, 18, 18, 18, 18, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 0, 0, 38,
+    37, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39, 39,
+    39, 39, 39, 39, 39, 39, 39, 39, 0, 0, 0, 0, 0, 0, 0, 38,
+    38, 38, 38, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36, 36,
+    36, 36, 18, 36, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    39, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    36, 36, 36, 36, 0, 36, 36, 36, 36, 36, 36, 36, 0, 36, 36, 0,
+    37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 37, 37, 37, 37, 0, 0, 0, 0, 0, 0, 0, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 0, 22, 6, 38, 18,
+    27, 27, 27, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 0, 0, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 7, 7, 6, 6, 6, 22, 22, 22, 7, 7, 7,
+    7, 7, 7, 27, 27, 27, 27, 27, 27, 27, 27, 6, 6, 6, 6, 6,
+    6, 6, 6, 22, 22, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 6, 6, 6, 6, 22, 22,
+    22, 22, 6, 6, 6, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 34, 34,
+    34, 34, 34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 0, 33, 33,
+    0, 0, 33, 0, 0, 33, 33, 0, 0, 33, 33, 33, 33, 0, 33, 33,
+    33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 0, 34, 0, 34, 34, 34,
+    34, 34, 34, 34, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 33, 33, 0, 33, 33, 33, 33, 0, 0, 33, 33, 33,
+    33, 33, 33, 33, 33, 0, 33, 33, 33, 33, 33, 33, 33, 0, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 0, 33, 33, 33, 33, 0,
+    33, 33, 33, 33, 33, 0, 33, 0, 0, 0, 33, 33, 33, 33, 33, 33,
+    33, 0, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 0, 0, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 19, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 19, 34, 34, 34, 34,
+    34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 19, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 19, 34, 34, 34, 34, 34, 34, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 19, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 19,
+    34, 34, 34, 34, 34, 34, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 33, 19,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 19, 34, 34, 34, 34, 34, 34,
+    33, 33, 33, 33, 33, 33, 33, 33, 33, 19, 34, 34, 34, 34, 34, 34,
+    34, 34, 34, 19, 34, 34, 34, 34, 34, 34, 33, 34, 0, 0, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    6, 6, 6, 6, 6, 6, 6, 22, 22, 22, 22, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 22, 22, 22,
+    22, 22, 22, 22, 22, 6, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 6, 22, 22, 18, 18, 18, 18, 18, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 6, 6, 6,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 37, 34, 34, 34, 34, 34,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0,
+    38, 38, 38, 38, 38, 38, 38, 0, 38, 38, 38, 38, 38, 38, 38, 38,
+    38, 38, 38, 38, 38, 38, 38, 38, 38, 0, 0, 38, 38, 38, 38, 38,
+    38, 38, 0, 38, 38, 0, 38, 38, 38, 38, 38, 0, 0, 0, 0, 0,
+    6, 6, 6, 6, 6, 6, 6, 36, 36, 36, 36, 36, 36, 36, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 37, 22,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 6, 6, 6, 6,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 20,
+    37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 0, 37, 37, 0,
+    37, 37, 37, 37, 37, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    34, 34, 34, 34, 6, 6, 6, 38, 6, 6, 6, 36, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11, 11, 11,
+    20, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0,
+    37, 37, 37, 37, 0, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 37,
+    0, 37, 37, 0, 37, 0, 0, 37, 0, 37, 37, 37, 37, 37, 37, 37,
+    37, 37, 37, 0, 37, 37, 37, 37, 0, 37, 0, 37, 0, 0, 0, 0,
+    0, 0, 37, 0, 0, 0, 0, 37, 0, 37, 0, 37, 0, 37, 37, 37,
+    0, 37, 37, 0, 37, 0, 0, 37, 0, 37, 0, 37, 0, 37, 0, 37,
+    0, 37, 37, 0, 37, 0, 0, 37, 37, 37, 37, 0, 37, 37, 37, 37,
+    37, 37, 37, 0, 37, 37, 37, 37, 0, 37, 37, 37, 37, 0, 37, 0,
+    37, 37, 37, 37, 37, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37,
+    0, 37, 37, 37, 0, 37, 37, 37, 37, 37, 0, 37, 37, 37, 37, 37,
+    19, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 22, 22, 22,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0,
+    0, 0, 0, 0, 0, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 21, 21, 21, 21, 21,
+    22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 22, 22, 22,
+    22, 22, 22, 22, 22, 22, 22, 22, 0, 0, 0, 0, 0, 0, 0, 0,
+    22, 22, 22, 22, 22, 0, 0, 0, 22, 22, 22, 22, 22, 0, 0, 0,
+    22, 22, 22, 0, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22, 22,
+    0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 29, 0, 0,
+};
+
+const uint8_t unicode_combining_class_stage1[1088] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 9, 10, 11, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 12, 13, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 14, 15,
+    16, 9, 17, 18, 19, 20, 21, 22, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 23, 24, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 25,
+    9, 9, 9, 9, 26, 9, 9, 9, 27, 9, 28, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+};
+
+const uint8_t unicode_combining_class_stage2[1856] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 11, 12, 0, 0, 0,
+    0, 13, 0, 0, 14, 15, 0, 16, 0, 0, 0, 0, 0, 17, 18, 0,
+    0, 19, 0, 20, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23,
+    0, 24, 25, 0, 0, 26, 0, 0, 0, 27, 0, 0, 28, 29, 30, 31,
+    0, 0, 0, 32, 33, 34, 0, 0, 0, 0, 0, 32, 33, 0, 0, 35,
+    0, 0, 0, 32, 33, 0, 0, 0, 0, 0, 0, 32, 33, 0, 0, 0,
+    0, 0, 0, 32, 33, 0, 0, 0, 0, 0, 0, 0, 33, 0, 0, 0,
+    0, 0, 0, 32, 33, 36, 0, 0, 0, 0, 0, 32, 33, 0, 0, 0,
+    0, 0, 0, 37, 33, 0, 0, 0, 0, 0, 0, 0, 38, 0, 0, 0,
+    0, 0, 0, 39, 40, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0, 0,
+    0, 43, 0, 44, 0, 0, 0, 45, 46, 0, 0, 0, 47, 0, 0, 0,
+    0, 0, 0, 48, 0, 0, 0, 0, 49, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 51, 0, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 53, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 54, 0, 0, 0, 0, 0,
+    0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 56, 0, 0, 0, 0, 57, 58, 0, 0, 0, 59, 60, 0, 0, 0,
+    0, 0, 0, 61, 52, 0, 62, 63, 0, 0, 64, 0, 0, 0, 65, 66,
+    0, 0, 0, 67, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 69, 70,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 71, 72, 1, 73,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 75, 76,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 78,
+    0, 0, 0, 0, 0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 80, 0, 0, 0, 0, 0, 0, 81, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 77, 82, 0, 83, 0, 0, 0, 0, 0, 78,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    84, 0, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 52, 0, 1, 78,
+    0, 0, 86, 0, 0, 87, 0, 0, 0, 0, 0, 88, 57, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 89, 90, 0, 0, 84,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 33, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 92, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 49,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 0,
+    0, 0, 0, 0, 0, 0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    95, 0, 0, 96, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 97, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 98, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 99, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 100, 93, 0, 0, 101, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 84, 0, 0, 102, 0, 0, 0, 103, 0, 0, 0, 0,
+    104, 0, 0, 105, 0, 0, 0, 88, 0, 0, 0, 0, 106, 0, 0, 0,
+    0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 0,
+    0, 0, 0, 109, 33, 0, 110, 111, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 112, 35, 0, 0, 0, 0, 0, 0, 113, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 114, 0, 0, 0,
+    0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 0,
+    0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 117, 88, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0,
+    0, 0, 0, 52, 118, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 120, 0, 0, 0, 0, 118, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 121,
+    0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 123,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 125, 126, 127, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    130, 131, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 122, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 133, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 134, 0, 0,
+    0, 0, 0, 0, 135, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint8_t unicode_combining_class_stage3[2176] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 232, 220, 220, 220, 220, 232, 216, 220, 220, 220, 220,
+    220, 202, 202, 220, 220, 220, 220, 202, 202, 220, 220, 220, 220, 220, 220, 220,
+    220, 220, 220, 220, 1, 1, 1, 1, 1, 220, 220, 220, 220, 230, 230, 230,
+    230, 230, 230, 230, 230, 240, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0,
+    230, 230, 230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233,
+    234, 234, 233, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 220, 230, 230, 230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230,
+    230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 230, 230, 222, 228, 230,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 0, 23,
+    0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 230, 30, 31, 32, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29, 30, 31,
+    32, 33, 34, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220,
+    35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230,
+    230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230, 220, 0, 0,
+    0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230,
+    230, 230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 0, 230, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220,
+    220, 220, 220, 220, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 0, 220, 230, 230, 220, 230, 230, 220, 230, 230, 230, 220, 220, 220,
+    27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 84, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 103, 103, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0,
+    0, 129, 130, 0, 132, 0, 0, 0, 0, 0, 130, 130, 130, 130, 0, 0,
+    130, 0, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+    0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220,
+    230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0, 220,
+    220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0,
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 230, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230, 230, 220, 220, 220, 220,
+    230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 230, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0,
+    230, 230, 220, 230, 230, 230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220,
+    202, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220, 230, 220,
+    230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0,
+    0, 230, 0, 0, 0, 1, 1, 230, 220, 230, 1, 1, 220, 220, 220, 220,
+    230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232, 222, 224, 224,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0,
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 0, 230, 230, 220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230,
+    0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0,
+    230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+    0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0,
+    230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0,
+    230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0,
+    0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216,
+    216, 216, 216, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 220, 220,
+    220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0,
+    0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230,
+    220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 7, 0, 0, 0, 0, 0,
+};
+
+const uint8_t unicode_decomposition_stage1[1088] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 5, 9, 5, 10, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 5,
+    5, 5, 5, 5, 12, 13, 14, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 15, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 16, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+const uint8_t unicode_decomposition_stage2[1088] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4,
+    5, 6, 7, 8, 9, 10, 11, 12, 0, 0, 13, 14, 15, 16, 17, 18,
+    19, 20, 21, 22, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 23, 0, 0, 24, 25, 26, 27, 28, 29, 30, 0, 0,
+    31, 32, 0, 33, 0, 34, 0, 35, 0, 0, 0, 0, 36, 37, 38, 39,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0, 41, 42, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 43, 44, 0, 45, 0, 0, 0, 0, 0, 0, 46, 47, 0, 0,
+    0, 0, 0, 48, 0, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 50, 51, 0, 0, 0, 52, 0, 0, 53, 0, 0, 0,
+    0, 0, 0, 0, 54, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0,
+    0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 58, 59, 60, 61, 62, 63, 64, 65, 0, 0, 0, 0,
+    0, 0, 66, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    67, 68, 0, 69, 70, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86,
+    87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102,
+    103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 104, 0, 0, 0, 0, 0, 0, 105, 106, 0, 107, 0, 0, 0,
+    108, 0, 109, 0, 110, 0, 111, 112, 113, 0, 114, 0, 0, 0, 115, 0,
+    0, 0, 116, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 118, 119, 120, 121, 0, 122, 123, 124, 125, 126, 0, 127,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 0, 0,
+    0, 158, 159, 160, 161, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 162, 163, 0, 0, 0, 0, 0,
+    0, 0, 164, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 166, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 167, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 168, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 169, 170, 0, 0, 0, 0, 171, 172, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188,
+    189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204,
+    205, 206, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint16_t unicode_decomposition_stage3[3312] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 4, 7, 10, 13, 16, 0, 19, 22, 25, 28, 31, 34, 37, 40, 43,
+    0, 46, 49, 52, 55, 58, 61, 0, 0, 64, 67, 70, 73, 76, 0, 0,
+    79, 82, 85, 88, 91, 94, 0, 97, 100, 103, 106, 109, 112, 115, 118, 121,
+    0, 124, 127, 130, 133, 136, 139, 0, 0, 142, 145, 148, 151, 154, 0, 157,
+    160, 163, 166, 169, 172, 175, 178, 181, 184, 187, 190, 193, 196, 199, 202, 205,
+    0, 0, 208, 211, 214, 217, 220, 223, 226, 229, 232, 235, 238, 241, 244, 247,
+    250, 253, 256, 259, 262, 265, 0, 0, 268, 271, 274, 277, 280, 283, 286, 289,
+    292, 0, 0, 0, 295, 298, 301, 304, 0, 307, 310, 313, 316, 319, 322, 0,
+    0, 0, 0, 325, 328, 331, 334, 337, 340, 0, 0, 0, 343, 346, 349, 352,
+    355, 358, 0, 0, 361, 364, 367, 370, 373, 376, 379, 382, 385, 388, 391, 394,
+    397, 400, 403, 406, 409, 412, 0, 0, 415, 418, 421, 424, 427, 430, 433, 436,
+    439, 442, 445, 448, 451, 454, 457, 460, 463, 466, 469, 472, 475, 478, 481, 0,
+    484, 487, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 490,
+    493, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 496, 499, 502,
+    505, 508, 511, 514, 517, 520, 524, 528, 532, 536, 540, 544, 548, 0, 552, 556,
+    560, 564, 568, 571, 0, 0, 574, 577, 580, 583, 586, 589, 592, 596, 600, 603,
+    606, 0, 0, 0, 609, 612, 0, 0, 615, 618, 621, 625, 629, 632, 635, 638,
+    641, 644, 647, 650, 653, 656, 659, 662, 665, 668, 671, 674, 677, 680, 683, 686,
+    689, 692, 695, 698, 701, 704, 707, 710, 713, 716, 719, 722, 0, 0, 725, 728,
+    0, 0, 0, 0, 0, 0, 731, 734, 737, 740, 743, 747, 751, 755, 759, 762,
+    765, 769, 773, 776, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    779, 781, 0, 783, 785, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 788, 0, 0, 0, 0, 0, 0, 0, 0, 0, 790, 0,
+    0, 0, 0, 0, 0, 792, 795, 798, 800, 803, 806, 0, 809, 0, 812, 815,
+    818, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 822, 825, 828, 831, 834, 837,
+    840, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 844, 847, 850, 853, 856, 0,
+    0, 0, 0, 859, 862, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    865, 868, 0, 871, 0, 0, 0, 874, 0, 0, 0, 0, 877, 880, 883, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 886, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 889, 0, 0, 0, 0, 0, 0,
+    892, 895, 0, 898, 0, 0, 0, 901, 0, 0, 0, 0, 904, 907, 910, 0,
+    0, 0, 0, 0, 0, 0, 913, 916, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 919, 922, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    925, 928, 931, 934, 0, 0, 937, 940, 0, 0, 943, 946, 949, 952, 955, 958,
+    0, 0, 961, 964, 967, 970, 973, 976, 0, 0, 979, 982, 985, 988, 991, 994,
+    997, 1000, 1003, 1006, 1009, 1012, 0, 0, 1015, 1018, 0, 0, 0, 0, 0, 0,
+    0, 0, 1021, 1024, 1027, 1030, 1033, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1036, 0, 1039, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1042, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1045, 0, 0, 0, 0, 0, 0,
+    0, 1048, 0, 0, 1051, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1054, 1057, 1060, 1063, 1066, 1069, 1072, 1075,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1078, 1081, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1084, 1087, 0, 1090,
+    0, 0, 0, 1093, 0, 0, 1096, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1099, 1102, 1105, 0, 0, 1108, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1111, 0, 0, 1114, 1117, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1120, 1123, 0, 0,
+    0, 0, 0, 0, 1126, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1129, 1132, 1135, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1138, 0, 0, 0, 0, 0, 0, 0,
+    1141, 0, 0, 0, 0, 0, 0, 1144, 1147, 0, 1150, 1153, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1157, 1160, 1163, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1166, 0, 1169, 1172, 1176, 0,
+    0, 0, 0, 1179, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1182, 0, 0,
+    0, 0, 1185, 0, 0, 0, 0, 1188, 0, 0, 0, 0, 1191, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1194, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1197, 0, 1200, 1203, 0, 1206, 0, 0, 0, 0, 0, 0, 0,
+    0, 1209, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1212, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1215, 0, 0,
+    0, 0, 1218, 0, 0, 0, 0, 1221, 0, 0, 0, 0, 1224, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1227, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1233, 0, 1236, 0, 1239, 0, 1242, 0, 1245, 0,
+    0, 0, 1248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1251, 0, 1254, 0, 0,
+    1257, 1260, 0, 1263, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1266, 1269, 1272, 1275, 1278, 1281, 1284, 1287, 1290, 1294, 1298, 1301, 1304, 1307, 1310, 1313,
+    1316, 1319, 1322, 1325, 1328, 1332, 1336, 1340, 1344, 1347, 1350, 1353, 1356, 1360, 1364, 1367,
+    1370, 1373, 1376, 1379, 1382, 1385, 1388, 1391, 1394, 1397, 1400, 1403, 1406, 1409, 1412, 1416,
+    1420, 1423, 1426, 1429, 1432, 1435, 1438, 1441, 1444, 1448, 1452, 1455, 1458, 1461, 1464, 1467,
+    1470, 1473, 1476, 1479, 1482, 1485, 1488, 1491, 1494, 1497, 1500, 1503, 1506, 1510, 1514, 1518,
+    1522, 1526, 1530, 1534, 1538, 1541, 1544, 1547, 1550, 1553, 1556, 1559, 1562, 1566, 1570, 1573,
+    1576, 1579, 1582, 1585, 1588, 1592, 1596, 1600, 1604, 1608, 1612, 1615, 1618, 1621, 1624, 1627,
+    1630, 1633, 1636, 1639, 1642, 1645, 1648, 1651, 1654, 1658, 1662, 1666, 1670, 1673, 1676, 1679,
+    1682, 1685, 1688, 1691, 1694, 1697, 1700, 1703, 1706, 1709, 1712, 1715, 1718, 1721, 1724, 1727,
+    1730, 1733, 1736, 1739, 1742, 1745, 1748, 1751, 1754, 1757, 0, 1760, 0, 0, 0, 0,
+    1763, 1766, 1769, 1772, 1775, 1779, 1783, 1787, 1791, 1795, 1799, 1803, 1807, 1811, 1815, 1819,
+    1823, 1827, 1831, 1835, 1839, 1843, 1847, 1851, 1855, 1858, 1861, 1864, 1867, 1870, 1873, 1877,
+    1881, 1885, 1889, 1893, 1897, 1901, 1905, 1909, 1913, 1916, 1919, 1922, 1925, 1928, 1931, 1934,
+    1937, 1941, 1945, 1949, 1953, 1957, 1961, 1965, 1969, 1973, 1977, 1981, 1985, 1989, 1993, 1997,
+    2001, 2005, 2009, 2013, 2017, 2020, 2023, 2026, 2029, 2033, 2037, 2041, 2045, 2049, 2053, 2057,
+    2061, 2065, 2069, 2072, 2075, 2078, 2081, 2084, 2087, 2090, 0, 0, 0, 0, 0, 0,
+    2093, 2096, 2099, 2103, 2107, 2111, 2115, 2119, 2123, 2126, 2129, 2133, 2137, 2141, 2145, 2149,
+    2153, 2156, 2159, 2163, 2167, 2171, 0, 0, 2175, 2178, 2181, 2185, 2189, 2193, 0, 0,
+    2197, 2200, 2203, 2207, 2211, 2215, 2219, 2223, 2227, 2230, 2233, 2237, 2241, 2245, 2249, 2253,
+    2257, 2260, 2263, 2267, 2271, 2275, 2279, 2283, 2287, 2290, 2293, 2297, 2301, 2305, 2309, 2313,
+    2317, 2320, 2323, 2327, 2331, 2335, 0, 0, 2339, 2342, 2345, 2349, 2353, 2357, 0, 0,
+    2361, 2364, 2367, 2371, 2375, 2379, 2383, 2387, 0, 2391, 0, 2394, 0, 2398, 0, 2402,
+    2406, 2409, 2412, 2416, 2420, 2424, 2428, 2432, 2436, 2439, 2442, 2446, 2450, 2454, 2458, 2462,
+    2466, 2469, 2472, 2475, 2478, 2481, 2484, 2487, 2490, 2493, 2496, 2499, 2502, 2505, 0, 0,
+    2508, 2512, 2516, 2521, 2526, 2531, 2536, 2541, 2546, 2550, 2554, 2559, 2564, 2569, 2574, 2579,
+    2584, 2588, 2592, 2597, 2602, 2607, 2612, 2617, 2622, 2626, 2630, 2635, 2640, 2645, 2650, 2655,
+    2660, 2664, 2668, 2673, 2678, 2683, 2688, 2693, 2698, 2702, 2706, 2711, 2716, 2721, 2726, 2731,
+    2736, 2739, 2742, 2746, 2749, 0, 2753, 2756, 2760, 2763, 2766, 2769, 2772, 0, 2775, 0,
+    0, 2777, 2780, 2784, 2787, 0, 2791, 2794, 2798, 2801, 2804, 2807, 2810, 2813, 2816, 2819,
+    2822, 2825, 2828, 2832, 0, 0, 2836, 2839, 2843, 2846, 2849, 2852, 0, 2855, 2858, 2861,
+    2864, 2867, 2870, 2874, 2878, 2881, 2884, 2887, 2891, 2894, 2897, 2900, 2903, 2906, 2909, 2912,
+    0, 0, 2914, 2918, 2921, 0, 2925, 2928, 2932, 2935, 2938, 2941, 2944, 2947, 0, 0,
+    2949, 2951, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2953, 0, 0, 0, 2955, 2957, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2960, 2963, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2966, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2969, 2972, 2975,
+    0, 0, 0, 0, 2978, 0, 0, 0, 0, 2981, 0, 0, 2984, 0, 0, 0,
+    0, 0, 0, 0, 2987, 0, 2990, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2993, 0, 0, 2996, 0, 0, 2999, 0, 3002, 0, 0, 0, 0, 0, 0,
+    3005, 0, 3008, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3011, 3014, 3017,
+    3020, 3023, 0, 0, 3026, 3029, 0, 0, 3032, 3035, 0, 0, 0, 0, 0, 0,
+    3038, 3041, 0, 0, 3044, 3047, 0, 0, 3050, 3053, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3056, 3059, 3062, 3065,
+    3068, 3071, 3074, 3077, 0, 0, 0, 0, 0, 0, 3080, 3083, 3086, 3089, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 3092, 3094, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3096, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3099, 0, 3102, 0,
+    3105, 0, 3108, 0, 3111, 0, 3114, 0, 3117, 0, 3120, 0, 3123, 0, 3126, 0,
+    3129, 0, 3132, 0, 0, 3135, 0, 3138, 0, 3141, 0, 0, 0, 0, 0, 0,
+    3144, 3147, 0, 3150, 3153, 0, 3156, 3159, 0, 3162, 3165, 0, 3168, 3171, 0, 0,
+    0, 0, 0, 0, 3174, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3177, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3180, 0, 3183, 0,
+    3186, 0, 3189, 0, 3192, 0, 3195, 0, 3198, 0, 3201, 0, 3204, 0, 3207, 0,
+    3210, 0, 3213, 0, 0, 3216, 0, 3219, 0, 3222, 0, 0, 0, 0, 0, 0,
+    3225, 3228, 0, 3231, 3234, 0, 3237, 3240, 0, 3243, 3246, 0, 3249, 3252, 0, 0,
+    0, 0, 0, 0, 3255, 0, 0, 3258, 3261, 3264, 3267, 0, 0, 0, 3270, 0,
+    3273, 3275, 3277, 3279, 3281, 3283, 3285, 3287, 3289, 3291, 3293, 3295, 3297, 3299, 3301, 3303,
+    3305, 3307, 3309, 3311, 3313, 3315, 3317, 3319, 3321, 3323, 3325, 3327, 3329, 3331, 3333, 3335,
+    3337, 3339, 3341, 3343, 3345, 3347, 3349, 3351, 3353, 3355, 3357, 3359, 3361, 3363, 3365, 3367,
+    3369, 3371, 3373, 3375, 3377, 3379, 3381, 3383, 3385, 3387, 3389, 3391, 3393, 3395, 3397, 3399,
+    3401, 3403, 3405, 3407, 3409, 3411, 3413, 3415, 3417, 3419, 3421, 3423, 3425, 3427, 3429, 3431,
+    3433, 3435, 3437, 3439, 3441, 3443, 3445, 3447, 3449, 3451, 3453, 3455, 3457, 3459, 3461, 3463,
+    3465, 3467, 3469, 3471, 3473, 3475, 3477, 3479, 3481, 3483, 3485, 3487, 3489, 3491, 3493, 3495,
+    3497, 3499, 3501, 3503, 3505, 3507, 3509, 3511, 3513, 3515, 3517, 3519, 3521, 3523, 3525, 3527,
+    3529, 3531, 3533, 3535, 3537, 3539, 3541, 3543, 3545, 3547, 3549, 3551, 3553, 3555, 3557, 3559,
+    3561, 3563, 3565, 3567, 3569, 3571, 3573, 3575, 3577, 3579, 3581, 3583, 3585, 3587, 3589, 3591,
+    3593, 3595, 3597, 3599, 3601, 3603, 3605, 3607, 3609, 3611, 3613, 3615, 3617, 3619, 3621, 3623,
+    3625, 3627, 3629, 3631, 3633, 3635, 3637, 3639, 3641, 3643, 3645, 3647, 3649, 3651, 3653, 3655,
+    3657, 3659, 3661, 3663, 3665, 3667, 3669, 3671, 3673, 3675, 3677, 3679, 3681, 3683, 3685, 3687,
+    3689, 3691, 3693, 3695, 3697, 3699, 3701, 3703, 3705, 3707, 3709, 3711, 3713, 3715, 3717, 3719,
+    3721, 3723, 3725, 3727, 3729, 3731, 3733, 3735, 3737, 3739, 3741, 3743, 3745, 3747, 3749, 3751,
+    3753, 3755, 3757, 3759, 3761, 3763, 3765, 3767, 3769, 3771, 3773, 3775, 3777, 3779, 3781, 3783,
+    3785, 3787, 3789, 3791, 3793, 3795, 3797, 3799, 3801, 3803, 3805, 3807, 3809, 3811, 0, 0,
+    3813, 0, 3815, 0, 0, 3817, 3819, 3821, 3823, 3825, 3827, 3829, 3831, 3833, 3835, 0,
+    3837, 0, 3839, 0, 0, 3841, 3843, 0, 0, 0, 3845, 3847, 3849, 3851, 3853, 3855,
+    3857, 3859, 3861, 3863, 3865, 3867, 3869, 3871, 3873, 3875, 3877, 3879, 3881, 3883, 3885, 3887,
+    3889, 3891, 3893, 3895, 3897, 3899, 3901, 3903, 3905, 3907, 3909, 3911, 3913, 3915, 3917, 3919,
+    3921, 3923, 3925, 3927, 3929, 3931, 3933, 3935, 3937, 3939, 3941, 3943, 3945, 3947, 3949, 3951,
+    3953, 3955, 3957, 3959, 3961, 3963, 3965, 3967, 3969, 3971, 3973, 3975, 3977, 3979, 0, 0,
+    3981, 3983, 3985, 3987, 3989, 3991, 3993, 3995, 3997, 3999, 4001, 4003, 4005, 4007, 4009, 4011,
+    4013, 4015, 4017, 4019, 4021, 4023, 4025, 4027, 4029, 4031, 4033, 4035, 4037, 4039, 4041, 4043,
+    4045, 4047, 4049, 4051, 4053, 4055, 4057, 4059, 4061, 4063, 4065, 4067, 4069, 4071, 4073, 4075,
+    4077, 4079, 4081, 4083, 4085, 4087, 4089, 4091, 4093, 4095, 4097, 4099, 4101, 4103, 4105, 4107,
+    4109, 4111, 4113, 4115, 4117, 4119, 4121, 4123, 4125, 4127, 4129, 4131, 4133, 4135, 4137, 4139,
+    4141, 4143, 4145, 4147, 4149, 4151, 4153, 4155, 4157, 4159, 4161, 4163, 4165, 4167, 4169, 4171,
+    4173, 4175, 4177, 4179, 4181, 4183, 4185, 4187, 4189, 4191, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4193, 0, 4196,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4199, 4202, 4205, 4209, 4213, 4216,
+    4219, 4222, 4225, 4228, 4231, 4234, 4237, 0, 4240, 4243, 4246, 4249, 4252, 0, 4255, 0,
+    4258, 4261, 0, 4264, 4267, 0, 4270, 4273, 4276, 4279, 4282, 4285, 4288, 4291, 4294, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4297, 0, 4300, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4303, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4306, 4309,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4312, 4315, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4318, 4321, 0, 4324, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4327, 4330, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4333, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4336, 4339,
+    4342, 4346, 4350, 4354, 4358, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4362, 4365, 4368, 4372, 4376,
+    4380, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4384, 4386, 4388, 4390, 4392, 4394, 4396, 4398, 4400, 4402, 4404, 4406, 4408, 4410, 4412, 4414,
+    4416, 4418, 4420, 4422, 4424, 4426, 4428, 4430, 4432, 4434, 4436, 4438, 4440, 4442, 4444, 4446,
+    4448, 4450, 4452, 4454, 4456, 4458, 4460, 4462, 4464, 4466, 4468, 4470, 4472, 4474, 4476, 4478,
+    4480, 4482, 4484, 4486, 4488, 4490, 4492, 4494, 4496, 4498, 4500, 4502, 4504, 4506, 4508, 4510,
+    4512, 4514, 4516, 4518, 4520, 4522, 4524, 4526, 4528, 4530, 4532, 4534, 4536, 4538, 4540, 4542,
+    4544, 4546, 4548, 4550, 4552, 4554, 4556, 4558, 4560, 4562, 4564, 4566, 4568, 4570, 4572, 4574,
+    4576, 4578, 4580, 4582, 4584, 4586, 4588, 4590, 4592, 4594, 4596, 4598, 4600, 4602, 4604, 4606,
+    4608, 4610, 4612, 4614, 4616, 4618, 4620, 4622, 4624, 4626, 4628, 4630, 4632, 4634, 4636, 4638,
+    4640, 4642, 4644, 4646, 4648, 4650, 4652, 4654, 4656, 4658, 4660, 4662, 4664, 4666, 4668, 4670,
+    4672, 4674, 4676, 4678, 4680, 4682, 4684, 4686, 4688, 4690, 4692, 4694, 4696, 4698, 4700, 4702,
+    4704, 4706, 4708, 4710, 4712, 4714, 4716, 4718, 4720, 4722, 4724, 4726, 4728, 4730, 4732, 4734,
+    4736, 4738, 4740, 4742, 4744, 4746, 4748, 4750, 4752, 4754, 4756, 4758, 4760, 4762, 4764, 4766,
+    4768, 4770, 4772, 4774, 4776, 4778, 4780, 4782, 4784, 4786, 4788, 4790, 4792, 4794, 4796, 4798,
+    4800, 4802, 4804, 4806, 4808, 4810, 4812, 4814, 4816, 4818, 4820, 4822, 4824, 4826, 4828, 4830,
+    4832, 4834, 4836, 4838, 4840, 4842, 4844, 4846, 4848, 4850, 4852, 4854, 4856, 4858, 4860, 4862,
+    4864, 4866, 4868, 4870, 4872, 4874, 4876, 4878, 4880, 4882, 4884, 4886, 4888, 4890, 4892, 4894,
+    4896, 4898, 4900, 4902, 4904, 4906, 4908, 4910, 4912, 4914, 4916, 4918, 4920, 4922, 4924, 4926,
+    4928, 4930, 4932, 4934, 4936, 4938, 4940, 4942, 4944, 4946, 4948, 4950, 4952, 4954, 4956, 4958,
+    4960, 4962, 4964, 4966, 4968, 4970, 4972, 4974, 4976, 4978, 4980, 4982, 4984, 4986, 4988, 4990,
+    4992, 4994, 4996, 4998, 5000, 5002, 5004, 5006, 5008, 5010, 5012, 5014, 5016, 5018, 5020, 5022,
+    5024, 5026, 5028, 5030, 5032, 5034, 5036, 5038, 5040, 5042, 5044, 5046, 5048, 5050, 5052, 5054,
+    5056, 5058, 5060, 5062, 5064, 5066, 5068, 5070, 5072, 5074, 5076, 5078, 5080, 5082, 5084, 5086,
+    5088, 5090, 5092, 5094, 5096, 5098, 5100, 5102, 5104, 5106, 5108, 5110, 5112, 5114, 5116, 5118,
+    5120, 5122, 5124, 5126, 5128, 5130, 5132, 5134, 5136, 5138, 5140, 5142, 5144, 5146, 5148, 5150,
+    5152, 5154, 5156, 5158, 5160, 5162, 5164, 5166, 5168, 5170, 5172, 5174, 5176, 5178, 5180, 5182,
+    5184, 5186, 5188, 5190, 5192, 5194, 5196, 5198, 5200, 5202, 5204, 5206, 5208, 5210, 5212, 5214,
+    5216, 5218, 5220, 5222, 5224, 5226, 5228, 5230, 5232, 5234, 5236, 5238, 5240, 5242, 5244, 5246,
+    5248, 5250, 5252, 5254, 5256, 5258, 5260, 5262, 5264, 5266, 5268, 5270, 5272, 5274, 5276, 5278,
+    5280, 5282, 5284, 5286, 5288, 5290, 5292, 5294, 5296, 5298, 5300, 5302, 5304, 5306, 5308, 5310,
+    5312, 5314, 5316, 5318, 5320, 5322, 5324, 5326, 5328, 5330, 5332, 5334, 5336, 5338, 5340, 5342,
+    5344, 5346, 5348, 5350, 5352, 5354, 5356, 5358, 5360, 5362, 5364, 5366, 5368, 5370, 5372, 5374,
+    5376, 5378, 5380, 5382, 5384, 5386, 5388, 5390, 5392, 5394, 5396, 5398, 5400, 5402, 5404, 5406,
+    5408, 5410, 5412, 5414, 5416, 5418, 5420, 5422, 5424, 5426, 5428, 5430, 5432, 5434, 5436, 5438,
+    5440, 5442, 5444, 5446, 5448, 5450, 5452, 5454, 5456, 5458, 5460, 5462, 5464, 5466, 0, 0,
+};
+
+const uint8_t unicode_quick_check_stage1[1088] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 5, 9, 5, 10, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 12, 5, 5, 5, 5, 5, 5, 5, 5, 13, 5,
+    5, 5, 5, 5, 14, 15, 16, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 17, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 18, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+const uint8_t unicode_quick_check_stage2[1216] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 3,
+    4, 5, 6, 7, 8, 9, 6, 10, 0, 0, 11, 12, 13, 14, 15, 16,
+    4, 17, 18, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 21, 22, 23, 24, 0, 0, 25, 26, 12, 27, 12, 28, 29, 0, 0,
+    30, 31, 0, 31, 0, 30, 0, 32, 0, 0, 0, 0, 33, 34, 35, 36,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 37, 0, 0, 38, 0, 0, 0, 0, 0, 0, 39, 40, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 31, 41, 0, 42, 0, 0, 0, 0, 0, 43, 44, 45, 0, 0,
+    0, 0, 0, 46, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 43, 48, 49, 0, 0, 0, 50, 0, 43, 51, 52, 0, 0,
+    0, 0, 0, 0, 53, 54, 0, 0, 0, 0, 0, 0, 55, 56, 0, 0,
+    0, 0, 0, 43, 51, 52, 0, 0, 0, 0, 0, 0, 57, 58, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 59, 60, 61, 62, 63, 59, 60, 61, 0, 0, 0, 0,
+    0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 65, 66, 0, 0, 67, 68, 69, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    70, 71, 0, 72, 73, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 74, 4, 4, 4, 4, 4, 75,
+    4, 76, 4, 4, 76, 77, 4, 78, 4, 4, 4, 79, 80, 81, 82, 83,
+    84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 85, 0, 0, 0, 0, 0, 0, 86, 87, 0, 13, 0, 0, 0,
+    88, 0, 89, 0, 90, 0, 91, 92, 92, 0, 93, 0, 0, 0, 94, 0,
+    0, 0, 95, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 96, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 97, 98, 99, 100, 0, 101, 97, 98, 99, 100, 0, 102,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 19, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    104, 105, 106, 103, 103, 103, 104, 103, 103, 103, 103, 103, 103, 107, 0, 0,
+    0, 108, 109, 110, 111, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 112, 113, 114, 0, 0, 0, 0,
+    0, 0, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 43, 44, 52, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 86, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 118, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 119, 120, 0, 0, 0, 0, 121, 122, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103, 103,
+    103, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint8_t unicode_quick_check_stage3[1968] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 0, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4, 4,
+    4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4,
+    4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+    0, 2, 0, 2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2, 2, 0,
+    2, 2, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0,
+    5, 5, 2, 5, 5, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0,
+    0, 0, 0, 0, 0, 4, 4, 5, 4, 4, 4, 0, 4, 0, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4,
+    0, 0, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 5, 5, 0, 5,
+    0, 0, 0, 5, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 0, 0, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 5, 5, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 2, 0, 0, 0, 0, 4, 4, 0, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4, 4, 2,
+    0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0,
+    0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 5, 0, 5, 5, 0, 5, 0, 0, 0, 0, 0, 0, 0,
+    0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0,
+    4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 0, 4, 0, 4, 0, 4,
+    4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 0, 0,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 5, 4, 0, 5, 0,
+    0, 4, 4, 4, 4, 0, 4, 4, 4, 5, 4, 5, 4, 4, 4, 4,
+    4, 4, 4, 5, 0, 0, 4, 4, 4, 4, 4, 5, 0, 4, 4, 4,
+    4, 4, 4, 5, 4, 4, 4, 4, 4, 4, 4, 5, 4, 4, 5, 5,
+    0, 0, 4, 4, 4, 0, 4, 4, 4, 5, 4, 5, 4, 5, 0, 0,
+    5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 5, 5, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 4, 0, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0,
+    4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0, 4, 0,
+    4, 0, 4, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 0, 4, 4, 0, 4, 4, 0, 4, 4, 0, 4, 4, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 2, 2, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 0, 0, 0, 4, 0,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0,
+    5, 0, 5, 0, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    5, 0, 5, 0, 0, 5, 5, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 5,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 0, 5, 5, 5, 5, 5, 0, 5, 0,
+    5, 5, 0, 5, 5, 0, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 4, 4,
+    2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 2, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+    2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5,
+    5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 5, 5, 5, 5,
+    5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint8_t unicode_grapheme_break_stage1[2176] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 10,
+    15, 16, 17, 18, 19, 20, 21, 10, 22, 23, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 27, 28, 29,
+    30, 31, 32, 33, 27, 28, 29, 30, 31, 32, 33, 34, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 35, 10, 36,
+    37, 38, 10, 10, 10, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 50, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 51, 10, 52, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 53, 10,
+    10, 10, 10, 10, 10, 10, 10, 54, 55, 56, 10, 10, 10, 57, 10, 10,
+    58, 59, 10, 10, 60, 10, 10, 10, 61, 62, 63, 64, 65, 66, 67, 68,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    69, 70, 70, 70, 70, 70, 70, 70, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+};
+
+const uint16_t unicode_grapheme_break_stage2[2272] =
+{
+    0, 1, 2, 2, 2, 2, 2, 3, 1, 1, 4, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 5, 5, 5, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 6, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 7, 5, 8, 9, 2, 2, 2,
+    10, 11, 2, 2, 12, 5, 2, 13, 2, 2, 2, 2, 2, 14, 15, 2,
+    16, 17, 2, 5, 18, 2, 2, 2, 2, 2, 19, 13, 2, 2, 12, 20,
+    2, 21, 22, 2, 2, 23, 2, 2, 2, 24, 2, 2, 25, 5, 26, 5,
+    27, 2, 2, 28, 29, 30, 31, 2, 32, 2, 2, 33, 34, 35, 31, 36,
+    37, 2, 2, 38, 39, 17, 2, 40, 37, 2, 2, 38, 41, 2, 31, 25,
+    32, 2, 2, 42, 34, 43, 31, 2, 44, 2, 2, 45, 46, 35, 2, 2,
+    47, 2, 2, 42, 48, 49, 31, 2, 32, 2, 2, 50, 51, 49, 31, 2,
+    52, 2, 2, 53, 54, 35, 31, 2, 32, 2, 2, 2, 55, 56, 2, 57,
+    2, 2, 2, 58, 59, 2, 2, 2, 2, 2, 2, 60, 61, 2, 2, 2,
+    2, 62, 2, 63, 2, 2, 2, 64, 65, 66, 5, 67, 68, 2, 2, 2,
+    2, 2, 69, 70, 2, 71, 13, 72, 73, 74, 2, 2, 2, 2, 2, 2,
+    75, 75, 75, 75, 75, 75, 76, 76, 76, 76, 77, 78, 78, 78, 78, 78,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 69, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 79, 2, 80, 2, 31, 2, 31, 2, 2, 2, 81, 82, 20, 2, 2,
+    83, 2, 2, 2, 2, 2, 2, 2, 49, 2, 84, 2, 2, 2, 2, 2,
+    2, 2, 85, 86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 87, 2, 2, 2, 88, 89, 90, 2, 2, 2, 5, 91, 2, 2, 2,
+    92, 2, 2, 93, 94, 2, 12, 95, 96, 2, 97, 2, 2, 2, 98, 52,
+    2, 2, 99, 100, 2, 2, 2, 2, 2, 2, 2, 2, 2, 101, 102, 103,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 5, 5, 5, 5,
+    104, 2, 105, 106, 107, 2, 1, 2, 2, 2, 2, 2, 2, 5, 5, 13,
+    2, 2, 108, 107, 2, 2, 2, 2, 2, 109, 110, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 111, 112, 2, 2, 2, 2, 2, 112, 2, 2, 2, 113, 2, 114, 115,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 108, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 111, 116, 117, 2, 2, 118,
+    119, 120, 121, 121, 121, 121, 121, 121, 122, 121, 121, 121, 121, 121, 121, 121,
+    123, 124, 125, 126, 127, 128, 129, 2, 2, 130, 131, 132, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 133, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    130, 134, 2, 2, 2, 135, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 136, 137,
+    2, 2, 2, 2, 2, 2, 2, 136, 2, 2, 2, 2, 2, 2, 5, 5,
+    2, 2, 25, 138, 2, 2, 2, 2, 2, 139, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 140, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 136, 141, 2, 142, 2, 2, 2, 2, 2, 137,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    143, 2, 144, 2, 2, 2, 2, 2, 145, 2, 2, 146, 147, 2, 5, 148,
+    2, 2, 149, 2, 150, 52, 75, 151, 27, 2, 2, 152, 153, 2, 154, 2,
+    2, 2, 155, 156, 157, 2, 2, 158, 2, 2, 2, 159, 17, 2, 160, 161,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 162, 2,
+    163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164,
+    165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166,
+    165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167,
+    165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163,
+    164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165,
+    166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165,
+    167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165,
+    163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164,
+    165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166,
+    165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167,
+    165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163,
+    164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165,
+    166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165,
+    167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165,
+    163, 164, 165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 167, 165, 163, 164,
+    165, 166, 165, 167, 165, 163, 164, 165, 166, 165, 168, 76, 169, 78, 78, 170,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 36, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 2, 5, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 142, 2, 2, 2, 2, 2, 171,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 74,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 13, 2,
+    2, 2, 2, 2, 2, 2, 2, 172, 2, 2, 2, 2, 2, 2, 2, 2,
+    173, 2, 2, 174, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 49, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 175, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 176, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 19, 13, 2, 2, 177, 2, 2, 2, 2, 2, 2, 2,
+    178, 2, 2, 179, 180, 2, 2, 181, 96, 2, 2, 182, 183, 2, 2, 2,
+    184, 2, 185, 186, 187, 2, 2, 188, 96, 2, 2, 189, 190, 2, 2, 2,
+    2, 2, 191, 192, 2, 2, 2, 2, 2, 2, 2, 2, 2, 136, 193, 2,
+    52, 2, 2, 53, 194, 35, 195, 186, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 196, 197, 36, 2, 2, 2, 2, 2, 198, 199, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 136, 200, 13, 201, 2, 2,
+    2, 2, 2, 202, 13, 2, 2, 2, 2, 2, 203, 204, 2, 2, 2, 2,
+    2, 69, 205, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 191, 206, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 207, 208, 2, 2, 2, 2, 2, 2, 2, 2, 209, 210, 2,
+    211, 2, 2, 212, 35, 213, 2, 2, 214, 215, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 216, 217, 2, 2, 2, 2, 2, 218, 219, 220, 2, 2, 2, 2,
+    2, 2, 2, 221, 222, 2, 2, 2, 223, 224, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 225,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 226, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 186,
+    2, 2, 2, 180, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 136, 227, 228, 228, 229, 184, 2, 2, 2, 2, 230, 145,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 231, 232, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 233, 5, 180, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 234, 235, 236, 2, 237, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 238, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    5, 5, 5, 239, 5, 5, 67, 154, 230, 12, 7, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    240, 241, 242, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 180, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 36, 2, 2, 2, 243, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 180, 2, 2,
+    2, 2, 2, 2, 244, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    245, 2, 113, 2, 2, 2, 246, 247, 248, 249, 245, 121, 121, 121, 250, 251,
+    252, 253, 113, 254, 114, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 255,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 256, 257, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 2, 2, 2, 121, 121, 121, 121, 121, 121, 121, 121,
+    2, 2, 2, 2, 2, 2, 2, 258, 2, 2, 2, 2, 2, 259, 121, 121,
+    246, 2, 2, 2, 260, 261, 2, 2, 260, 2, 262, 121, 121, 121, 121, 121,
+    246, 121, 121, 263, 119, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
+    121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 256,
+    1, 1, 5, 5, 5, 5, 5, 5, 1, 1, 1, 1, 1, 1, 1, 1,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+};
+
+const uint8_t unicode_grapheme_break_stage3[4224] =
+{
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 3, 128, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 3, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+    7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 0, 8, 8,
+    8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8,
+    0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 8,
+    8, 4, 4, 4, 4, 0, 0, 8, 8, 0, 0, 8, 8, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 8,
+    8, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+    4, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 4, 4, 4, 4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 4,
+    0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8,
+    4, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 4, 0, 0,
+    4, 8, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 8, 8, 8, 8, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 4,
+    8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8, 4, 4, 0, 0,
+    4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4, 8,
+    8, 4, 4, 4, 4, 0, 8, 8, 8, 0, 8, 8, 8, 4, 7, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+    8, 8, 4, 4, 4, 0, 4, 0, 8, 8, 8, 8, 8, 8, 8, 4,
+    0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 8, 8,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+    4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 8, 4, 4, 4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0, 0, 0, 4, 4,
+    0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    0, 0, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 8, 8,
+    8, 8, 8, 8, 8, 8, 4, 8, 8, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 3, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 8, 8, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0,
+    8, 8, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 4, 8, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 8,
+    8, 8, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 8, 4, 4, 8, 8, 8, 4, 8, 4,
+    0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4,
+    4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0,
+    0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 0, 0, 0, 0, 128, 128, 128, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 0,
+    128, 128, 128, 128, 128, 128, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 128, 128, 128, 128, 128, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 0, 128, 0, 128, 0, 0, 0, 0, 0, 0, 128, 0, 0,
+    0, 128, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 0, 0, 128, 0, 0, 0, 0, 128, 0, 128, 0,
+    0, 0, 0, 128, 128, 128, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+    0, 0, 0, 0, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 0,
+    128, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 128, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+    0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 4, 4, 8, 0, 0, 0, 0, 4, 0, 0, 0,
+    8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0,
+    0, 0, 0, 4, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 8,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 8,
+    8, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 8, 8,
+    0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 4, 8, 8, 4, 8, 8, 0, 8, 4, 0, 0,
+    12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    8, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 7, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+    4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 8, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+    8, 0, 7, 7, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 8, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4,
+    4, 4, 8, 8, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    4, 8, 8, 8, 8, 0, 0, 8, 8, 0, 0, 8, 8, 8, 0, 0,
+    0, 0, 8, 8, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4,
+    8, 8, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 8, 8, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 4, 8, 4,
+    4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 4, 4, 4, 4, 0, 0, 8, 8, 8, 8, 4, 4, 8, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 8, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 8, 8,
+    4, 4, 4, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0,
+    4, 8, 8, 8, 8, 8, 0, 8, 8, 0, 0, 4, 4, 8, 4, 7,
+    8, 7, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 4, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 8,
+    4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 4, 4, 4, 4, 8, 7, 4, 4, 4, 4, 0,
+    0, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 8, 4,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 8, 4, 4, 4, 4, 4, 4,
+    4, 8, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4,
+    4, 4, 4, 4, 4, 4, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0,
+    4, 4, 0, 8, 8, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0,
+    3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 8, 4, 4, 4, 0, 0, 0, 8, 4, 4,
+    4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128,
+    128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0,
+    0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0,
+    128, 128, 128, 128, 128, 128, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 4, 4, 4, 4, 4,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0,
+    0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 128, 128, 128, 128,
+};
+
+const uint8_t unicode_word_break_stage1[2176] =
+{
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+    16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    27, 27, 28, 29, 30, 31, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27,
+    27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 27, 32, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    27, 52, 53, 26, 26, 26, 26, 54, 27, 27, 55, 26, 26, 26, 26, 26,
+    26, 26, 27, 56, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 27, 57, 26, 58, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 59, 60, 26, 26, 26, 26, 26, 61, 26,
+    26, 26, 26, 26, 26, 26, 26, 62, 63, 64, 65, 66, 26, 67, 26, 68,
+    69, 70, 26, 71, 72, 26, 26, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    82, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+};
+
+const uint16_t unicode_word_break_stage2[2656] =
+{
+    0, 1, 2, 3, 4, 5, 4, 6, 7, 1, 8, 9, 10, 11, 10, 11,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 12, 10, 10,
+    13, 13, 13, 13, 13, 13, 13, 14, 15, 10, 16, 10, 10, 10, 10, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 18, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 4, 10, 19, 10, 10, 20, 21, 13, 22, 23, 24, 25, 26,
+    27, 28, 10, 10, 29, 13, 30, 31, 10, 10, 10, 10, 10, 32, 33, 34,
+    35, 36, 10, 13, 37, 10, 10, 10, 10, 10, 38, 39, 40, 10, 29, 41,
+    10, 42, 43, 1, 10, 44, 6, 10, 45, 46, 10, 10, 47, 13, 48, 13,
+    49, 10, 10, 50, 13, 51, 52, 4, 53, 54, 55, 56, 57, 58, 52, 59,
+    60, 54, 55, 61, 62, 63, 64, 65, 66, 16, 55, 67, 68, 69, 52, 70,
+    71, 54, 55, 67, 72, 73, 52, 74, 75, 76, 77, 78, 79, 80, 64, 1,
+    81, 82, 55, 83, 84, 85, 52, 1, 86, 82, 55, 87, 84, 88, 52, 89,
+    90, 82, 10, 91, 92, 93, 52, 94, 95, 96, 10, 97, 98, 99, 64, 100,
+    1, 1, 1, 101, 102, 103, 1, 1, 1, 1, 1, 104, 105, 103, 1, 1,
+    69, 106, 103, 107, 108, 10, 109, 21, 110, 111, 13, 112, 113, 1, 1, 1,
+    1, 1, 114, 115, 103, 116, 117, 118, 119, 120, 10, 10, 121, 10, 10, 122,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 123, 124, 10, 10, 123, 10, 10, 125, 126, 11, 10, 10,
+    10, 126, 10, 10, 10, 127, 1, 1, 10, 1, 10, 10, 10, 10, 10, 128,
+    4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 129, 10, 130, 6, 10, 10, 10, 10, 131, 132,
+    10, 133, 10, 134, 10, 135, 136, 137, 1, 1, 1, 138, 13, 139, 103, 1,
+    140, 103, 10, 10, 10, 10, 10, 132, 141, 10, 142, 10, 10, 10, 10, 143,
+    10, 144, 145, 145, 64, 1, 1, 1, 1, 1, 1, 1, 1, 103, 1, 1,
+    10, 146, 1, 1, 1, 147, 13, 148, 103, 103, 1, 13, 115, 1, 1, 1,
+    149, 10, 10, 150, 151, 103, 114, 152, 153, 10, 154, 40, 10, 10, 38, 152,
+    10, 10, 150, 155, 156, 40, 10, 157, 132, 10, 10, 158, 1, 159, 160, 161,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 13, 13, 13, 13,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 128, 10, 10, 128, 162, 10, 157, 10, 10, 10, 163, 164, 165, 109, 164,
+    166, 167, 168, 169, 170, 171, 172, 173, 1, 109, 1, 1, 1, 13, 13, 174,
+    175, 176, 177, 178, 179, 1, 10, 10, 132, 180, 181, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 182, 183, 1, 1, 1, 1, 1, 183, 1, 1, 1, 184, 1, 185, 186,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 187, 188, 10, 189, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 182, 190, 191, 1, 1, 192,
+    193, 194, 195, 195, 195, 195, 195, 195, 196, 195, 195, 195, 195, 195, 195, 195,
+    197, 198, 199, 200, 201, 202, 203, 1, 1, 204, 205, 206, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 207, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    204, 208, 1, 1, 1, 209, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 210, 211,
+    10, 10, 121, 10, 10, 10, 212, 213, 10, 214, 215, 215, 215, 215, 13, 13,
+    1, 1, 216, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    217, 1, 218, 219, 1, 1, 1, 1, 1, 220, 221, 221, 221, 221, 221, 222,
+    223, 10, 10, 4, 10, 10, 10, 10, 144, 1, 10, 10, 1, 1, 1, 221,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 224, 1, 1, 1, 221, 221, 225,
+    221, 221, 221, 221, 221, 226, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 109, 1, 1, 1, 1, 10, 10, 157,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    109, 10, 227, 1, 10, 10, 228, 229, 10, 230, 10, 10, 10, 10, 10, 231,
+    232, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 6, 233, 1, 234,
+    235, 10, 236, 1, 10, 10, 10, 237, 238, 10, 10, 150, 239, 103, 13, 240,
+    40, 10, 241, 10, 242, 152, 10, 109, 49, 10, 10, 243, 244, 103, 245, 103,
+    10, 10, 246, 247, 248, 103, 1, 249, 1, 1, 1, 250, 251, 1, 29, 252,
+    253, 254, 215, 10, 10, 10, 189, 10, 10, 10, 10, 10, 10, 10, 255, 103,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 237, 10, 256, 10, 10, 257,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    214, 258, 259, 260, 261, 10, 10, 10, 10, 10, 10, 262, 1, 263, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 157, 1, 10, 10, 10, 10, 234, 10, 10, 264, 1, 1, 257,
+    13, 265, 13, 266, 267, 268, 1, 269, 10, 10, 10, 10, 10, 10, 10, 270,
+    271, 3, 4, 5, 4, 6, 272, 221, 221, 273, 10, 144, 274, 275, 1, 276,
+    277, 10, 11, 278, 157, 157, 1, 1, 10, 10, 10, 10, 10, 10, 10, 6,
+    1, 1, 1, 1, 10, 10, 10, 279, 1, 1, 1, 1, 1, 1, 1, 280,
+    1, 1, 1, 1, 1, 1, 1, 1, 10, 109, 10, 10, 10, 69, 174, 1,
+    10, 10, 281, 10, 6, 10, 10, 282, 10, 157, 10, 10, 283, 284, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 157, 103, 10, 10, 283, 10, 257,
+    10, 10, 264, 10, 10, 10, 237, 122, 122, 285, 16, 286, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 214, 10, 143, 264, 1, 17, 10, 10, 287, 1, 1, 1, 1,
+    288, 10, 10, 289, 10, 143, 10, 214, 10, 144, 1, 1, 1, 1, 10, 290,
+    10, 143, 10, 189, 1, 1, 1, 1, 10, 10, 10, 12, 1, 1, 1, 1,
+    291, 292, 10, 293, 1, 1, 10, 109, 10, 109, 1, 1, 108, 10, 294, 1,
+    10, 10, 10, 143, 10, 143, 10, 295, 10, 262, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 132, 1, 1, 1, 10, 10, 10, 295, 10, 10, 10, 295,
+    10, 10, 296, 103, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 297, 262, 1, 1, 1, 1,
+    10, 109, 298, 10, 38, 174, 1, 10, 299, 1, 1, 10, 279, 1, 10, 214,
+    153, 10, 10, 300, 247, 1, 64, 301, 153, 10, 10, 302, 303, 10, 132, 103,
+    153, 10, 242, 304, 305, 10, 10, 306, 153, 10, 10, 243, 307, 308, 1, 1,
+    10, 16, 309, 310, 1, 1, 1, 1, 311, 312, 132, 10, 10, 228, 313, 103,
+    314, 54, 55, 315, 72, 316, 317, 318, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 319, 320, 321, 262, 1, 10, 10, 10, 13, 322, 103, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 228, 323, 174, 324, 1, 1,
+    10, 10, 10, 13, 325, 103, 1, 1, 10, 10, 29, 326, 103, 1, 1, 1,
+    1, 327, 145, 103, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 309, 313, 1, 1, 1, 1, 1, 1, 10, 10, 10, 10, 103, 216,
+    328, 329, 10, 330, 331, 103, 1, 1, 1, 1, 332, 10, 10, 333, 334, 1,
+    335, 10, 10, 336, 337, 338, 10, 10, 47, 339, 1, 10, 10, 10, 10, 132,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    55, 10, 228, 340, 69, 103, 1, 234, 10, 341, 111, 247, 1, 1, 1, 1,
+    342, 10, 10, 343, 344, 103, 345, 10, 346, 347, 103, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 348,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 69, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 189, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 144, 1, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 237, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 10, 10, 10, 10, 10, 69,
+    10, 10, 144, 349, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 214, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 132, 10, 144, 103, 10, 10, 10, 10, 144, 103, 10, 157, 318,
+    10, 10, 10, 247, 237, 103, 263, 350, 10, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 10, 10, 10, 10, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 351, 352, 13, 13, 353, 153, 1, 1, 1, 1, 354, 231,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 355,
+    356, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 357, 1, 1, 1, 358, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 10, 6, 109, 132, 359, 360, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    13, 13, 361, 13, 247, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 362, 363, 364, 1, 365, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 366, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 10, 10, 10, 269, 10, 10, 10, 136, 367, 368, 369, 10, 10, 10,
+    370, 371, 10, 372, 373, 82, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 374, 10, 82, 122, 10, 122,
+    10, 269, 10, 269, 144, 10, 144, 10, 55, 10, 55, 10, 375, 376, 376, 376,
+    13, 13, 13, 377, 13, 13, 112, 245, 378, 114, 21, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 144, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    340, 379, 380, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    10, 10, 109, 381, 382, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 10, 383, 1, 10, 10, 309, 103,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 384, 144,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 279, 247, 1, 1,
+    10, 10, 10, 10, 385, 103, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    369, 10, 386, 387, 388, 389, 390, 391, 392, 257, 393, 257, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    394, 1, 184, 10, 189, 10, 395, 396, 397, 398, 394, 195, 195, 195, 399, 400,
+    401, 402, 184, 403, 185, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 404,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 405, 406, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 1, 1, 1, 195, 195, 195, 195, 195, 195, 195, 195,
+    1, 1, 1, 1, 1, 1, 1, 407, 1, 1, 1, 1, 1, 408, 195, 195,
+    409, 1, 1, 1, 410, 411, 1, 1, 410, 1, 412, 195, 195, 195, 195, 195,
+    409, 195, 195, 413, 193, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 103,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195,
+    195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 195, 405,
+    414, 1, 13, 13, 13, 13, 13, 13, 1, 1, 1, 1, 1, 1, 1, 1,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 1,
+};
+
+const uint8_t unicode_word_break_stage3[6640] =
+{
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 3, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    18, 0, 12, 0, 0, 0, 0, 11, 0, 0, 0, 0, 15, 0, 13, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 14, 15, 0, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 10, 0, 0, 7, 128, 0,
+    0, 0, 0, 0, 0, 10, 0, 14, 0, 0, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 10, 10, 10, 10, 15, 10,
+    0, 0, 0, 0, 0, 0, 10, 14, 10, 10, 10, 0, 10, 0, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 14,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 15, 10, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 9,
+    9, 9, 9, 10, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 7, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 15, 0, 10, 10,
+    4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 4, 4, 4, 4, 4, 4, 4, 7, 0, 4,
+    4, 4, 4, 4, 4, 10, 10, 4, 4, 0, 4, 4, 4, 4, 10, 10,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7,
+    10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 10, 10, 0, 0, 15, 0, 10, 0, 0, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 10, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 10, 4, 4, 4, 10, 4, 4, 4, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 0,
+    7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4,
+    4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 10, 4, 4,
+    10, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 4, 4, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    10, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10,
+    10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 10, 10, 0, 10,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 4, 0,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10,
+    10, 0, 10, 10, 0, 10, 10, 0, 10, 10, 0, 0, 4, 0, 4, 4,
+    4, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 0, 10, 0,
+    0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    4, 4, 10, 10, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10,
+    10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 0, 0,
+    10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 4, 4, 4, 4, 4, 4,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 10, 10, 0, 10,
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 10, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10,
+    10, 0, 10, 10, 10, 10, 0, 0, 0, 10, 10, 0, 10, 0, 10, 10,
+    0, 0, 0, 10, 10, 0, 0, 0, 10, 10, 10, 0, 0, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 4, 4,
+    4, 4, 4, 0, 0, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    10, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 0, 10, 10, 10, 0, 0, 10, 0, 0,
+    10, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 0, 4, 10, 4, 4,
+    0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 10, 10, 0,
+    0, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 10, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 10, 0,
+    0, 0, 0, 0, 10, 10, 10, 4, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    0, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 4, 0, 0, 0, 0, 4,
+    4, 4, 4, 4, 4, 0, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    4, 4, 4, 4, 4, 0, 4, 4, 10, 10, 10, 10, 10, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4,
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4, 4, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 0, 0, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 0,
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 0,
+    10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    18, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    10, 10, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 7, 4,
+    10, 10, 10, 10, 10, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4,
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 4, 10, 10,
+    10, 10, 10, 10, 4, 10, 10, 4, 4, 4, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 0, 10, 0, 10,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0,
+    0, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0,
+    10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0,
+    18, 18, 18, 18, 18, 18, 18, 0, 18, 18, 18, 0, 4, 5, 7, 7,
+    0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 13, 0, 0, 14, 3, 3, 7, 7, 7, 7, 7, 17,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 17,
+    17, 0, 0, 0, 15, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18,
+    7, 7, 7, 7, 7, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 0, 0, 0, 0, 10, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0,
+    0, 0, 128, 0, 10, 0, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 138, 0, 0, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 0,
+    0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 0, 0, 0, 0, 128, 128, 128, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 138, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 0,
+    128, 128, 128, 128, 128, 128, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 128, 128, 128, 128, 128, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128,
+    128, 128, 128, 0, 128, 0, 128, 0, 0, 0, 0, 0, 0, 128, 0, 0,
+    0, 128, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 128, 0, 0, 128, 0, 0, 0, 0, 128, 0, 128, 0,
+    0, 0, 0, 128, 128, 128, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 128, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128,
+    0, 0, 0, 0, 128, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 0, 0, 0,
+    128, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 4,
+    4, 4, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    18, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+    128, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 10, 10, 128, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 8, 8,
+    0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 128, 0, 128, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0,
+    8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 10, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 10, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 4, 10, 10, 10, 4, 10, 10, 10, 10, 4, 10, 10, 10, 10,
+    10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0,
+    10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 10, 10, 10, 10, 10, 10, 0, 0, 0, 10, 0, 10, 10, 4,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10,
+    0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0,
+    4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 0,
+    0, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 9, 4, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 0, 9, 9, 9, 9, 9, 0, 9, 0,
+    9, 9, 0, 9, 9, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    15, 0, 0, 14, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 17, 17,
+    15, 0, 13, 0, 15, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 7,
+    0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 15, 0, 13, 0,
+    0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4,
+    0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10,
+    0, 0, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10,
+    10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    0, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 0,
+    10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 0, 0, 10, 0, 0, 10,
+    10, 10, 10, 0, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    10, 10, 10, 10, 0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4,
+    10, 10, 10, 10, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 10, 10, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 7, 0, 0,
+    0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0,
+    4, 4, 4, 4, 4, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    0, 0, 0, 0, 10, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 10, 10, 10, 10, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 10, 0, 10, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10, 10, 0, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10,
+    10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 0, 4, 4, 10, 4, 4,
+    10, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 10, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 4, 10,
+    4, 4, 4, 4, 10, 10, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 10, 10, 10, 10, 4, 4, 0, 0,
+    4, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 0, 0, 10, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 4, 4, 4, 4, 10,
+    4, 10, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 10, 0, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10,
+    10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 10, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 10, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10,
+    10, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4,
+    4, 4, 4, 4, 4, 4, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 4, 4, 4, 4, 0,
+    4, 4, 0, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 4,
+    10, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4,
+    10, 10, 0, 10, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 8, 0, 8, 8, 8, 8, 8, 8, 8, 0, 8, 8, 0,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 4, 4, 0,
+    7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0,
+    0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10, 0, 0, 10, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 0, 10, 10, 10,
+    10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 0, 10, 10, 10,
+    10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0,
+    10, 10, 10, 10, 10, 0, 10, 0, 0, 0, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 0, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 10, 10, 10, 10, 10, 10, 10, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 10, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 4, 0,
+    10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 10, 0,
+    10, 10, 10, 10, 4, 4, 4, 4, 4, 4, 4, 10, 0, 0, 0, 0,
+    0, 10, 10, 0, 10, 0, 0, 10, 0, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 0, 10, 0, 0, 0, 0,
+    0, 0, 10, 0, 0, 0, 0, 10, 0, 10, 0, 10, 0, 10, 10, 10,
+    0, 10, 10, 0, 10, 0, 0, 10, 0, 10, 0, 10, 0, 10, 0, 10,
+    0, 10, 10, 0, 10, 0, 0, 10, 10, 10, 10, 0, 10, 10, 10, 10,
+    10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 10, 10, 10, 0, 10, 0,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10,
+    0, 10, 10, 10, 0, 10, 10, 10, 10, 10, 0, 10, 10, 10, 10, 10,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 128, 128, 128, 128,
+    138, 138, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 138, 138,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 0, 0, 0, 0, 128, 0,
+    0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0, 0, 0, 0,
+    128, 128, 128, 128, 128, 128, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 0, 0,
+    0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 128, 128, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 4, 4, 4, 4, 4,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 0,
+    0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 128, 128, 128, 128,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128,
+    128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 0, 128, 128, 128, 128,
+    0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const int32_t unicode_case_fold_deltas[201] =
+{
+    0, 32, 775, 0, 1, 0, 0, -121, -268, 210, 206, 205, 79, 202, 203, 207,
+    211, 209, 213, 214, 218, 217, 219, 2, 0, -97, -56, -130, 10795, -163, 10792, -195,
+    69, 71, 116, 38, 37, 64, 63, 0, 0, 8, -30, -25, -15, -22, -54, -48,
+    -60, -64, -7, 80, 15, 48, 0, 7264, -8, -6222, -6221, -6212, -6210, -6211, -6204, -6180,
+    35267, -3008, 0, 0, 0, 0, 0, -58, -7615, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8, 0, 0, 0,
+    0, 0, 0, 0, 0, -8, -8, -8, -8, -8, -8, -8, -8, 0, 0, 0,
+    0, 0, -74, -9, -7173, 0, 0, 0, 0, 0, -86, -9, 0, 0, 0, 0,
+    -100, 0, 0, 0, 0, 0, -112, 0, 0, 0, 0, 0, -128, -126, -9, -7517,
+    -8383, -8262, 28, 16, 26, -10743, -3814, -10727, -10780, -10749, -10783, -10782, -10815, -35332, -42280, -42308,
+    -42319, -42315, -42305, -42258, -42282, -42261, 928, -42307, -35384, -38864, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 40, 39, 34,
+};
+
+const uint8_t unicode_case_fold_sequence_indices[201] =
+{
+    0, 0, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 8, 9, 10, 11, 12, 0, 13, 14, 15, 16, 17, 18, 19, 20,
+    21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52,
+    53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68,
+    69, 70, 0, 71, 0, 72, 73, 74, 75, 76, 0, 77, 78, 79, 80, 81,
+    0, 82, 83, 84, 85, 86, 0, 87, 88, 89, 90, 91, 0, 0, 92, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 93, 94, 95, 96, 97, 98,
+    99, 100, 101, 102, 103, 104, 0, 0, 0,
+};
+
+const uint32_t unicode_case_fold_sequences[315] =
+{
+    0, 0, 0, 115, 115, 0, 105, 775, 0, 700, 110, 0, 106, 780, 0, 953,
+    776, 769, 965, 776, 769, 1381, 1410, 0, 104, 817, 0, 116, 776, 0, 119, 778,
+    0, 121, 778, 0, 97, 702, 0, 115, 115, 0, 965, 787, 0, 965, 787, 768,
+    965, 787, 769, 965, 787, 834, 7936, 953, 0, 7937, 953, 0, 7938, 953, 0, 7939,
+    953, 0, 7940, 953, 0, 7941, 953, 0, 7942, 953, 0, 7943, 953, 0, 7936, 953,
+    0, 7937, 953, 0, 7938, 953, 0, 7939, 953, 0, 7940, 953, 0, 7941, 953, 0,
+    7942, 953, 0, 7943, 953, 0, 7968, 953, 0, 7969, 953, 0, 7970, 953, 0, 7971,
+    953, 0, 7972, 953, 0, 7973, 953, 0, 7974, 953, 0, 7975, 953, 0, 7968, 953,
+    0, 7969, 953, 0, 7970, 953, 0, 7971, 953, 0, 7972, 953, 0, 7973, 953, 0,
+    7974, 953, 0, 7975, 953, 0, 8032, 953, 0, 8033, 953, 0, 8034, 953, 0, 8035,
+    953, 0, 8036, 953, 0, 8037, 953, 0, 8038, 953, 0, 8039, 953, 0, 8032, 953,
+    0, 8033, 953, 0, 8034, 953, 0, 8035, 953, 0, 8036, 953, 0, 8037, 953, 0,
+    8038, 953, 0, 8039, 953, 0, 8048, 953, 0, 945, 953, 0, 940, 953, 0, 945,
+    834, 0, 945, 834, 953, 945, 953, 0, 8052, 953, 0, 951, 953, 0, 942, 953,
+    0, 951, 834, 0, 951, 834, 953, 951, 953, 0, 953, 776, 768, 953, 776, 769,
+    953, 834, 0, 953, 776, 834, 965, 776, 768, 965, 776, 769, 961, 787, 0, 965,
+    834, 0, 965, 776, 834, 8060, 953, 0, 969, 953, 0, 974, 953, 0, 969, 834,
+    0, 969, 834, 953, 969, 953, 0, 102, 102, 0, 102, 105, 0, 102, 108, 0,
+    102, 102, 105, 102, 102, 108, 115, 116, 0, 115, 116, 0, 1396, 1398, 0, 1396,
+    1381, 0, 1396, 1387, 0, 1406, 1398, 0, 1396, 1389, 0,
+};
+
+const uint32_t unicode_decomposition_sequences[5468] =
+{
+    0, 2, 65, 768, 2, 65, 769, 2, 65, 770, 2, 65, 771, 2, 65, 776,
+    2, 65, 778, 2, 67, 807, 2, 69, 768, 2, 69, 769, 2, 69, 770, 2,
+    69, 776, 2, 73, 768, 2, 73, 769, 2, 73, 770, 2, 73, 776, 2, 78,
+    771, 2, 79, 768, 2, 79, 769, 2, 79, 770, 2, 79, 771, 2, 79, 776,
+    2, 85, 768, 2, 85, 769, 2, 85, 770, 2, 85, 776, 2, 89, 769, 2,
+    97, 768, 2, 97, 769, 2, 97, 770, 2, 97, 771, 2, 97, 776, 2, 97,
+    778, 2, 99, 807, 2, 101, 768, 2, 101, 769, 2, 101, 770, 2, 101, 776,
+    2, 105, 768, 2, 105, 769, 2, 105, 770, 2, 105, 776, 2, 110, 771, 2,
+    111, 768, 2, 111, 769, 2, 111, 770, 2, 111, 771, 2, 111, 776, 2, 117,
+    768, 2, 117, 769, 2, 117, 770, 2, 117, 776, 2, 121, 769, 2, 121, 776,
+    2, 65, 772, 2, 97, 772, 2, 65, 774, 2, 97, 774, 2, 65, 808, 2,
+    97, 808, 2, 67, 769, 2, 99, 769, 2, 67, 770, 2, 99, 770, 2, 67,
+    775, 2, 99, 775, 2, 67, 780, 2, 99, 780, 2, 68, 780, 2, 100, 780,
+    2, 69, 772, 2, 101, 772, 2, 69, 774, 2, 101, 774, 2, 69, 775, 2,
+    101, 775, 2, 69, 808, 2, 101, 808, 2, 69, 780, 2, 101, 780, 2, 71,
+    770, 2, 103, 770, 2, 71, 774, 2, 103, 774, 2, 71, 775, 2, 103, 775,
+    2, 71, 807, 2, 103, 807, 2, 72, 770, 2, 104, 770, 2, 73, 771, 2,
+    105, 771, 2, 73, 772, 2, 105, 772, 2, 73, 774, 2, 105, 774, 2, 73,
+    808, 2, 105, 808, 2, 73, 775, 2, 74, 770, 2, 106, 770, 2, 75, 807,
+    2, 107, 807, 2, 76, 769, 2, 108, 769, 2, 76, 807, 2, 108, 807, 2,
+    76, 780, 2, 108, 780, 2, 78, 769, 2, 110, 769, 2, 78, 807, 2, 110,
+    807, 2, 78, 780, 2, 110, 780, 2, 79, 772, 2, 111, 772, 2, 79, 774,
+    2, 111, 774, 2, 79, 779, 2, 111, 779, 2, 82, 769, 2, 114, 769, 2,
+    82, 807, 2, 114, 807, 2, 82, 780, 2, 114, 780, 2, 83, 769, 2, 115,
+    769, 2, 83, 770, 2, 115, 770, 2, 83, 807, 2, 115, 807, 2, 83, 780,
+    2, 115, 780, 2, 84, 807, 2, 116, 807, 2, 84, 780, 2, 116, 780, 2,
+    85, 771, 2, 117, 771, 2, 85, 772, 2, 117, 772, 2, 85, 774, 2, 117,
+    774, 2, 85, 778, 2, 117, 778, 2, 85, 779, 2, 117, 779, 2, 85, 808,
+    2, 117, 808, 2, 87, 770, 2, 119, 770, 2, 89, 770, 2, 121, 770, 2,
+    89, 776, 2, 90, 769, 2, 122, 769, 2, 90, 775, 2, 122, 775, 2, 90,
+    780, 2, 122, 780, 2, 79, 795, 2, 111, 795, 2, 85, 795, 2, 117, 795,
+    2, 65, 780, 2, 97, 780, 2, 73, 780, 2, 105, 780, 2, 79, 780, 2,
+    111, 780, 2, 85, 780, 2, 117, 780, 3, 85, 776, 772, 3, 117, 776, 772,
+    3, 85, 776, 769, 3, 117, 776, 769, 3, 85, 776, 780, 3, 117, 776, 780,
+    3, 85, 776, 768, 3, 117, 776, 768, 3, 65, 776, 772, 3, 97, 776, 772,
+    3, 65, 775, 772, 3, 97, 775, 772, 2, 198, 772, 2, 230, 772, 2, 71,
+    780, 2, 103, 780, 2, 75, 780, 2, 107, 780, 2, 79, 808, 2, 111, 808,
+    3, 79, 808, 772, 3, 111, 808, 772, 2, 439, 780, 2, 658, 780, 2, 106,
+    780, 2, 71, 769, 2, 103, 769, 2, 78, 768, 2, 110, 768, 3, 65, 778,
+    769, 3, 97, 778, 769, 2, 198, 769, 2, 230, 769, 2, 216, 769, 2, 248,
+    769, 2, 65, 783, 2, 97, 783, 2, 65, 785, 2, 97, 785, 2, 69, 783,
+    2, 101, 783, 2, 69, 785, 2, 101, 785, 2, 73, 783, 2, 105, 783, 2,
+    73, 785, 2, 105, 785, 2, 79, 783, 2, 111, 783, 2, 79, 785, 2, 111,
+    785, 2, 82, 783, 2, 114, 783, 2, 82, 785, 2, 114, 785, 2, 85, 783,
+    2, 117, 783, 2, 85, 785, 2, 117, 785, 2, 83, 806, 2, 115, 806, 2,
+    84, 806, 2, 116, 806, 2, 72, 780, 2, 104, 780, 2, 65, 775, 2, 97,
+    775, 2, 69, 807, 2, 101, 807, 3, 79, 776, 772, 3, 111, 776, 772, 3,
+    79, 771, 772, 3, 111, 771, 772, 2, 79, 775, 2, 111, 775, 3, 79, 775,
+    772, 3, 111, 775, 772, 2, 89, 772, 2, 121, 772, 1, 768, 1, 769, 1,
+    787, 2, 776, 769, 1, 697, 1, 59, 2, 168, 769, 2, 913, 769, 1, 183,
+    2, 917, 769, 2, 919, 769, 2, 921, 769, 2, 927, 769, 2, 933, 769, 2,
+    937, 769, 3, 953, 776, 769, 2, 921, 776, 2, 933, 776, 2, 945, 769, 2,
+    949, 769, 2, 951, 769, 2, 953, 769, 3, 965, 776, 769, 2, 953, 776, 2,
+    965, 776, 2, 959, 769, 2, 965, 769, 2, 969, 769, 2, 978, 769, 2, 978,
+    776, 2, 1045, 768, 2, 1045, 776, 2, 1043, 769, 2, 1030, 776, 2, 1050, 769,
+    2, 1048, 768, 2, 1059, 774, 2, 1048, 774, 2, 1080, 774, 2, 1077, 768, 2,
+    1077, 776, 2, 1075, 769, 2, 1110, 776, 2, 1082, 769, 2, 1080, 768, 2, 1091,
+    774, 2, 1140, 783, 2, 1141, 783, 2, 1046, 774, 2, 1078, 774, 2, 1040, 774,
+    2, 1072, 774, 2, 1040, 776, 2, 1072, 776, 2, 1045, 774, 2, 1077, 774, 2,
+    1240, 776, 2, 1241, 776, 2, 1046, 776, 2, 1078, 776, 2, 1047, 776, 2, 1079,
+    776, 2, 1048, 772, 2, 1080, 772, 2, 1048, 776, 2, 1080, 776, 2, 1054, 776,
+    2, 1086, 776, 2, 1256, 776, 2, 1257, 776, 2, 1069, 776, 2, 1101, 776, 2,
+    1059, 772, 2, 1091, 772, 2, 1059, 776, 2, 1091, 776, 2, 1059, 779, 2, 1091,
+    779, 2, 1063, 776, 2, 1095, 776, 2, 1067, 776, 2, 1099, 776, 2, 1575, 1619,
+    2, 1575, 1620, 2, 1608, 1620, 2, 1575, 1621, 2, 1610, 1620, 2, 1749, 1620, 2,
+    1729, 1620, 2, 1746, 1620, 2, 2344, 2364, 2, 2352, 2364, 2, 2355, 2364, 2, 2325,
+    2364, 2, 2326, 2364, 2, 2327, 2364, 2, 2332, 2364, 2, 2337, 2364, 2, 2338, 2364,
+    2, 2347, 2364, 2, 2351, 2364, 2, 2503, 2494, 2, 2503, 2519, 2, 2465, 2492, 2,
+    2466, 2492, 2, 2479, 2492, 2, 2610, 2620, 2, 2616, 2620, 2, 2582, 2620, 2, 2583,
+    2620, 2, 2588, 2620, 2, 2603, 2620, 2, 2887, 2902, 2, 2887, 2878, 2, 2887, 2903,
+    2, 2849, 2876, 2, 2850, 2876, 2, 2962, 3031, 2, 3014, 3006, 2, 3015, 3006, 2,
+    3014, 3031, 2, 3142, 3158, 2, 3263, 3285, 2, 3270, 3285, 2, 3270, 3286, 2, 3270,
+    3266, 3, 3270, 3266, 3285, 2, 3398, 3390, 2, 3399, 3390, 2, 3398, 3415, 2, 3545,
+    3530, 2, 3545, 3535, 3, 3545, 3535, 3530, 2, 3545, 3551, 2, 3906, 4023, 2, 3916,
+    4023, 2, 3921, 4023, 2, 3926, 4023, 2, 3931, 4023, 2, 3904, 4021, 2, 3953, 3954,
+    2, 3953, 3956, 2, 4018, 3968, 2, 4019, 3968, 2, 3953, 3968, 2, 3986, 4023, 2,
+    3996, 4023, 2, 4001, 4023, 2, 4006, 4023, 2, 4011, 4023, 2, 3984, 4021, 2, 4133,
+    4142, 2, 6917, 6965, 2, 6919, 6965, 2, 6921, 6965, 2, 6923, 6965, 2, 6925, 6965,
+    2, 6929, 6965, 2, 6970, 6965, 2, 6972, 6965, 2, 6974, 6965, 2, 6975, 6965, 2,
+    6978, 6965, 2, 65, 805, 2, 97, 805, 2, 66, 775, 2, 98, 775, 2, 66,
+    803, 2, 98, 803, 2, 66, 817, 2, 98, 817, 3, 67, 807, 769, 3, 99,
+    807, 769, 2, 68, 775, 2, 100, 775, 2, 68, 803, 2, 100, 803, 2, 68,
+    817, 2, 100, 817, 2, 68, 807, 2, 100, 807, 2, 68, 813, 2, 100, 813,
+    3, 69, 772, 768, 3, 101, 772, 768, 3, 69, 772, 769, 3, 101, 772, 769,
+    2, 69, 813, 2, 101, 813, 2, 69, 816, 2, 101, 816, 3, 69, 807, 774,
+    3, 101, 807, 774, 2, 70, 775, 2, 102, 775, 2, 71, 772, 2, 103, 772,
+    2, 72, 775, 2, 104, 775, 2, 72, 803, 2, 104, 803, 2, 72, 776, 2,
+    104, 776, 2, 72, 807, 2, 104, 807, 2, 72, 814, 2, 104, 814, 2, 73,
+    816, 2, 105, 816, 3, 73, 776, 769, 3, 105, 776, 769, 2, 75, 769, 2,
+    107, 769, 2, 75, 803, 2, 107, 803, 2, 75, 817, 2, 107, 817, 2, 76,
+    803, 2, 108, 803, 3, 76, 803, 772, 3, 108, 803, 772, 2, 76, 817, 2,
+    108, 817, 2, 76, 813, 2, 108, 813, 2, 77, 769, 2, 109, 769, 2, 77,
+    775, 2, 109, 775, 2, 77, 803, 2, 109, 803, 2, 78, 775, 2, 110, 775,
+    2, 78, 803, 2, 110, 803, 2, 78, 817, 2, 110, 817, 2, 78, 813, 2,
+    110, 813, 3, 79, 771, 769, 3, 111, 771, 769, 3, 79, 771, 776, 3, 111,
+    771, 776, 3, 79, 772, 768, 3, 111, 772, 768, 3, 79, 772, 769, 3, 111,
+    772, 769, 2, 80, 769, 2, 112, 769, 2, 80, 775, 2, 112, 775, 2, 82,
+    775, 2, 114, 775, 2, 82, 803, 2, 114, 803, 3, 82, 803, 772, 3, 114,
+    803, 772, 2, 82, 817, 2, 114, 817, 2, 83, 775, 2, 115, 775, 2, 83,
+    803, 2, 115, 803, 3, 83, 769, 775, 3, 115, 769, 775, 3, 83, 780, 775,
+    3, 115, 780, 775, 3, 83, 803, 775, 3, 115, 803, 775, 2, 84, 775, 2,
+    116, 775, 2, 84, 803, 2, 116, 803, 2, 84, 817, 2, 116, 817, 2, 84,
+    813, 2, 116, 813, 2, 85, 804, 2, 117, 804, 2, 85, 816, 2, 117, 816,
+    2, 85, 813, 2, 117, 813, 3, 85, 771, 769, 3, 117, 771, 769, 3, 85,
+    772, 776, 3, 117, 772, 776, 2, 86, 771, 2, 118, 771, 2, 86, 803, 2,
+    118, 803, 2, 87, 768, 2, 119, 768, 2, 87, 769, 2, 119, 769, 2, 87,
+    776, 2, 119, 776, 2, 87, 775, 2, 119, 775, 2, 87, 803, 2, 119, 803,
+    2, 88, 775, 2, 120, 775, 2, 88, 776, 2, 120, 776, 2, 89, 775, 2,
+    121, 775, 2, 90, 770, 2, 122, 770, 2, 90, 803, 2, 122, 803, 2, 90,
+    817, 2, 122, 817, 2, 104, 817, 2, 116, 776, 2, 119, 778, 2, 121, 778,
+    2, 383, 775, 2, 65, 803, 2, 97, 803, 2, 65, 777, 2, 97, 777, 3,
+    65, 770, 769, 3, 97, 770, 769, 3, 65, 770, 768, 3, 97, 770, 768, 3,
+    65, 770, 777, 3, 97, 770, 777, 3, 65, 770, 771, 3, 97, 770, 771, 3,
+    65, 803, 770, 3, 97, 803, 770, 3, 65, 774, 769, 3, 97, 774, 769, 3,
+    65, 774, 768, 3, 97, 774, 768, 3, 65, 774, 777, 3, 97, 774, 777, 3,
+    65, 774, 771, 3, 97, 774, 771, 3, 65, 803, 774, 3, 97, 803, 774, 2,
+    69, 803, 2, 101, 803, 2, 69, 777, 2, 101, 777, 2, 69, 771, 2, 101,
+    771, 3, 69, 770, 769, 3, 101, 770, 769, 3, 69, 770, 768, 3, 101, 770,
+    768, 3, 69, 770, 777, 3, 101, 770, 777, 3, 69, 770, 771, 3, 101, 770,
+    771, 3, 69, 803, 770, 3, 101, 803, 770, 2, 73, 777, 2, 105, 777, 2,
+    73, 803, 2, 105, 803, 2, 79, 803, 2, 111, 803, 2, 79, 777, 2, 111,
+    777, 3, 79, 770, 769, 3, 111, 770, 769, 3, 79, 770, 768, 3, 111, 770,
+    768, 3, 79, 770, 777, 3, 111, 770, 777, 3, 79, 770, 771, 3, 111, 770,
+    771, 3, 79, 803, 770, 3, 111, 803, 770, 3, 79, 795, 769, 3, 111, 795,
+    769, 3, 79, 795, 768, 3, 111, 795, 768, 3, 79, 795, 777, 3, 111, 795,
+    777, 3, 79, 795, 771, 3, 111, 795, 771, 3, 79, 795, 803, 3, 111, 795,
+    803, 2, 85, 803, 2, 117, 803, 2, 85, 777, 2, 117, 777, 3, 85, 795,
+    769, 3, 117, 795, 769, 3, 85, 795, 768, 3, 117, 795, 768, 3, 85, 795,
+    777, 3, 117, 795, 777, 3, 85, 795, 771, 3, 117, 795, 771, 3, 85, 795,
+    803, 3, 117, 795, 803, 2, 89, 768, 2, 121, 768, 2, 89, 803, 2, 121,
+    803, 2, 89, 777, 2, 121, 777, 2, 89, 771, 2, 121, 771, 2, 945, 787,
+    2, 945, 788, 3, 945, 787, 768, 3, 945, 788, 768, 3, 945, 787, 769, 3,
+    945, 788, 769, 3, 945, 787, 834, 3, 945, 788, 834, 2, 913, 787, 2, 913,
+    788, 3, 913, 787, 768, 3, 913, 788, 768, 3, 913, 787, 769, 3, 913, 788,
+    769, 3, 913, 787, 834, 3, 913, 788, 834, 2, 949, 787, 2, 949, 788, 3,
+    949, 787, 768, 3, 949, 788, 768, 3, 949, 787, 769, 3, 949, 788, 769, 2,
+    917, 787, 2, 917, 788, 3, 917, 787, 768, 3, 917, 788, 768, 3, 917, 787,
+    769, 3, 917, 788, 769, 2, 951, 787, 2, 951, 788, 3, 951, 787, 768, 3,
+    951, 788, 768, 3, 951, 787, 769, 3, 951, 788, 769, 3, 951, 787, 834, 3,
+    951, 788, 834, 2, 919, 787, 2, 919, 788, 3, 919, 787, 768, 3, 919, 788,
+    768, 3, 919, 787, 769, 3, 919, 788, 769, 3, 919, 787, 834, 3, 919, 788,
+    834, 2, 953, 787, 2, 953, 788, 3, 953, 787, 768, 3, 953, 788, 768, 3,
+    953, 787, 769, 3, 953, 788, 769, 3, 953, 787, 834, 3, 953, 788, 834, 2,
+    921, 787, 2, 921, 788, 3, 921, 787, 768, 3, 921, 788, 768, 3, 921, 787,
+    769, 3, 921, 788, 769, 3, 921, 787, 834, 3, 921, 788, 834, 2, 959, 787,
+    2, 959, 788, 3, 959, 787, 768, 3, 959, 788, 768, 3, 959, 787, 769, 3,
+    959, 788, 769, 2, 927, 787, 2, 927, 788, 3, 927, 787, 768, 3, 927, 788,
+    768, 3, 927, 787, 769, 3, 927, 788, 769, 2, 965, 787, 2, 965, 788, 3,
+    965, 787, 768, 3, 965, 788, 768, 3, 965, 787, 769, 3, 965, 788, 769, 3,
+    965, 787, 834, 3, 965, 788, 834, 2, 933, 788, 3, 933, 788, 768, 3, 933,
+    788, 769, 3, 933, 788, 834, 2, 969, 787, 2, 969, 788, 3, 969, 787, 768,
+    3, 969, 788, 768, 3, 969, 787, 769, 3, 969, 788, 769, 3, 969, 787, 834,
+    3, 969, 788, 834, 2, 937, 787, 2, 937, 788, 3, 937, 787, 768, 3, 937,
+    788, 768, 3, 937, 787, 769, 3, 937, 788, 769, 3, 937, 787, 834, 3, 937,
+    788, 834, 2, 945, 768, 2, 945, 769, 2, 949, 768, 2, 949, 769, 2, 951,
+    768, 2, 951, 769, 2, 953, 768, 2, 953, 769, 2, 959, 768, 2, 959, 769,
+    2, 965, 768, 2, 965, 769, 2, 969, 768, 2, 969, 769, 3, 945, 787, 837,
+    3, 945, 788, 837, 4, 945, 787, 768, 837, 4, 945, 788, 768, 837, 4, 945,
+    787, 769, 837, 4, 945, 788, 769, 837, 4, 945, 787, 834, 837, 4, 945, 788,
+    834, 837, 3, 913, 787, 837, 3, 913, 788, 837, 4, 913, 787, 768, 837, 4,
+    913, 788, 768, 837, 4, 913, 787, 769, 837, 4, 913, 788, 769, 837, 4, 913,
+    787, 834, 837, 4, 913, 788, 834, 837, 3, 951, 787, 837, 3, 951, 788, 837,
+    4, 951, 787, 768, 837, 4, 951, 788, 768, 837, 4, 951, 787, 769, 837, 4,
+    951, 788, 769, 837, 4, 951, 787, 834, 837, 4, 951, 788, 834, 837, 3, 919,
+    787, 837, 3, 919, 788, 837, 4, 919, 787, 768, 837, 4, 919, 788, 768, 837,
+    4, 919, 787, 769, 837, 4, 919, 788, 769, 837, 4, 919, 787, 834, 837, 4,
+    919, 788, 834, 837, 3, 969, 787, 837, 3, 969, 788, 837, 4, 969, 787, 768,
+    837, 4, 969, 788, 768, 837, 4, 969, 787, 769, 837, 4, 969, 788, 769, 837,
+    4, 969, 787, 834, 837, 4, 969, 788, 834, 837, 3, 937, 787, 837, 3, 937,
+    788, 837, 4, 937, 787, 768, 837, 4, 937, 788, 768, 837, 4, 937, 787, 769,
+    837, 4, 937, 788, 769, 837, 4, 937, 787, 834, 837, 4, 937, 788, 834, 837,
+    2, 945, 774, 2, 945, 772, 3, 945, 768, 837, 2, 945, 837, 3, 945, 769,
+    837, 2, 945, 834, 3, 945, 834, 837, 2, 913, 774, 2, 913, 772, 2, 913,
+    768, 2, 913, 769, 2, 913, 837, 1, 953, 2, 168, 834, 3, 951, 768, 837,
+    2, 951, 837, 3, 951, 769, 837, 2, 951, 834, 3, 951, 834, 837, 2, 917,
+    768, 2, 917, 769, 2, 919, 768, 2, 919, 769, 2, 919, 837, 2, 8127, 768,
+    2, 8127, 769, 2, 8127, 834, 2, 953, 774, 2, 953, 772, 3, 953, 776, 768,
+    3, 953, 776, 769, 2, 953, 834, 3, 953, 776, 834, 2, 921, 774, 2, 921,
+    772, 2, 921, 768, 2, 921, 769, 2, 8190, 768, 2, 8190, 769, 2, 8190, 834,
+    2, 965, 774, 2, 965, 772, 3, 965, 776, 768, 3, 965, 776, 769, 2, 961,
+    787, 2, 961, 788, 2, 965, 834, 3, 965, 776, 834, 2, 933, 774, 2, 933,
+    772, 2, 933, 768, 2, 933, 769, 2, 929, 788, 2, 168, 768, 2, 168, 769,
+    1, 96, 3, 969, 768, 837, 2, 969, 837, 3, 969, 769, 837, 2, 969, 834,
+    3, 969, 834, 837, 2, 927, 768, 2, 927, 769, 2, 937, 768, 2, 937, 769,
+    2, 937, 837, 1, 180, 1, 8194, 1, 8195, 1, 937, 1, 75, 2, 65, 778,
+    2, 8592, 824, 2, 8594, 824, 2, 8596, 824, 2, 8656, 824, 2, 8660, 824, 2,
+    8658, 824, 2, 8707, 824, 2, 8712, 824, 2, 8715, 824, 2, 8739, 824, 2, 8741,
+    824, 2, 8764, 824, 2, 8771, 824, 2, 8773, 824, 2, 8776, 824, 2, 61, 824,
+    2, 8801, 824, 2, 8781, 824, 2, 60, 824, 2, 62, 824, 2, 8804, 824, 2,
+    8805, 824, 2, 8818, 824, 2, 8819, 824, 2, 8822, 824, 2, 8823, 824, 2, 8826,
+    824, 2, 8827, 824, 2, 8834, 824, 2, 8835, 824, 2, 8838, 824, 2, 8839, 824,
+    2, 8866, 824, 2, 8872, 824, 2, 8873, 824, 2, 8875, 824, 2, 8828, 824, 2,
+    8829, 824, 2, 8849, 824, 2, 8850, 824, 2, 8882, 824, 2, 8883, 824, 2, 8884,
+    824, 2, 8885, 824, 1, 12296, 1, 12297, 2, 10973, 824, 2, 12363, 12441, 2, 12365,
+    12441, 2, 12367, 12441, 2, 12369, 12441, 2, 12371, 12441, 2, 12373, 12441, 2, 12375, 12441,
+    2, 12377, 12441, 2, 12379, 12441, 2, 12381, 12441, 2, 12383, 12441, 2, 12385, 12441, 2,
+    12388, 12441, 2, 12390, 12441, 2, 12392, 12441, 2, 12399, 12441, 2, 12399, 12442, 2, 12402,
+    12441, 2, 12402, 12442, 2, 12405, 12441, 2, 12405, 12442, 2, 12408, 12441, 2, 12408, 12442,
+    2, 12411, 12441, 2, 12411, 12442, 2, 12358, 12441, 2, 12445, 12441, 2, 12459, 12441, 2,
+    12461, 12441, 2, 12463, 12441, 2, 12465, 12441, 2, 12467, 12441, 2, 12469, 12441, 2, 12471,
+    12441, 2, 12473, 12441, 2, 12475, 12441, 2, 12477, 12441, 2, 12479, 12441, 2, 12481, 12441,
+    2, 12484, 12441, 2, 12486, 12441, 2, 12488, 12441, 2, 12495, 12441, 2, 12495, 12442, 2,
+    12498, 12441, 2, 12498, 12442, 2, 12501, 12441, 2, 12501, 12442, 2, 12504, 12441, 2, 12504,
+    12442, 2, 12507, 12441, 2, 12507, 12442, 2, 12454, 12441, 2, 12527, 12441, 2, 12528, 12441,
+    2, 12529, 12441, 2, 12530, 12441, 2, 12541, 12441, 1, 35912, 1, 26356, 1, 36554, 1,
+    36040, 1, 28369, 1, 20018, 1, 21477, 1, 40860, 1, 40860, 1, 22865, 1, 37329, 1,
+    21895, 1, 22856, 1, 25078, 1, 30313, 1, 32645, 1, 34367, 1, 34746, 1, 35064, 1,
+    37007, 1, 27138, 1, 27931, 1, 28889, 1, 29662, 1, 33853, 1, 37226, 1, 39409, 1,
+    20098, 1, 21365, 1, 27396, 1, 29211, 1, 34349, 1, 40478, 1, 23888, 1, 28651, 1,
+    34253, 1, 35172, 1, 25289, 1, 33240, 1, 34847, 1, 24266, 1, 26391, 1, 28010, 1,
+    29436, 1, 37070, 1, 20358, 1, 20919, 1, 21214, 1, 25796, 1, 27347, 1, 29200, 1,
+    30439, 1, 32769, 1, 34310, 1, 34396, 1, 36335, 1, 38706, 1, 39791, 1, 40442, 1,
+    30860, 1, 31103, 1, 32160, 1, 33737, 1, 37636, 1, 40575, 1, 35542, 1, 22751, 1,
+    24324, 1, 31840, 1, 32894, 1, 29282, 1, 30922, 1, 36034, 1, 38647, 1, 22744, 1,
+    23650, 1, 27155, 1, 28122, 1, 28431, 1, 32047, 1, 32311, 1, 38475, 1, 21202, 1,
+    32907, 1, 20956, 1, 20940, 1, 31260, 1, 32190, 1, 33777, 1, 38517, 1, 35712, 1,
+    25295, 1, 27138, 1, 35582, 1, 20025, 1, 23527, 1, 24594, 1, 29575, 1, 30064, 1,
+    21271, 1, 30971, 1, 20415, 1, 24489, 1, 19981, 1, 27852, 1, 25976, 1, 32034, 1,
+    21443, 1, 22622, 1, 30465, 1, 33865, 1, 35498, 1, 27578, 1, 36784, 1, 27784, 1,
+    25342, 1, 33509, 1, 25504, 1, 30053, 1, 20142, 1, 20841, 1, 20937, 1, 26753, 1,
+    31975, 1, 33391, 1, 35538, 1, 37327, 1, 21237, 1, 21570, 1, 22899, 1, 24300, 1,
+    26053, 1, 28670, 1, 31018, 1, 38317, 1, 39530, 1, 40599, 1, 40654, 1, 21147, 1,
+    26310, 1, 27511, 1, 36706, 1, 24180, 1, 24976, 1, 25088, 1, 25754, 1, 28451, 1,
+    29001, 1, 29833, 1, 31178, 1, 32244, 1, 32879, 1, 36646, 1, 34030, 1, 36899, 1,
+    37706, 1, 21015, 1, 21155, 1, 21693, 1, 28872, 1, 35010, 1, 35498, 1, 24265, 1,
+    24565, 1, 25467, 1, 27566, 1, 31806, 1, 29557, 1, 20196, 1, 22265, 1, 23527, 1,
+    23994, 1, 24604, 1, 29618, 1, 29801, 1, 32666, 1, 32838, 1, 37428, 1, 38646, 1,
+    38728, 1, 38936, 1, 20363, 1, 31150, 1, 37300, 1, 38584, 1, 24801, 1, 20102, 1,
+    20698, 1, 23534, 1, 23615, 1, 26009, 1, 27138, 1, 29134, 1, 30274, 1, 34044, 1,
+    36988, 1, 40845, 1, 26248, 1, 38446, 1, 21129, 1, 26491, 1, 26611, 1, 27969, 1,
+    28316, 1, 29705, 1, 30041, 1, 30827, 1, 32016, 1, 39006, 1, 20845, 1, 25134, 1,
+    38520, 1, 20523, 1, 23833, 1, 28138, 1, 36650, 1, 24459, 1, 24900, 1, 26647, 1,
+    29575, 1, 38534, 1, 21033, 1, 21519, 1, 23653, 1, 26131, 1, 26446, 1, 26792, 1,
+    27877, 1, 29702, 1, 30178, 1, 32633, 1, 35023, 1, 35041, 1, 37324, 1, 38626, 1,
+    21311, 1, 28346, 1, 21533, 1, 29136, 1, 29848, 1, 34298, 1, 38563, 1, 40023, 1,
+    40607, 1, 26519, 1, 28107, 1, 33256, 1, 31435, 1, 31520, 1, 31890, 1, 29376, 1,
+    28825, 1, 35672, 1, 20160, 1, 33590, 1, 21050, 1, 20999, 1, 24230, 1, 25299, 1,
+    31958, 1, 23429, 1, 27934, 1, 26292, 1, 36667, 1, 34892, 1, 38477, 1, 35211, 1,
+    24275, 1, 20800, 1, 21952, 1, 22618, 1, 26228, 1, 20958, 1, 29482, 1, 30410, 1,
+    31036, 1, 31070, 1, 31077, 1, 31119, 1, 38742, 1, 31934, 1, 32701, 1, 34322, 1,
+    35576, 1, 36920, 1, 37117, 1, 39151, 1, 39164, 1, 39208, 1, 40372, 1, 37086, 1,
+    38583, 1, 20398, 1, 20711, 1, 20813, 1, 21193, 1, 21220, 1, 21329, 1, 21917, 1,
+    22022, 1, 22120, 1, 22592, 1, 22696, 1, 23652, 1, 23662, 1, 24724, 1, 24936, 1,
+    24974, 1, 25074, 1, 25935, 1, 26082, 1, 26257, 1, 26757, 1, 28023, 1, 28186, 1,
+    28450, 1, 29038, 1, 29227, 1, 29730, 1, 30865, 1, 31038, 1, 31049, 1, 31048, 1,
+    31056, 1, 31062, 1, 31069, 1, 31117, 1, 31118, 1, 31296, 1, 31361, 1, 31680, 1,
+    32244, 1, 32265, 1, 32321, 1, 32626, 1, 32773, 1, 33261, 1, 33401, 1, 33401, 1,
+    33879, 1, 35088, 1, 35222, 1, 35585, 1, 35641, 1, 36051, 1, 36104, 1, 36790, 1,
+    36920, 1, 38627, 1, 38911, 1, 38971, 1, 24693, 1, 148206, 1, 33304, 1, 20006, 1,
+    20917, 1, 20840, 1, 20352, 1, 20805, 1, 20864, 1, 21191, 1, 21242, 1, 21917, 1,
+    21845, 1, 21913, 1, 21986, 1, 22618, 1, 22707, 1, 22852, 1, 22868, 1, 23138, 1,
+    23336, 1, 24274, 1, 24281, 1, 24425, 1, 24493, 1, 24792, 1, 24910, 1, 24840, 1,
+    24974, 1, 24928, 1, 25074, 1, 25140, 1, 25540, 1, 25628, 1, 25682, 1, 25942, 1,
+    26228, 1, 26391, 1, 26395, 1, 26454, 1, 27513, 1, 27578, 1, 27969, 1, 28379, 1,
+    28363, 1, 28450, 1, 28702, 1, 29038, 1, 30631, 1, 29237, 1, 29359, 1, 29482, 1,
+    29809, 1, 29958, 1, 30011, 1, 30237, 1, 30239, 1, 30410, 1, 30427, 1, 30452, 1,
+    30538, 1, 30528, 1, 30924, 1, 31409, 1, 31680, 1, 31867, 1, 32091, 1, 32244, 1,
+    32574, 1, 32773, 1, 33618, 1, 33775, 1, 34681, 1, 35137, 1, 35206, 1, 35222, 1,
+    35519, 1, 35576, 1, 35531, 1, 35585, 1, 35582, 1, 35565, 1, 35641, 1, 35722, 1,
+    36104, 1, 36664, 1, 36978, 1, 37273, 1, 37494, 1, 38524, 1, 38627, 1, 38742, 1,
+    38875, 1, 38911, 1, 38923, 1, 38971, 1, 39698, 1, 40860, 1, 141386, 1, 141380, 1,
+    144341, 1, 15261, 1, 16408, 1, 16441, 1, 152137, 1, 154832, 1, 163539, 1, 40771, 1,
+    40846, 2, 1497, 1460, 2, 1522, 1463, 2, 1513, 1473, 2, 1513, 1474, 3, 1513, 1468,
+    1473, 3, 1513, 1468, 1474, 2, 1488, 1463, 2, 1488, 1464, 2, 1488, 1468, 2, 1489,
+    1468, 2, 1490, 1468, 2, 1491, 1468, 2, 1492, 1468, 2, 1493, 1468, 2, 1494, 1468,
+    2, 1496, 1468, 2, 1497, 1468, 2, 1498, 1468, 2, 1499, 1468, 2, 1500, 1468, 2,
+    1502, 1468, 2, 1504, 1468, 2, 1505, 1468, 2, 1507, 1468, 2, 1508, 1468, 2, 1510,
+    1468, 2, 1511, 1468, 2, 1512, 1468, 2, 1513, 1468, 2, 1514, 1468, 2, 1493, 1465,
+    2, 1489, 1471, 2, 1499, 1471, 2, 1508, 1471, 2, 69785, 69818, 2, 69787, 69818, 2,
+    69797, 69818, 2, 69937, 69927, 2, 69938, 69927, 2, 70471, 70462, 2, 70471, 70487, 2, 70841,
+    70842, 2, 70841, 70832, 2, 70841, 70845, 2, 71096, 71087, 2, 71097, 71087, 2, 71989, 71984,
+    2, 119127, 119141, 2, 119128, 119141, 3, 119128, 119141, 119150, 3, 119128, 119141, 119151, 3, 119128,
+    119141, 119152, 3, 119128, 119141, 119153, 3, 119128, 119141, 119154, 2, 119225, 119141, 2, 119226, 119141,
+    3, 119225, 119141, 119150, 3, 119226, 119141, 119150, 3, 119225, 119141, 119151, 3, 119226, 119141, 119151,
+    1, 20029, 1, 20024, 1, 20033, 1, 131362, 1, 20320, 1, 20398, 1, 20411, 1, 20482,
+    1, 20602, 1, 20633, 1, 20711, 1, 20687, 1, 13470, 1, 132666, 1, 20813, 1, 20820,
+    1, 20836, 1, 20855, 1, 132380, 1, 13497, 1, 20839, 1, 20877, 1, 132427, 1, 20887,
+    1, 20900, 1, 20172, 1, 20908, 1, 20917, 1, 168415, 1, 20981, 1, 20995, 1, 13535,
+    1, 21051, 1, 21062, 1, 21106, 1, 21111, 1, 13589, 1, 21191, 1, 21193, 1, 21220,
+    1, 21242, 1, 21253, 1, 21254, 1, 21271, 1, 21321, 1, 21329, 1, 21338, 1, 21363,
+    1, 21373, 1, 21375, 1, 21375, 1, 21375, 1, 133676, 1, 28784, 1, 21450, 1, 21471,
+    1, 133987, 1, 21483, 1, 21489, 1, 21510, 1, 21662, 1, 21560, 1, 21576, 1, 21608,
+    1, 21666, 1, 21750, 1, 21776, 1, 21843, 1, 21859, 1, 21892, 1, 21892, 1, 21913,
+    1, 21931, 1, 21939, 1, 21954, 1, 22294, 1, 22022, 1, 22295, 1, 22097, 1, 22132,
+    1, 20999, 1, 22766, 1, 22478, 1, 22516, 1, 22541, 1, 22411, 1, 22578, 1, 22577,
+    1, 22700, 1, 136420, 1, 22770, 1, 22775, 1, 22790, 1, 22810, 1, 22818, 1, 22882,
+    1, 136872, 1, 136938, 1, 23020, 1, 23067, 1, 23079, 1, 23000, 1, 23142, 1, 14062,
+    1, 14076, 1, 23304, 1, 23358, 1, 23358, 1, 137672, 1, 23491, 1, 23512, 1, 23527,
+    1, 23539, 1, 138008, 1, 23551, 1, 23558, 1, 24403, 1, 23586, 1, 14209, 1, 23648,
+    1, 23662, 1, 23744, 1, 23693, 1, 138724, 1, 23875, 1, 138726, 1, 23918, 1, 23915,
+    1, 23932, 1, 24033, 1, 24034, 1, 14383, 1, 24061, 1, 24104, 1, 24125, 1, 24169,
+    1, 14434, 1, 139651, 1, 14460, 1, 24240, 1, 24243, 1, 24246, 1, 24266, 1, 172946,
+    1, 24318, 1, 140081, 1, 140081, 1, 33281, 1, 24354, 1, 24354, 1, 14535, 1, 144056,
+    1, 156122, 1, 24418, 1, 24427, 1, 14563, 1, 24474, 1, 24525, 1, 24535, 1, 24569,
+    1, 24705, 1, 14650, 1, 14620, 1, 24724, 1, 141012, 1, 24775, 1, 24904, 1, 24908,
+    1, 24910, 1, 24908, 1, 24954, 1, 24974, 1, 25010, 1, 24996, 1, 25007, 1, 25054,
+    1, 25074, 1, 25078, 1, 25104, 1, 25115, 1, 25181, 1, 25265, 1, 25300, 1, 25424,
+    1, 142092, 1, 25405, 1, 25340, 1, 25448, 1, 25475, 1, 25572, 1, 142321, 1, 25634,
+    1, 25541, 1, 25513, 1, 14894, 1, 25705, 1, 25726, 1, 25757, 1, 25719, 1, 14956,
+    1, 25935, 1, 25964, 1, 143370, 1, 26083, 1, 26360, 1, 26185, 1, 15129, 1, 26257,
+    1, 15112, 1, 15076, 1, 20882, 1, 20885, 1, 26368, 1, 26268, 1, 32941, 1, 17369,
+    1, 26391, 1, 26395, 1, 26401, 1, 26462, 1, 26451, 1, 144323, 1, 15177, 1, 26618,
+    1, 26501, 1, 26706, 1, 26757, 1, 144493, 1, 26766, 1, 26655, 1, 26900, 1, 15261,
+    1, 26946, 1, 27043, 1, 27114, 1, 27304, 1, 145059, 1, 27355, 1, 15384, 1, 27425,
+    1, 145575, 1, 27476, 1, 15438, 1, 27506, 1, 27551, 1, 27578, 1, 27579, 1, 146061,
+    1, 138507, 1, 146170, 1, 27726, 1, 146620, 1, 27839, 1, 27853, 1, 27751, 1, 27926,
+    1, 27966, 1, 28023, 1, 27969, 1, 28009, 1, 28024, 1, 28037, 1, 146718, 1, 27956,
+    1, 28207, 1, 28270, 1, 15667, 1, 28363, 1, 28359, 1, 147153, 1, 28153, 1, 28526,
+    1, 147294, 1, 147342, 1, 28614, 1, 28729, 1, 28702, 1, 28699, 1, 15766, 1, 28746,
+    1, 28797, 1, 28791, 1, 28845, 1, 132389, 1, 28997, 1, 148067, 1, 29084, 1, 148395,
+    1, 29224, 1, 29237, 1, 29264, 1, 149000, 1, 29312, 1, 29333, 1, 149301, 1, 149524,
+    1, 29562, 1, 29579, 1, 16044, 1, 29605, 1, 16056, 1, 16056, 1, 29767, 1, 29788,
+    1, 29809, 1, 29829, 1, 29898, 1, 16155, 1, 29988, 1, 150582, 1, 30014, 1, 150674,
+    1, 30064, 1, 139679, 1, 30224, 1, 151457, 1, 151480, 1, 151620, 1, 16380, 1, 16392,
+    1, 30452, 1, 151795, 1, 151794, 1, 151833, 1, 151859, 1, 30494, 1, 30495, 1, 30495,
+    1, 30538, 1, 16441, 1, 30603, 1, 16454, 1, 16534, 1, 152605, 1, 30798, 1, 30860,
+    1, 30924, 1, 16611, 1, 153126, 1, 31062, 1, 153242, 1, 153285, 1, 31119, 1, 31211,
+    1, 16687, 1, 31296, 1, 31306, 1, 31311, 1, 153980, 1, 154279, 1, 154279, 1, 31470,
+    1, 16898, 1, 154539, 1, 31686, 1, 31689, 1, 16935, 1, 154752, 1, 31954, 1, 17056,
+    1, 31976, 1, 31971, 1, 32000, 1, 155526, 1, 32099, 1, 17153, 1, 32199, 1, 32258,
+    1, 32325, 1, 17204, 1, 156200, 1, 156231, 1, 17241, 1, 156377, 1, 32634, 1, 156478,
+    1, 32661, 1, 32762, 1, 32773, 1, 156890, 1, 156963, 1, 32864, 1, 157096, 1, 32880,
+    1, 144223, 1, 17365, 1, 32946, 1, 33027, 1, 17419, 1, 33086, 1, 23221, 1, 157607,
+    1, 157621, 1, 144275, 1, 144284, 1, 33281, 1, 33284, 1, 36766, 1, 17515, 1, 33425,
+    1, 33419, 1, 33437, 1, 21171, 1, 33457, 1, 33459, 1, 33469, 1, 33510, 1, 158524,
+    1, 33509, 1, 33565, 1, 33635, 1, 33709, 1, 33571, 1, 33725, 1, 33767, 1, 33879,
+    1, 33619, 1, 33738, 1, 33740, 1, 33756, 1, 158774, 1, 159083, 1, 158933, 1, 17707,
+    1, 34033, 1, 34035, 1, 34070, 1, 160714, 1, 34148, 1, 159532, 1, 17757, 1, 17761,
+    1, 159665, 1, 159954, 1, 17771, 1, 34384, 1, 34396, 1, 34407, 1, 34409, 1, 34473,
+    1, 34440, 1, 34574, 1, 34530, 1, 34681, 1, 34600, 1, 34667, 1, 34694, 1, 17879,
+    1, 34785, 1, 34817, 1, 17913, 1, 34912, 1, 34915, 1, 161383, 1, 35031, 1, 35038,
+    1, 17973, 1, 35066, 1, 13499, 1, 161966, 1, 162150, 1, 18110, 1, 18119, 1, 35488,
+    1, 35565, 1, 35722, 1, 35925, 1, 162984, 1, 36011, 1, 36033, 1, 36123, 1, 36215,
+    1, 163631, 1, 133124, 1, 36299, 1, 36284, 1, 36336, 1, 133342, 1, 36564, 1, 36664,
+    1, 165330, 1, 165357, 1, 37012, 1, 37105, 1, 37137, 1, 165678, 1, 37147, 1, 37432,
+    1, 37591, 1, 37592, 1, 37500, 1, 37881, 1, 37909, 1, 166906, 1, 38283, 1, 18837,
+    1, 38327, 1, 167287, 1, 18918, 1, 38595, 1, 23986, 1, 38691, 1, 168261, 1, 168474,
+    1, 19054, 1, 19062, 1, 38880, 1, 168970, 1, 19122, 1, 169110, 1, 38923, 1, 38923,
+    1, 38953, 1, 169398, 1, 39138, 1, 19251, 1, 39209, 1, 39335, 1, 39362, 1, 39422,
+    1, 19406, 1, 170800, 1, 39698, 1, 40000, 1, 40189, 1, 19662, 1, 19693, 1, 40295,
+    1, 172238, 1, 19704, 1, 172293, 1, 172558, 1, 172689, 1, 40635, 1, 19798, 1, 40697,
+    1, 40702, 1, 40709, 1, 40719, 1, 40726, 1, 40763, 1, 173568,
+};
+
+const uint64_t unicode_composition_keys[941] =
+{
+    125829944, 127927096, 130024248, 136315648, 136315649, 136315650, 136315651, 136315652, 136315654, 136315655, 136315656, 136315657, 136315658, 136315660, 136315663, 136315665,
+    136315683, 136315685, 136315688, 138412807, 138412835, 138412849, 140509953, 140509954, 140509959, 140509964, 140509991, 142607111, 142607116, 142607139, 142607143, 142607149,
+    142607153, 144704256, 144704257, 144704258, 144704259, 144704260, 144704262, 144704263, 144704264, 144704265, 144704268, 144704271, 144704273, 144704291, 144704295, 144704296,
+    144704301, 144704304, 146801415, 148898561, 148898562, 148898564, 148898566, 148898567, 148898572, 148898599, 150995714, 150995719, 150995720, 150995724, 150995747, 150995751,
+    150995758, 153092864, 153092865, 153092866, 153092867, 153092868, 153092870, 153092871, 153092872, 153092873, 153092876, 153092879, 153092881, 153092899, 153092904, 153092912,
+    155190018, 157287169, 157287180, 157287203, 157287207, 157287217, 159384321, 159384332, 159384355, 159384359, 159384365, 159384369, 161481473, 161481479, 161481507, 163578624,
+    163578625, 163578627, 163578631, 163578636, 163578659, 163578663, 163578669, 163578673, 165675776, 165675777, 165675778, 165675779, 165675780, 165675782, 165675783, 165675784,
+    165675785, 165675787, 165675788, 165675791, 165675793, 165675803, 165675811, 165675816, 167772929, 167772935, 171967233, 171967239, 171967244, 171967247, 171967249, 171967267,
+    171967271, 171967281, 174064385, 174064386, 174064391, 174064396, 174064419, 174064422, 174064423, 176161543, 176161548, 176161571, 176161574, 176161575, 176161581, 176161585,
+    178258688, 178258689, 178258690, 178258691, 178258692, 178258694, 178258696, 178258697, 178258698, 178258699, 178258700, 178258703, 178258705, 178258715, 178258723, 178258724,
+    178258728, 178258733, 178258736, 180355843, 180355875, 182452992, 182452993, 182452994, 182452999, 182453000, 182453027, 184550151, 184550152, 186647296, 186647297, 186647298,
+    186647299, 186647300, 186647303, 186647304, 186647305, 186647331, 188744449, 188744450, 188744455, 188744460, 188744483, 188744497, 203424512, 203424513, 203424514, 203424515,
+    203424516, 203424518, 203424519, 203424520, 203424521, 203424522, 203424524, 203424527, 203424529, 203424547, 203424549, 203424552, 205521671, 205521699, 205521713, 207618817,
+    207618818, 207618823, 207618828, 207618855, 209715975, 209715980, 209716003, 209716007, 209716013, 209716017, 211813120, 211813121, 211813122, 211813123, 211813124, 211813126,
+    211813127, 211813128, 211813129, 211813132, 211813135, 211813137, 211813155, 211813159, 211813160, 211813165, 211813168, 213910279, 216007425, 216007426, 216007428, 216007430,
+    216007431, 216007436, 216007463, 218104578, 218104583, 218104584, 218104588, 218104611, 218104615, 218104622, 218104625, 220201728, 220201729, 220201730, 220201731, 220201732,
+    220201734, 220201736, 220201737, 220201740, 220201743, 220201745, 220201763, 220201768, 220201776, 222298882, 222298892, 224396033, 224396044, 224396067, 224396071, 224396081,
+    226493185, 226493196, 226493219, 226493223, 226493229, 226493233, 228590337, 228590343, 228590371, 230687488, 230687489, 230687491, 230687495, 230687500, 230687523, 230687527,
+    230687533, 230687537, 232784640, 232784641, 232784642, 232784643, 232784644, 232784646, 232784647, 232784648, 232784649, 232784651, 232784652, 232784655, 232784657, 232784667,
+    232784675, 232784680, 234881793, 234881799, 239076097, 239076103, 239076108, 239076111, 239076113, 239076131, 239076135, 239076145, 241173249, 241173250, 241173255, 241173260,
+    241173283, 241173286, 241173287, 243270407, 243270408, 243270412, 243270435, 243270438, 243270439, 243270445, 243270449, 245367552, 245367553, 245367554, 245367555, 245367556,
+    245367558, 245367560, 245367561, 245367562, 245367563, 245367564, 245367567, 245367569, 245367579, 245367587, 245367588, 245367592, 245367597, 245367600, 247464707, 247464739,
+    249561856, 249561857, 249561858, 249561863, 249561864, 249561866, 249561891, 251659015, 251659016, 253756160, 253756161, 253756162, 253756163, 253756164, 253756167, 253756168,
+    253756169, 253756170, 253756195, 255853313, 255853314, 255853319, 255853324, 255853347, 255853361, 352322304, 352322305, 352322370, 406848256, 406848257, 406848259, 406848265,
+    411042564, 413139713, 415236865, 415236868, 417334017, 423625472, 423625473, 423625475, 423625481, 434111233, 444596992, 444596993, 444596995, 444597001, 446694145, 446694148,
+    446694152, 448791300, 452985601, 461374208, 461374209, 461374212, 461374220, 473957120, 473957121, 473957123, 473957129, 478151428, 480248577, 482345729, 482345732, 484442881,
+    490734336, 490734337, 490734339, 490734345, 501220097, 511705856, 511705857, 511705859, 511705865, 513803009, 513803012, 513803016, 515900164, 520094465, 528483072, 528483073,
+    528483076, 528483084, 541065984, 541065985, 541065987, 541065993, 543163136, 543163137, 543163139, 543163145, 574620416, 574620417, 576717568, 576717569, 696255232, 696255233,
+    698352384, 698352385, 725615367, 727712519, 738198279, 740295431, 754975489, 757072641, 759169800, 761266952, 803209991, 872416000, 872416001, 872416003, 872416009, 872416035,
+    874513152, 874513153, 874513155, 874513161, 874513187, 903873280, 903873281, 903873283, 903873289, 903873315, 905970432, 905970433, 905970435, 905970441, 905970467, 920650508,
+    1027605252, 1029702404, 1153434372, 1155531524, 1157628678, 1159725830, 1170211588, 1172308740, 1379926796, 1914700544, 1914700545, 1914700548, 1914700550, 1914700563, 1914700564, 1914700613,
+    1923089152, 1923089153, 1923089171, 1923089172, 1927283456, 1927283457, 1927283475, 1927283476, 1927283525, 1931477760, 1931477761, 1931477764, 1931477766, 1931477768, 1931477779, 1931477780,
+    1944060672, 1944060673, 1944060691, 1944060692, 1948254996, 1956643584, 1956643585, 1956643588, 1956643590, 1956643592, 1956643604, 1965032192, 1965032193, 1965032211, 1965032212, 1965032261,
+    1971323717, 1975518021, 1981809408, 1981809409, 1981809412, 1981809414, 1981809427, 1981809428, 1981809474, 1981809477, 1990198016, 1990198017, 1990198035, 1990198036, 1994392320, 1994392321,
+    1994392339, 1994392340, 1994392386, 1994392389, 1998586624, 1998586625, 1998586628, 1998586630, 1998586632, 1998586643, 1998586644, 1998586690, 2011169536, 2011169537, 2011169555, 2011169556,
+    2015363859, 2015363860, 2023752448, 2023752449, 2023752452, 2023752454, 2023752456, 2023752467, 2023752468, 2023752514, 2032141056, 2032141057, 2032141075, 2032141076, 2032141122, 2032141125,
+    2034238208, 2034238209, 2034238274, 2036335360, 2036335361, 2036335426, 2042626885, 2051015425, 2051015432, 2160067336, 2181038854, 2181038856, 2187330305, 2191524608, 2191524614, 2191524616,
+    2193621766, 2193621768, 2195718920, 2197816064, 2197816068, 2197816070, 2197816072, 2202010369, 2210398984, 2220884740, 2220884742, 2220884744, 2220884747, 2229273352, 2237661960, 2241856264,
+    2248147718, 2248147720, 2254439169, 2258633472, 2258633478, 2258633480, 2260730630, 2260730632, 2262827784, 2264924928, 2264924932, 2264924934, 2264924936, 2269119233, 2277507848, 2287993604,
+    2287993606, 2287993608, 2287993611, 2296382216, 2304770824, 2308965128, 2327839496, 2390754063, 2392851215, 2600469256, 2602566408, 2634023688, 2636120840, 3303016019, 3303016020, 3303016021,
+    3372222036, 3376416340, 3625977428, 3661629012, 3667920468, 4915726652, 4932503868, 4938795324, 5249173950, 5249173975, 6054480702, 6054480726, 6054480727, 6211767255, 6320819134, 6320819159,
+    6322916286, 6589254742, 6843010261, 6857690306, 6857690325, 6857690326, 6866078933, 7126125886, 7126125911, 7128223038, 7434407370, 7434407375, 7434407391, 7440698826, 8667533358, 14506007349,
+    14510201653, 14514395957, 14518590261, 14522784565, 14531173173, 14617156405, 14621350709, 14625545013, 14627642165, 14633933621, 16219374340, 16221471492, 16294871812, 16296968964, 16311649031, 16313746183,
+    16441672450, 16441672454, 16443769602, 16443769606, 16492004098, 16494101250, 16533947138, 16536044290, 16642999040, 16642999041, 16642999106, 16642999109, 16645096192, 16645096193, 16645096258, 16645096261,
+    16647193413, 16649290565, 16651387717, 16653484869, 16655582021, 16657679173, 16659776256, 16659776257, 16659776322, 16659776325, 16661873408, 16661873409, 16661873474, 16661873477, 16663970629, 16666067781,
+    16668164933, 16670262085, 16672359237, 16674456389, 16676553472, 16676553473, 16678650624, 16678650625, 16693330688, 16693330689, 16695427840, 16695427841, 16710107904, 16710107905, 16710107970, 16710107973,
+    16712205056, 16712205057, 16712205122, 16712205125, 16714302277, 16716399429, 16718496581, 16720593733, 16722690885, 16724788037, 16726885120, 16726885121, 16726885186, 16726885189, 16728982272, 16728982273,
+    16728982338, 16728982341, 16731079493, 16733176645, 16735273797, 16737370949, 16739468101, 16741565253, 16743662336, 16743662337, 16743662402, 16745759488, 16745759489, 16745759554, 16760439552, 16760439553,
+    16760439618, 16762536704, 16762536705, 16762536770, 16777216768, 16777216769, 16779313920, 16779313921, 16793993984, 16793993985, 16796091136, 16796091137, 16810771200, 16810771201, 16810771266, 16812868352,
+    16812868353, 16812868418, 16829645568, 16829645569, 16829645634, 16844325632, 16844325633, 16844325698, 16844325701, 16846422784, 16846422785, 16846422850, 16846422853, 16848520005, 16850617157, 16852714309,
+    16854811461, 16856908613, 16859005765, 16861102848, 16861102849, 16861102914, 16861102917, 16863200000, 16863200001, 16863200066, 16863200069, 16865297221, 16867394373, 16869491525, 16871588677, 16873685829,
+    16875782981, 16877880133, 16886268741, 16903045957, 17024680773, 17043555072, 17043555073, 17043555138, 17058235205, 17158898501, 17175675648, 17175675649, 17175675714, 18018730808, 18022925112, 18027119416,
+    18152948536, 18157142840, 18161337144, 18259903288, 18270389048, 18276680504, 18327012152, 18331206456, 18379440952, 18394121016, 18398315320, 18404606776, 18415092536, 18457035576, 18463327032, 18465424184,
+    18492687160, 18494784312, 18501075768, 18503172920, 18509464376, 18511561528, 18513658680, 18515755832, 18526241592, 18528338744, 18534630200, 18536727352, 18557698872, 18559796024, 18593350456, 18605933368,
+    18608030520, 18612224824, 18626904888, 18629002040, 18631099192, 18633196344, 25916616857, 25927102617, 25931296921, 25935491225, 25939685529, 25943879833, 25948074137, 25952268441, 25956462745, 25960657049,
+    25964851353, 25969045657, 25973239961, 25979531417, 25983725721, 25987920025, 26002600089, 26002600090, 26008891545, 26008891546, 26015183001, 26015183002, 26021474457, 26021474458, 26027765913, 26027765914,
+    26099069081, 26117943449, 26128429209, 26132623513, 26136817817, 26141012121, 26145206425, 26149400729, 26153595033, 26157789337, 26161983641, 26166177945, 26170372249, 26174566553, 26180858009, 26185052313,
+    26189246617, 26203926681, 26203926682, 26210218137, 26210218138, 26216509593, 26216509594, 26222801049, 26222801050, 26229092505, 26229092506, 26271035545, 26273132697, 26275229849, 26277327001, 26300395673,
+    146349822138, 146354016442, 146374987962, 146668589351, 146670686503, 147788469054, 147788469079, 148564415664, 148564415674, 148564415677, 149099189679, 149101286831, 150971947312,
+};
+
+const uint32_t unicode_composition_values[941] =
+{
+    8814, 8800, 8815, 192, 193, 194, 195, 256, 258, 550, 196, 7842, 197, 461, 512, 514,
+    7840, 7680, 260, 7682, 7684, 7686, 262, 264, 266, 268, 199, 7690, 270, 7692, 7696, 7698,
+    7694, 200, 201, 202, 7868, 274, 276, 278, 203, 7866, 282, 516, 518, 7864, 552, 280,
+    7704, 7706, 7710, 500, 284, 7712, 286, 288, 486, 290, 292, 7714, 7718, 542, 7716, 7720,
+    7722, 204, 205, 206, 296, 298, 300, 304, 207, 7880, 463, 520, 522, 7882, 302, 7724,
+    308, 7728, 488, 7730, 310, 7732, 313, 317, 7734, 315, 7740, 7738, 7742, 7744, 7746, 504,
+    323, 209, 7748, 327, 7750, 325, 7754, 7752, 210, 211, 212, 213, 332, 334, 558, 214,
+    7886, 336, 465, 524, 526, 416, 7884, 490, 7764, 7766, 340, 7768, 344, 528, 530, 7770,
+    342, 7774, 346, 348, 7776, 352, 7778, 536, 350, 7786, 356, 7788, 538, 354, 7792, 7790,
+    217, 218, 219, 360, 362, 364, 220, 7910, 366, 368, 467, 532, 534, 431, 7908, 7794,
+    370, 7798, 7796, 7804, 7806, 7808, 7810, 372, 7814, 7812, 7816, 7818, 7820, 7922, 221, 374,
+    7928, 562, 7822, 376, 7926, 7924, 377, 7824, 379, 381, 7826, 7828, 224, 225, 226, 227,
+    257, 259, 551, 228, 7843, 229, 462, 513, 515, 7841, 7681, 261, 7683, 7685, 7687, 263,
+    265, 267, 269, 231, 7691, 271, 7693, 7697, 7699, 7695, 232, 233, 234, 7869, 275, 277,
+    279, 235, 7867, 283, 517, 519, 7865, 553, 281, 7705, 7707, 7711, 501, 285, 7713, 287,
+    289, 487, 291, 293, 7715, 7719, 543, 7717, 7721, 7723, 7830, 236, 237, 238, 297, 299,
+    301, 239, 7881, 464, 521, 523, 7883, 303, 7725, 309, 496, 7729, 489, 7731, 311, 7733,
+    314, 318, 7735, 316, 7741, 7739, 7743, 7745, 7747, 505, 324, 241, 7749, 328, 7751, 326,
+    7755, 7753, 242, 243, 244, 245, 333, 335, 559, 246, 7887, 337, 466, 525, 527, 417,
+    7885, 491, 7765, 7767, 341, 7769, 345, 529, 531, 7771, 343, 7775, 347, 349, 7777, 353,
+    7779, 537, 351, 7787, 7831, 357, 7789, 539, 355, 7793, 7791, 249, 250, 251, 361, 363,
+    365, 252, 7911, 367, 369, 468, 533, 535, 432, 7909, 7795, 371, 7799, 7797, 7805, 7807,
+    7809, 7811, 373, 7815, 7813, 7832, 7817, 7819, 7821, 7923, 253, 375, 7929, 563, 7823, 255,
+    7927, 7833, 7925, 378, 7825, 380, 382, 7827, 7829, 8173, 901, 8129, 7846, 7844, 7850, 7848,
+    478, 506, 508, 482, 7688, 7872, 7870, 7876, 7874, 7726, 7890, 7888, 7894, 7892, 7756, 556,
+    7758, 554, 510, 475, 471, 469, 473, 7847, 7845, 7851, 7849, 479, 507, 509, 483, 7689,
+    7873, 7871, 7877, 7875, 7727, 7891, 7889, 7895, 7893, 7757, 557, 7759, 555, 511, 476, 472,
+    470, 474, 7856, 7854, 7860, 7858, 7857, 7855, 7861, 7859, 7700, 7702, 7701, 7703, 7760, 7762,
+    7761, 7763, 7780, 7781, 7782, 7783, 7800, 7801, 7802, 7803, 7835, 7900, 7898, 7904, 7902, 7906,
+    7901, 7899, 7905, 7903, 7907, 7914, 7912, 7918, 7916, 7920, 7915, 7913, 7919, 7917, 7921, 494,
+    492, 493, 480, 481, 7708, 7709, 560, 561, 495, 8122, 902, 8121, 8120, 7944, 7945, 8124,
+    8136, 904, 7960, 7961, 8138, 905, 7976, 7977, 8140, 8154, 906, 8153, 8152, 938, 7992, 7993,
+    8184, 908, 8008, 8009, 8172, 8170, 910, 8169, 8168, 939, 8025, 8186, 911, 8040, 8041, 8188,
+    8116, 8132, 8048, 940, 8113, 8112, 7936, 7937, 8118, 8115, 8050, 941, 7952, 7953, 8052, 942,
+    7968, 7969, 8134, 8131, 8054, 943, 8145, 8144, 970, 7984, 7985, 8150, 8056, 972, 8000, 8001,
+    8164, 8165, 8058, 973, 8161, 8160, 971, 8016, 8017, 8166, 8060, 974, 8032, 8033, 8182, 8179,
+    8146, 912, 8151, 8162, 944, 8167, 8180, 979, 980, 1031, 1232, 1234, 1027, 1024, 1238, 1025,
+    1217, 1244, 1246, 1037, 1250, 1049, 1252, 1036, 1254, 1262, 1038, 1264, 1266, 1268, 1272, 1260,
+    1233, 1235, 1107, 1104, 1239, 1105, 1218, 1245, 1247, 1117, 1251, 1081, 1253, 1116, 1255, 1263,
+    1118, 1265, 1267, 1269, 1273, 1261, 1111, 1142, 1143, 1242, 1243, 1258, 1259, 1570, 1571, 1573,
+    1572, 1574, 1730, 1747, 1728, 2345, 2353, 2356, 2507, 2508, 2891, 2888, 2892, 2964, 3018, 3020,
+    3019, 3144, 3264, 3274, 3271, 3272, 3275, 3402, 3404, 3403, 3546, 3548, 3550, 3549, 4134, 6918,
+    6920, 6922, 6924, 6926, 6930, 6971, 6973, 6976, 6977, 6979, 7736, 7737, 7772, 7773, 7784, 7785,
+    7852, 7862, 7853, 7863, 7878, 7879, 7896, 7897, 7938, 7940, 7942, 8064, 7939, 7941, 7943, 8065,
+    8066, 8067, 8068, 8069, 8070, 8071, 7946, 7948, 7950, 8072, 7947, 7949, 7951, 8073, 8074, 8075,
+    8076, 8077, 8078, 8079, 7954, 7956, 7955, 7957, 7962, 7964, 7963, 7965, 7970, 7972, 7974, 8080,
+    7971, 7973, 7975, 8081, 8082, 8083, 8084, 8085, 8086, 8087, 7978, 7980, 7982, 8088, 7979, 7981,
+    7983, 8089, 8090, 8091, 8092, 8093, 8094, 8095, 7986, 7988, 7990, 7987, 7989, 7991, 7994, 7996,
+    7998, 7995, 7997, 7999, 8002, 8004, 8003, 8005, 8010, 8012, 8011, 8013, 8018, 8020, 8022, 8019,
+    8021, 8023, 8027, 8029, 8031, 8034, 8036, 8038, 8096, 8035, 8037, 8039, 8097, 8098, 8099, 8100,
+    8101, 8102, 8103, 8042, 8044, 8046, 8104, 8043, 8045, 8047, 8105, 8106, 8107, 8108, 8109, 8110,
+    8111, 8114, 8130, 8178, 8119, 8141, 8142, 8143, 8135, 8183, 8157, 8158, 8159, 8602, 8603, 8622,
+    8653, 8655, 8654, 8708, 8713, 8716, 8740, 8742, 8769, 8772, 8775, 8777, 8813, 8802, 8816, 8817,
+    8820, 8821, 8824, 8825, 8832, 8833, 8928, 8929, 8836, 8837, 8840, 8841, 8930, 8931, 8876, 8877,
+    8878, 8879, 8938, 8939, 8940, 8941, 12436, 12364, 12366, 12368, 12370, 12372, 12374, 12376, 12378, 12380,
+    12382, 12384, 12386, 12389, 12391, 12393, 12400, 12401, 12403, 12404, 12406, 12407, 12409, 12410, 12412, 12413,
+    12446, 12532, 12460, 12462, 12464, 12466, 12468, 12470, 12472, 12474, 12476, 12478, 12480, 12482, 12485, 12487,
+    12489, 12496, 12497, 12499, 12500, 12502, 12503, 12505, 12506, 12508, 12509, 12535, 12536, 12537, 12538, 12542,
+    69786, 69788, 69803, 69934, 69935, 70475, 70476, 70844, 70843, 70846, 71098, 71099, 71992,
+};
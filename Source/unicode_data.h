@@ -0,0 +1,143 @@
+// Generated by Tools/generate_unicode_data.py from the Unicode Character
+// Database 14.0.0. Don't edit this by hand.
+
+#ifndef UNICODE_DATA_H_
+#define UNICODE_DATA_H_
+
+#include <stdint.h>
+
+#define UNICODE_EXTENDED_PICTOGRAPHIC 0x80
+
+typedef enum GraphemeBreak
+{
+    GRAPHEME_BREAK_OTHER,
+    GRAPHEME_BREAK_CR,
+    GRAPHEME_BREAK_LF,
+    GRAPHEME_BREAK_CONTROL,
+    GRAPHEME_BREAK_EXTEND,
+    GRAPHEME_BREAK_ZWJ,
+    GRAPHEME_BREAK_REGIONAL_INDICATOR,
+    GRAPHEME_BREAK_PREPEND,
+    GRAPHEME_BREAK_SPACING_MARK,
+    GRAPHEME_BREAK_L,
+    GRAPHEME_BREAK_V,
+    GRAPHEME_BREAK_T,
+    GRAPHEME_BREAK_LV,
+    GRAPHEME_BREAK_LVT,
+} GraphemeBreak;
+
+typedef enum WordBreak
+{
+    WORD_BREAK_OTHER,
+    WORD_BREAK_CR,
+    WORD_BREAK_LF,
+    WORD_BREAK_NEWLINE,
+    WORD_BREAK_EXTEND,
+    WORD_BREAK_ZWJ,
+    WORD_BREAK_REGIONAL_INDICATOR,
+    WORD_BREAK_FORMAT,
+    WORD_BREAK_KATAKANA,
+    WORD_BREAK_HEBREW_LETTER,
+    WORD_BREAK_ALETTER,
+    WORD_BREAK_SINGLE_QUOTE,
+    WORD_BREAK_DOUBLE_QUOTE,
+    WORD_BREAK_MID_NUM_LET,
+    WORD_BREAK_MID_LETTER,
+    WORD_BREAK_MID_NUM,
+    WORD_BREAK_NUMERIC,
+    WORD_BREAK_EXTEND_NUM_LET,
+    WORD_BREAK_WSEG_SPACE,
+} WordBreak;
+
+extern const uint8_t unicode_case_fold_stage1[1088];
+extern const uint8_t unicode_case_fold_stage2[1088];
+extern const uint8_t unicode_case_fold_stage3[1376];
+
+static inline uint8_t unicode_case_fold_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_case_fold_stage1[codepoint >> 10];
+    uint32_t middle = (codepoint >> 4) & 0x3f;
+    uint32_t index = unicode_case_fold_stage2[(block << 6) + middle];
+    return unicode_case_fold_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const uint8_t unicode_class_stage1[2176];
+extern const uint16_t unicode_class_stage2[3136];
+extern const uint8_t unicode_class_stage3[10944];
+
+static inline uint8_t unicode_class_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_class_stage1[codepoint >> 9];
+    uint32_t middle = (codepoint >> 4) & 0x1f;
+    uint32_t index = unicode_class_stage2[(block << 5) + middle];
+    return unicode_class_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const uint8_t unicode_combining_class_stage1[1088];
+extern const uint8_t unicode_combining_class_stage2[1856];
+extern const uint8_t unicode_combining_class_stage3[2176];
+
+static inline uint8_t unicode_combining_class_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_combining_class_stage1[codepoint >> 10];
+    uint32_t middle = (codepoint >> 4) & 0x3f;
+    uint32_t index = unicode_combining_class_stage2[(block << 6) + middle];
+    return unicode_combining_class_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const uint8_t unicode_decomposition_stage1[1088];
+extern const uint8_t unicode_decomposition_stage2[1088];
+extern const uint16_t unicode_decomposition_stage3[3312];
+
+static inline uint16_t unicode_decomposition_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_decomposition_stage1[codepoint >> 10];
+    uint32_t middle = (codepoint >> 4) & 0x3f;
+    uint32_t index = unicode_decomposition_stage2[(block << 6) + middle];
+    return unicode_decomposition_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const uint8_t unicode_quick_check_stage1[1088];
+extern const uint8_t unicode_quick_check_stage2[1216];
+extern const uint8_t unicode_quick_check_stage3[1968];
+
+static inline uint8_t unicode_quick_check_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_quick_check_stage1[codepoint >> 10];
+    uint32_t middle = (codepoint >> 4) & 0x3f;
+    uint32_t index = unicode_quick_check_stage2[(block << 6) + middle];
+    return unicode_quick_check_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const uint8_t unicode_grapheme_break_stage1[2176];
+extern const uint16_t unicode_grapheme_break_stage2[2272];
+extern const uint8_t unicode_grapheme_break_stage3[4224];
+
+static inline uint8_t unicode_grapheme_break_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_grapheme_break_stage1[codepoint >> 9];
+    uint32_t middle = (codepoint >> 4) & 0x1f;
+    uint32_t index = unicode_grapheme_break_stage2[(block << 5) + middle];
+    return unicode_grapheme_break_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const uint8_t unicode_word_break_stage1[2176];
+extern const uint16_t unicode_word_break_stage2[2656];
+extern const uint8_t unicode_word_break_stage3[6640];
+
+static inline uint8_t unicode_word_break_lookup(uint32_t codepoint)
+{
+    uint32_t block = unicode_word_break_stage1[codepoint >> 9];
+    uint32_t middle = (codepoint >> 4) & 0x1f;
+    uint32_t index = unicode_word_break_stage2[(block << 5) + middle];
+    return unicode_word_break_stage3[(index << 4) + (codepoint & 0xf)];
+}
+
+extern const int32_t unicode_case_fold_deltas[201];
+extern const uint8_t unicode_case_fold_sequence_indices[201];
+extern const uint32_t unicode_case_fold_sequences[315];
+extern const uint32_t unicode_decomposition_sequences[5468];
+extern const uint64_t unicode_composition_keys[941];
+extern const uint32_t unicode_composition_values[941];
+
+#endif // UNICODE_DATA_H_
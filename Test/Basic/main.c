@@ -1,5 +1,80 @@
 #include "../Utility/test.h"
 
+#include <limits.h>
+#include <stddef.h>
+
+
+static int compare_slices(AftStringSlice a, AftStringSlice b, bool ignore_case)
+{
+    int min_count = (a.count < b.count) ? a.count : b.count;
+
+    for(int char_index = 0; char_index < min_count; char_index += 1)
+    {
+        uint8_t c0 = (uint8_t) a.contents[char_index];
+        uint8_t c1 = (uint8_t) b.contents[char_index];
+
+        if(ignore_case)
+        {
+            c0 = (uint8_t) aft_ascii_to_uppercase_char((char) c0);
+            c1 = (uint8_t) aft_ascii_to_uppercase_char((char) c1);
+        }
+
+        if(c0 != c1)
+        {
+            return c0 - c1;
+        }
+    }
+
+    return a.count - b.count;
+}
+
+static AftStringSlice* make_random_words(Test* test, int count, char** buffer)
+{
+    const char* alphabet = "aAbBc\x01\x80\xff";
+    const int word_cap = 24;
+
+    *buffer = aft_allocate(&test->allocator, (uint64_t) count * word_cap).memory;
+    AftStringSlice* slices = aft_allocate(&test->allocator, sizeof(AftStringSlice) * (uint64_t) count).memory;
+    ASSERT(*buffer);
+    ASSERT(slices);
+
+    for(int word_index = 0; word_index < count; word_index += 1)
+    {
+        char* word = &(*buffer)[word_cap * word_index];
+        int word_count = random_int_range(&test->generator, 0, word_cap);
+
+        for(int char_index = 0; char_index < word_count; char_index += 1)
+        {
+            word[char_index] = alphabet[random_int_range(&test->generator, 0, 7)];
+        }
+
+        slices[word_index] = aft_string_slice_from_buffer(word, word_count);
+    }
+
+    return slices;
+}
+
+static void destroy_random_words(Test* test, AftStringSlice* slices, int count, char* buffer)
+{
+    AftMemoryBlock buffer_block = {buffer, (uint64_t) count * 24};
+    AftMemoryBlock slices_block = {slices, sizeof(AftStringSlice) * (uint64_t) count};
+    aft_deallocate(&test->allocator, buffer_block);
+    aft_deallocate(&test->allocator, slices_block);
+}
+
+static bool slices_sorted(const AftStringSlice* slices, int count, bool ignore_case)
+{
+    for(int slice_index = 1; slice_index < count; slice_index += 1)
+    {
+        if(compare_slices(slices[slice_index - 1], slices[slice_index], ignore_case) > 0)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 
 static bool fuzz_assign(Test* test)
 {
@@ -266,6 +341,83 @@ static bool test_append_char(Test* test)
     return result;
 }
 
+static bool test_append_many(Test* test)
+{
+    const char* a = u8"a猫🍌";
+    AftMaybeString base = aft_string_copy_c_string_with_allocator(a, &test->allocator);
+    ASSERT(base.valid);
+
+    AftStringSlice slices[4] =
+    {
+        aft_string_slice_from_c_string(" and "),
+        aft_string_slice_from_string(&base.value),
+        aft_string_slice_from_c_string(u8" is more than sixteen bytes 👌🏼"),
+        aft_string_slice_from_buffer(NULL, 0),
+    };
+
+    bool appended = aft_string_append_many(&base.value, slices, 4);
+    ASSERT(appended);
+
+    const char* combined = aft_string_get_contents_const(&base.value);
+    bool contents_match = strings_match(combined, u8"a猫🍌 and a猫🍌 is more than sixteen bytes 👌🏼");
+    bool size_correct = aft_string_get_count(&base.value) == string_size(combined);
+    bool result = contents_match && size_correct;
+
+    aft_string_destroy(&base.value);
+
+    return result;
+}
+
+// The slices claim far more bytes than they have, but nothing should be read
+// once the total is known to be too big.
+static bool test_append_many_overflow(Test* test)
+{
+    AftMaybeString base = aft_string_copy_c_string_with_allocator("abcd", &test->allocator);
+    ASSERT(base.valid);
+
+    const char* huge = "huge";
+    AftStringSlice slices[2] =
+    {
+        aft_string_slice_from_buffer(huge, INT_MAX - 8),
+        aft_string_slice_from_buffer(huge, 8),
+    };
+
+    bool result = !aft_string_append_many(&base.value, slices, 2)
+            && aft_string_get_count(&base.value) == 4
+            && strings_match(aft_string_get_contents_const(&base.value), "abcd");
+
+    aft_string_destroy(&base.value);
+
+    return result;
+}
+
+static bool test_append_repeated(Test* test)
+{
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool result = aft_string_append_repeated(&string, aft_string_slice_from_c_string("ab"), 3)
+            && strings_match(aft_string_get_contents_const(&string), "ababab")
+            && aft_string_append_repeated(&string, aft_string_slice_from_c_string("x"), 0)
+            && aft_string_get_count(&string) == 6;
+
+    // Repeat part of the string itself, enough to need a bigger buffer.
+    result = result
+            && aft_string_append_repeated(&string, aft_string_slice_string(&string, 1, 4), 50)
+            && aft_string_get_count(&string) == 156;
+
+    const char* contents = aft_string_get_contents_const(&string);
+
+    for(int index = 6; result && index < 156; index += 1)
+    {
+        result = contents[index] == ((index % 3 == 1) ? 'a' : 'b');
+    }
+
+    aft_string_destroy(&string);
+
+    return result;
+}
+
 static bool test_assign(Test* test)
 {
     const char* reference = u8"a猫🍌";
@@ -333,6 +485,140 @@ static bool test_assign_nothing(Test* test)
     return result;
 }
 
+static bool test_code_page_latin_1(Test* test)
+{
+    AftString encoded;
+    aft_string_initialise_with_allocator(&encoded, &test->allocator);
+
+    AftString expected;
+    aft_string_initialise_with_allocator(&expected, &test->allocator);
+
+    AftString utf8;
+    aft_string_initialise_with_allocator(&utf8, &test->allocator);
+
+    AftString round_trip;
+    aft_string_initialise_with_allocator(&round_trip, &test->allocator);
+
+    // Every byte, with runs of ASCII long enough for the block paths.
+    bool result = true;
+
+    for(int byte = 0; result && byte < 256; byte += 1)
+    {
+        result = aft_string_append_char(&encoded, (char) byte)
+                && aft_utf8_append_codepoint(&expected, (char32_t) byte);
+
+        for(int ascii_index = byte % 40; result && ascii_index > 0; ascii_index -= 1)
+        {
+            result = aft_string_append_char(&encoded, 'a')
+                    && aft_string_append_char(&expected, 'a');
+        }
+    }
+
+    result = result
+            && aft_string_append_c_string(&utf8, "Prefix ")
+            && aft_utf8_append_code_page(&utf8, aft_string_slice_from_string(&encoded), AFT_CODE_PAGE_LATIN_1)
+            && aft_string_slice_matches(aft_string_slice_string(&utf8, 7, aft_string_get_count(&utf8)), aft_string_slice_from_string(&expected))
+            && aft_code_page_append_utf8(&round_trip, aft_string_slice_from_string(&expected), AFT_CODE_PAGE_LATIN_1, AFT_CONVERSION_STRICT)
+            && aft_string_slice_matches(aft_string_slice_from_string(&round_trip), aft_string_slice_from_string(&encoded));
+
+    aft_string_destroy(&encoded);
+    aft_string_destroy(&expected);
+    aft_string_destroy(&utf8);
+    aft_string_destroy(&round_trip);
+
+    return result;
+}
+
+static bool test_code_page_unmappable(Test* test)
+{
+    AftString encoded;
+    aft_string_initialise_with_allocator(&encoded, &test->allocator);
+
+    AftStringSlice euro = aft_string_slice_from_c_string(u8"5 € and 6 £");
+    AftStringSlice invalid = aft_string_slice_from_c_string("caf\xc3");
+
+    bool result = aft_string_append_c_string(&encoded, "Prices: ")
+            && !aft_code_page_append_utf8(&encoded, euro, AFT_CODE_PAGE_LATIN_1, AFT_CONVERSION_STRICT)
+            && aft_string_slice_matches(aft_string_slice_from_string(&encoded), aft_string_slice_from_c_string("Prices: "))
+            && !aft_code_page_append_utf8(&encoded, invalid, AFT_CODE_PAGE_LATIN_1, AFT_CONVERSION_LOSSY)
+            && aft_string_slice_matches(aft_string_slice_from_string(&encoded), aft_string_slice_from_c_string("Prices: "))
+            && aft_code_page_append_utf8(&encoded, euro, AFT_CODE_PAGE_LATIN_1, AFT_CONVERSION_LOSSY)
+            && aft_string_slice_matches(aft_string_slice_from_string(&encoded), aft_string_slice_from_c_string("Prices: 5 ? and 6 \xa3"));
+
+    aft_string_destroy(&encoded);
+
+    return result;
+}
+
+static bool test_code_page_windows_1252(Test* test)
+{
+    AftString utf8;
+    aft_string_initialise_with_allocator(&utf8, &test->allocator);
+
+    AftString encoded;
+    aft_string_initialise_with_allocator(&encoded, &test->allocator);
+
+    const char* reference = "\x93" "Caf\xe9 au lait costs \x80" "3,\x94 she said\x85 \x81\x9f";
+    const char* expected = u8"“Café au lait costs €3,” she said… \xc2\x81" u8"Ÿ";
+
+    bool result = aft_utf8_append_code_page(&utf8, aft_string_slice_from_c_string(reference), AFT_CODE_PAGE_WINDOWS_1252)
+            && aft_string_slice_matches(aft_string_slice_from_string(&utf8), aft_string_slice_from_c_string(expected))
+            && aft_code_page_append_utf8(&encoded, aft_string_slice_from_string(&utf8), AFT_CODE_PAGE_WINDOWS_1252, AFT_CONVERSION_STRICT)
+            && aft_string_slice_matches(aft_string_slice_from_string(&encoded), aft_string_slice_from_c_string(reference));
+
+    aft_string_destroy(&utf8);
+    aft_string_destroy(&encoded);
+
+    return result;
+}
+
+static bool test_codepoint_index(Test* test)
+{
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool result = true;
+
+    for(int word_index = 0; word_index < 100; word_index += 1)
+    {
+        result = result && aft_string_append_c_string(&string, u8"a猫é🍌");
+    }
+
+    AftStringSlice slice = aft_string_slice_from_string(&string);
+
+    AftCodepointIndex index;
+    result = result && aft_codepoint_index_initialise_with_allocator(&index, slice, &test->allocator);
+    result = result && aft_codepoint_index_get_codepoint_count(&index) == 400;
+
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, slice);
+
+    for(int codepoint_index = 0; result; codepoint_index += 1)
+    {
+        int byte_index = aft_codepoint_iterator_get_index(&it);
+        result = aft_codepoint_index_find_byte(&index, codepoint_index) == byte_index
+                && aft_codepoint_index_find_codepoint(&index, byte_index) == codepoint_index;
+
+        if(!aft_codepoint_iterator_next(&it).valid)
+        {
+            result = result && codepoint_index == 400;
+            break;
+        }
+
+        // Bytes partway through a codepoint belong to it.
+        int next_byte_index = aft_codepoint_iterator_get_index(&it);
+        for(int inside = byte_index + 1; result && inside < next_byte_index; inside += 1)
+        {
+            result = aft_codepoint_index_find_codepoint(&index, inside) == codepoint_index;
+        }
+    }
+
+    aft_codepoint_index_destroy(&index);
+    aft_string_destroy(&string);
+
+    return result;
+}
+
 static bool test_copy(Test* test)
 {
     const char* reference = u8"a猫🍌";
@@ -383,6 +669,35 @@ static bool test_copy_c_string_empty(Test* test)
     return result;
 }
 
+static bool test_copy_c_string_full_small(Test* test)
+{
+    // The largest string that still fits without an allocation.
+    char reference[AFT_STRING_SMALL_CAP];
+    for(int index = 0; index < (int) AFT_STRING_SMALL_CAP - 1; index += 1)
+    {
+        reference[index] = (char) ('a' + index);
+    }
+    reference[AFT_STRING_SMALL_CAP - 1] = '\0';
+
+    AftMaybeString string = aft_string_copy_c_string_with_allocator(reference, &test->allocator);
+
+    AftString appended;
+    aft_string_initialise_with_allocator(&appended, &test->allocator);
+    bool appended_valid = aft_string_append_c_string(&appended, reference);
+
+    bool result = string.valid
+            && appended_valid
+            && aft_string_get_count(&string.value) == (int) AFT_STRING_SMALL_CAP - 1
+            && aft_string_get_count(&appended) == (int) AFT_STRING_SMALL_CAP - 1
+            && strings_match(aft_string_get_contents_const(&string.value), reference)
+            && strings_match(aft_string_get_contents_const(&appended), reference);
+
+    aft_string_destroy(&string.value);
+    aft_string_destroy(&appended);
+
+    return result;
+}
+
 static bool test_destroy(Test* test)
 {
     const char* reference = "Moist";
@@ -613,6 +928,111 @@ static bool test_get_contents_const(Test* test)
     return result;
 }
 
+static bool test_handle_array_from_strings(Test* test)
+{
+    const char* references[3] = {"", u8"猫", u8"a猫🍌 and more words"};
+    AftString strings[3];
+
+    for(int string_index = 0; string_index < 3; string_index += 1)
+    {
+        AftMaybeString string = aft_string_copy_c_string_with_allocator(references[string_index], &test->allocator);
+        ASSERT(string.valid);
+        strings[string_index] = string.value;
+    }
+
+    AftStringHandle handles[3];
+    aft_string_handle_array_from_strings(handles, strings, 3);
+
+    bool result = true;
+
+    for(int string_index = 0; string_index < 3; string_index += 1)
+    {
+        AftStringSlice slice = aft_string_handle_get_slice(handles[string_index]);
+        AftStringSlice reference = aft_string_slice_from_c_string(references[string_index]);
+        result = result && aft_string_slice_matches(slice, reference);
+    }
+
+    for(int string_index = 0; string_index < 3; string_index += 1)
+    {
+        aft_string_destroy(&strings[string_index]);
+    }
+
+    return result;
+}
+
+static bool test_handle_compare(Test* test)
+{
+    const char* ordered[7] =
+    {
+        "",
+        "a",
+        "abc",
+        "abcd",
+        "abcde",
+        "abcdf",
+        u8"ab猫",
+    };
+
+    bool result = true;
+
+    for(int a_index = 0; a_index < 7; a_index += 1)
+    {
+        for(int b_index = 0; b_index < 7; b_index += 1)
+        {
+            AftStringHandle a = aft_string_handle_from_slice(aft_string_slice_from_c_string(ordered[a_index]));
+            AftStringHandle b = aft_string_handle_from_slice(aft_string_slice_from_c_string(ordered[b_index]));
+            int compare = aft_string_handle_compare(a, b);
+            int expected = (a_index > b_index) - (a_index < b_index);
+            result = result && compare == expected;
+        }
+    }
+
+    return result;
+}
+
+static bool test_handle_hash(Test* test)
+{
+    const char* a = "shared prefix, then a long tail";
+    const char* b = "shared prefix, then a long tale";
+    AftMaybeString copy = aft_string_copy_c_string_with_allocator(a, &test->allocator);
+    ASSERT(copy.valid);
+
+    AftStringHandle original = aft_string_handle_from_slice(aft_string_slice_from_c_string(a));
+    AftStringHandle copied = aft_string_handle_from_string(&copy.value);
+    AftStringHandle other = aft_string_handle_from_slice(aft_string_slice_from_c_string(b));
+
+    bool result = aft_string_handle_hash(original) == aft_string_handle_hash(copied)
+            && aft_string_handle_hash(original) != aft_string_handle_hash(other);
+
+    aft_string_destroy(&copy.value);
+
+    return result;
+}
+
+static bool test_handle_matches(Test* test)
+{
+    AftMaybeString garble = make_random_string(&test->generator, &test->allocator);
+    ASSERT(garble.valid);
+
+    AftMaybeString copy = aft_string_copy_with_allocator(&garble.value, &test->allocator);
+    ASSERT(copy.valid);
+
+    AftStringHandle a = aft_string_handle_from_string(&garble.value);
+    AftStringHandle b = aft_string_handle_from_string(&copy.value);
+    AftStringSlice slice = aft_string_slice_from_string(&garble.value);
+    AftStringHandle shorter = aft_string_handle_from_slice(aft_string_slice(slice, 0, slice.count - 1));
+
+    bool result = aft_string_handle_matches(a, b)
+            && aft_string_handle_compare(a, b) == 0
+            && !aft_string_handle_matches(a, shorter)
+            && aft_string_handle_compare(shorter, a) < 0;
+
+    aft_string_destroy(&garble.value);
+    aft_string_destroy(&copy.value);
+
+    return result;
+}
+
 static bool test_initialise(Test* test)
 {
     AftString string;
@@ -645,6 +1065,56 @@ static bool test_iterator_next(Test* test)
     return result;
 }
 
+static bool test_iterator_next_batch(Test* test)
+{
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool result = true;
+
+    for(int run_index = 0; run_index < 20; run_index += 1)
+    {
+        result = result
+                && aft_string_append_c_string(&string, "The quick brown fox jumps over ")
+                && aft_string_append_c_string(&string, u8"Бума́га всё сте́рпит 🍌 ");
+    }
+
+    AftStringSlice slice = aft_string_slice_from_string(&string);
+
+    AftCodepointIterator reference;
+    aft_codepoint_iterator_set_string(&reference, slice);
+
+    AftCodepointIterator it;
+    aft_codepoint_iterator_set_string(&it, slice);
+
+    char32_t codepoints[40];
+
+    for(int batch_index = 0; result; batch_index += 1)
+    {
+        int max = 1 + (batch_index % 40);
+        int count = aft_codepoint_iterator_next_batch(&it, codepoints, max);
+
+        for(int codepoint_index = 0; result && codepoint_index < count; codepoint_index += 1)
+        {
+            AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&reference);
+            result = codepoint.valid && codepoint.value == codepoints[codepoint_index];
+        }
+
+        result = result
+                && aft_codepoint_iterator_get_index(&it) == aft_codepoint_iterator_get_index(&reference);
+
+        if(count < max)
+        {
+            result = result && !aft_codepoint_iterator_next(&reference).valid;
+            break;
+        }
+    }
+
+    aft_string_destroy(&string);
+
+    return result;
+}
+
 static bool test_iterator_prior(Test* test)
 {
     const char* reference = u8"Бума́га всё сте́рпит.";
@@ -691,6 +1161,170 @@ static bool test_iterator_set_string(Test* test)
     return result;
 }
 
+static bool test_append_repeated_overflow(Test* test)
+{
+    AftMaybeString string = aft_string_copy_c_string_with_allocator("abcd", &test->allocator);
+    ASSERT(string.valid);
+
+    bool result = !aft_string_append_repeated(&string.value, aft_string_slice_from_c_string("abcd"), 1 << 30)
+            && aft_string_get_count(&string.value) == 4
+            && strings_match(aft_string_get_contents_const(&string.value), "abcd");
+
+    aft_string_destroy(&string.value);
+
+    return result;
+}
+
+static bool test_join(Test* test)
+{
+    AftStringSlice slices[3] =
+    {
+        aft_string_slice_from_c_string("one"),
+        aft_string_slice_from_c_string(""),
+        aft_string_slice_from_c_string(u8"三"),
+    };
+
+    AftMaybeString joined = aft_string_join_with_allocator(aft_string_slice_from_c_string(", "), slices, 3, &test->allocator);
+    ASSERT(joined.valid);
+
+    const char* contents = aft_string_get_contents_const(&joined.value);
+    bool result = strings_match(contents, u8"one, , 三")
+            && aft_string_get_count(&joined.value) == string_size(contents);
+
+    aft_string_destroy(&joined.value);
+
+    return result;
+}
+
+static bool test_join_nothing(Test* test)
+{
+    AftMaybeString joined = aft_string_join_with_allocator(aft_string_slice_from_c_string(", "), NULL, 0, &test->allocator);
+    ASSERT(joined.valid);
+
+    bool result = aft_string_get_count(&joined.value) == 0
+            && strings_match(aft_string_get_contents_const(&joined.value), "");
+
+    aft_string_destroy(&joined.value);
+
+    return result;
+}
+
+static bool test_join_overflow(Test* test)
+{
+    const char* huge = "huge";
+    AftStringSlice slices[3] =
+    {
+        aft_string_slice_from_c_string("a"),
+        aft_string_slice_from_c_string("b"),
+        aft_string_slice_from_c_string("c"),
+    };
+
+    AftMaybeString joined = aft_string_join_with_allocator(aft_string_slice_from_buffer(huge, INT_MAX / 2 + 1), slices, 3, &test->allocator);
+    bool result = !joined.valid;
+    aft_string_destroy(&joined.value);
+
+    slices[1] = aft_string_slice_from_buffer(huge, INT_MAX - 1);
+    joined = aft_string_join_with_allocator(aft_string_slice_from_c_string(", "), slices, 3, &test->allocator);
+    result = result && !joined.valid;
+    aft_string_destroy(&joined.value);
+
+    return result;
+}
+
+static bool test_line_index(Test* test)
+{
+    AftStringSlice text = aft_string_slice_from_c_string("one\ntwo\r\nthree\rfour\n");
+    const char* lines[5] = {"one", "two", "three", "four", ""};
+
+    AftLineIndex index;
+    aft_line_index_initialise_with_allocator(&index, &test->allocator);
+
+    bool result = aft_line_index_update(&index, text)
+            && aft_line_index_get_line_count(&index) == 5;
+
+    for(int line_index = 0; result && line_index < 5; line_index += 1)
+    {
+        AftStringSlice line = aft_line_index_get_line(&index, text, line_index);
+        AftStringSlice reference = aft_string_slice_from_c_string(lines[line_index]);
+        result = aft_string_slice_matches(line, reference);
+    }
+
+    AftTextPosition position = aft_line_index_find_position(&index, 11);
+    result = result && position.line == 2 && position.column == 2;
+
+    position = aft_line_index_find_position(&index, 7);
+    result = result && position.line == 1 && position.column == 3;
+
+    position = aft_line_index_find_position(&index, 0);
+    result = result && position.line == 0 && position.column == 0;
+
+    aft_line_index_destroy(&index);
+
+    return result;
+}
+
+static bool test_line_index_update(Test* test)
+{
+    AftString text;
+    aft_string_initialise_with_allocator(&text, &test->allocator);
+
+    AftLineIndex index;
+    aft_line_index_initialise_with_allocator(&index, &test->allocator);
+
+    bool result = true;
+
+    // The carriage return and line feed of each pair land in separate
+    // updates, and there are enough lines to grow the index a few times.
+    for(int line_index = 0; line_index < 100; line_index += 1)
+    {
+        result = result
+                && aft_string_append_c_string(&text, "line\r")
+                && aft_line_index_update(&index, aft_string_slice_from_string(&text))
+                && aft_string_append_char(&text, '\n')
+                && aft_line_index_update(&index, aft_string_slice_from_string(&text));
+    }
+
+    AftStringSlice slice = aft_string_slice_from_string(&text);
+    AftStringSlice reference = aft_string_slice_from_c_string("line");
+
+    result = result && aft_line_index_get_line_count(&index) == 101;
+
+    for(int line_index = 0; result && line_index < 100; line_index += 1)
+    {
+        AftStringSlice line = aft_line_index_get_line(&index, slice, line_index);
+        result = aft_string_slice_matches(line, reference)
+                && aft_line_index_get_line_start(&index, line_index) == 6 * line_index;
+    }
+
+    AftTextPosition position = aft_line_index_find_position(&index, 6 * 57 + 3);
+    result = result && position.line == 57 && position.column == 3;
+
+    aft_line_index_destroy(&index);
+    aft_string_destroy(&text);
+
+    return result;
+}
+
+static bool test_line_iterator(Test* test)
+{
+    AftStringSlice slice = aft_string_slice_from_c_string("one\ntwo\r\n\rfour\n");
+    const char* lines[4] = {"one", "two", "", "four"};
+
+    AftLineIterator it;
+    aft_line_iterator_set_string(&it, slice);
+
+    bool result = true;
+
+    for(int line_index = 0; line_index < 4; line_index += 1)
+    {
+        AftMaybeStringSlice line = aft_line_iterator_next(&it);
+        AftStringSlice reference = aft_string_slice_from_c_string(lines[line_index]);
+        result = result && line.valid && aft_string_slice_matches(line.value, reference);
+    }
+
+    return result && !aft_line_iterator_next(&it).valid;
+}
+
 static bool test_remove_end(Test* test)
 {
     const char* reference = "9876543210";
@@ -905,6 +1539,199 @@ static bool test_reserve(Test* test)
     return result;
 }
 
+static bool test_sort(Test* test)
+{
+    const char* unsorted[6] = {u8"猫", "banana", "", "apple pie and cream", "apple", "Banana"};
+    const char* sorted[6] = {"", "Banana", "apple", "apple pie and cream", "banana", u8"猫"};
+    AftString strings[6];
+
+    for(int string_index = 0; string_index < 6; string_index += 1)
+    {
+        AftMaybeString string = aft_string_copy_c_string_with_allocator(unsorted[string_index], &test->allocator);
+        ASSERT(string.valid);
+        strings[string_index] = string.value;
+    }
+
+    AftStringSortOptions options = {.order = AFT_STRING_SORT_ORDER_BYTE};
+    bool result = aft_string_sort_with_allocator(strings, 6, &options, &test->allocator);
+
+    for(int string_index = 0; string_index < 6; string_index += 1)
+    {
+        const char* contents = aft_string_get_contents_const(&strings[string_index]);
+        result = result && strings_match(contents, sorted[string_index]);
+        aft_string_destroy(&strings[string_index]);
+    }
+
+    return result;
+}
+
+static bool test_sort_slices(Test* test)
+{
+    const int count = 2000;
+    char* buffer;
+    AftStringSlice* slices = make_random_words(test, count, &buffer);
+
+    AftStringSortOptions options = {.order = AFT_STRING_SORT_ORDER_BYTE};
+    bool sorted = aft_string_slice_sort_with_allocator(slices, count, &options, &test->allocator);
+    bool result = sorted && slices_sorted(slices, count, false);
+
+    destroy_random_words(test, slices, count, buffer);
+
+    return result;
+}
+
+static bool test_sort_slices_ignore_case(Test* test)
+{
+    const int count = 2000;
+    char* buffer;
+    AftStringSlice* slices = make_random_words(test, count, &buffer);
+
+    AftStringSortOptions options = {.order = AFT_STRING_SORT_ORDER_ASCII_CASE_INSENSITIVE};
+    bool sorted = aft_string_slice_sort_with_allocator(slices, count, &options, &test->allocator);
+    bool result = sorted && slices_sorted(slices, count, true);
+
+    destroy_random_words(test, slices, count, buffer);
+
+    return result;
+}
+
+static bool test_sort_slices_parallel(Test* test)
+{
+    const int count = 100000;
+    char* buffer;
+    AftStringSlice* slices = make_random_words(test, count, &buffer);
+
+    AftStringSortOptions options =
+    {
+        .order = AFT_STRING_SORT_ORDER_BYTE,
+        .thread_count = 4,
+    };
+    bool sorted = aft_string_slice_sort_with_allocator(slices, count, &options, &test->allocator);
+    bool result = sorted && slices_sorted(slices, count, false);
+
+    destroy_random_words(test, slices, count, buffer);
+
+    return result;
+}
+
+static bool test_split_byte(Test* test)
+{
+    AftStringSlice slice = aft_string_slice_from_c_string(u8"a,猫,,🍌,");
+    const char* tokens[5] = {"a", u8"猫", "", u8"🍌", ""};
+
+    AftSplitIterator it;
+    aft_split_iterator_set_delimiter_byte(&it, slice, ',', NULL);
+
+    bool result = true;
+
+    for(int token_index = 0; token_index < 5; token_index += 1)
+    {
+        AftMaybeStringSlice token = aft_split_iterator_next(&it);
+        AftStringSlice reference = aft_string_slice_from_c_string(tokens[token_index]);
+        result = result && token.valid && aft_string_slice_matches(token.value, reference);
+    }
+
+    return result && !aft_split_iterator_next(&it).valid;
+}
+
+static bool test_split_byte_set(Test* test)
+{
+    AftStringSlice slice = aft_string_slice_from_c_string(" key = value;\t other=thing ;;");
+    AftStringSlice delimiters = aft_string_slice_from_c_string("=;,:/");
+    const char* tokens[4] = {"key", "value", "other", "thing"};
+    AftSplitOptions options =
+    {
+        .skip_empty = true,
+        .trim_whitespace = true,
+    };
+
+    AftSplitIterator it;
+    aft_split_iterator_set_delimiter_byte_set(&it, slice, delimiters, &options);
+
+    bool result = true;
+
+    for(int token_index = 0; token_index < 4; token_index += 1)
+    {
+        AftMaybeStringSlice token = aft_split_iterator_next(&it);
+        AftStringSlice reference = aft_string_slice_from_c_string(tokens[token_index]);
+        result = result && token.valid && aft_string_slice_matches(token.value, reference);
+    }
+
+    return result && !aft_split_iterator_next(&it).valid;
+}
+
+static bool test_split_long(Test* test)
+{
+    const int field_count = 300;
+    char buffer[2100];
+    int count = 0;
+
+    for(int field_index = 0; field_index < field_count; field_index += 1)
+    {
+        int field_size = random_int_range(&test->generator, 0, 5);
+
+        for(int char_index = 0; char_index < field_size; char_index += 1)
+        {
+            buffer[count] = 'a' + (char) (field_index % 26);
+            count += 1;
+        }
+
+        if(field_index < field_count - 1)
+        {
+            buffer[count] = '|';
+            count += 1;
+        }
+    }
+
+    AftStringSlice slice = aft_string_slice_from_buffer(buffer, count);
+    AftStringSlice remaining = slice;
+
+    AftSplitIterator it;
+    aft_split_iterator_set_delimiter_byte(&it, slice, '|', NULL);
+
+    bool result = true;
+
+    for(int field_index = 0; field_index < field_count; field_index += 1)
+    {
+        AftMaybeInt found = aft_string_slice_find_first_char(remaining, '|');
+        int end = found.valid ? found.value : aft_string_slice_count(remaining);
+        AftStringSlice reference = aft_string_slice(remaining, 0, end);
+
+        AftMaybeStringSlice token = aft_split_iterator_next(&it);
+        result = result && token.valid
+                && token.value.contents == reference.contents
+                && token.value.count == reference.count;
+
+        if(found.valid)
+        {
+            aft_string_slice_remove_start(&remaining, end + 1);
+        }
+    }
+
+    return result && !aft_split_iterator_next(&it).valid;
+}
+
+static bool test_split_string(Test* test)
+{
+    AftStringSlice slice = aft_string_slice_from_c_string("one::two:three::::four:");
+    AftStringSlice delimiter = aft_string_slice_from_c_string("::");
+    const char* tokens[4] = {"one", "two:three", "", "four:"};
+
+    AftSplitIterator it;
+    aft_split_iterator_set_delimiter_string(&it, slice, delimiter, NULL);
+
+    bool result = true;
+
+    for(int token_index = 0; token_index < 4; token_index += 1)
+    {
+        AftMaybeStringSlice token = aft_split_iterator_next(&it);
+        AftStringSlice reference = aft_string_slice_from_c_string(tokens[token_index]);
+        result = result && token.valid && aft_string_slice_matches(token.value, reference);
+    }
+
+    return result && !aft_split_iterator_next(&it).valid;
+}
+
 static bool test_starts_with(Test* test)
 {
     const char* a = u8"a猫🍌 Wow";
@@ -981,6 +1808,237 @@ static bool test_c_string_copy_string_empty(Test* test)
     return result;
 }
 
+static bool test_utf16_byte_order(Test* test)
+{
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool result = aft_string_append_c_string(&string, u8"A€😀");
+
+    AftMaybeUtf16String little = aft_utf8_to_utf16(&string, AFT_BYTE_ORDER_LITTLE_ENDIAN);
+    AftMaybeUtf16String big = aft_utf8_to_utf16(&string, AFT_BYTE_ORDER_BIG_ENDIAN);
+
+    const uint8_t little_bytes[] = {0x41, 0x00, 0xac, 0x20, 0x3d, 0xd8, 0x00, 0xde};
+    const uint8_t big_bytes[] = {0x00, 0x41, 0x20, 0xac, 0xd8, 0x3d, 0xde, 0x00};
+
+    result = result
+            && little.valid
+            && little.value.count == 4
+            && big.valid
+            && big.value.count == 4;
+
+    for(int byte_index = 0; result && byte_index < 8; byte_index += 1)
+    {
+        result = ((const uint8_t*) little.value.contents)[byte_index] == little_bytes[byte_index]
+                && ((const uint8_t*) big.value.contents)[byte_index] == big_bytes[byte_index];
+    }
+
+    if(result)
+    {
+        AftMaybeString utf8 = aft_utf16_to_utf8_with_allocator(&big.value, AFT_BYTE_ORDER_BIG_ENDIAN, &test->allocator);
+        result = utf8.valid && aft_strings_match(&utf8.value, &string);
+        aft_string_destroy(&utf8.value);
+    }
+
+    if(little.valid)
+    {
+        aft_utf16_destroy_with_allocator(&little.value, &test->allocator);
+    }
+
+    if(big.valid)
+    {
+        aft_utf16_destroy_with_allocator(&big.value, &test->allocator);
+    }
+
+    aft_string_destroy(&string);
+
+    return result;
+}
+
+static bool test_utf16_invalid(Test* test)
+{
+    (void) test;
+
+    const char16_t lone_high[] = {u'a', 0xd83d, u'b'};
+    const char16_t lone_low[] = {0xde00, u'a'};
+    const char16_t ending_high[] = {u'a', 0xd83d};
+
+    char bytes[8];
+    char16_t units[8];
+
+    return !aft_utf16_get_utf8_count(lone_high, 3, AFT_BYTE_ORDER_LITTLE_ENDIAN).valid
+            && !aft_utf16_get_utf8_count(lone_low, 2, AFT_BYTE_ORDER_LITTLE_ENDIAN).valid
+            && !aft_utf16_get_utf8_count(ending_high, 2, AFT_BYTE_ORDER_LITTLE_ENDIAN).valid
+            && !aft_utf16_to_utf8_buffer(lone_high, 3, AFT_BYTE_ORDER_LITTLE_ENDIAN, bytes, 8).valid
+            && !aft_utf16_to_utf8_buffer(lone_low, 2, AFT_BYTE_ORDER_LITTLE_ENDIAN, bytes, 8).valid
+            && !aft_utf16_to_utf8_buffer(ending_high, 2, AFT_BYTE_ORDER_LITTLE_ENDIAN, bytes, 8).valid
+            && !aft_utf8_get_utf16_count(aft_string_slice_from_c_string("\xed\xa0\x80")).valid
+            && !aft_utf8_get_utf16_count(aft_string_slice_from_c_string("\xc0\xaf")).valid
+            && !aft_utf8_get_utf16_count(aft_string_slice_from_c_string("ab\xe2\x82")).valid
+            && !aft_utf8_to_utf16_buffer(aft_string_slice_from_c_string("\xed\xa0\x80"), AFT_BYTE_ORDER_LITTLE_ENDIAN, units, 8).valid
+            && !aft_utf8_to_utf16_buffer(aft_string_slice_from_c_string(u8"too long"), AFT_BYTE_ORDER_LITTLE_ENDIAN, units, 4).valid
+            && !aft_utf8_to_utf16_buffer(aft_string_slice_from_c_string(u8"abc😀"), AFT_BYTE_ORDER_LITTLE_ENDIAN, units, 4).valid;
+}
+
+static bool test_utf16_round_trip(Test* test)
+{
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool result = true;
+
+    // Mix runs of ASCII with codepoints of every UTF-8 length, so both the
+    // block and single codepoint paths are covered.
+    for(int codepoint_index = 0; result && codepoint_index < 2000; codepoint_index += 1)
+    {
+        char32_t codepoint;
+
+        switch(random_int_range(&test->generator, 0, 3))
+        {
+            case 0:  codepoint = random_int_range(&test->generator, 0x80, 0x7ff); break;
+            case 1:  codepoint = random_int_range(&test->generator, 0xe000, 0xffff); break;
+            case 2:  codepoint = random_int_range(&test->generator, 0x10000, 0x10ffff); break;
+            default: codepoint = random_int_range(&test->generator, 1, 0x7f); break;
+        }
+
+        result = aft_utf8_append_codepoint(&string, codepoint);
+
+        for(int ascii_index = random_int_range(&test->generator, 0, 20); result && ascii_index > 0; ascii_index -= 1)
+        {
+            result = aft_string_append_char(&string, 'a');
+        }
+    }
+
+    AftByteOrder byte_orders[2] = {AFT_BYTE_ORDER_BIG_ENDIAN, AFT_BYTE_ORDER_LITTLE_ENDIAN};
+
+    for(int order_index = 0; result && order_index < 2; order_index += 1)
+    {
+        AftByteOrder byte_order = byte_orders[order_index];
+        AftMaybeInt count = aft_utf8_get_utf16_count(aft_string_slice_from_string(&string));
+        AftMaybeUtf16String utf16 = aft_utf8_to_utf16(&string, byte_order);
+
+        result = count.valid && utf16.valid && utf16.value.count == count.value;
+
+        if(result)
+        {
+            AftMaybeInt utf8_count = aft_utf16_get_utf8_count(utf16.value.contents, utf16.value.count, byte_order);
+            AftMaybeString utf8 = aft_utf16_to_utf8_with_allocator(&utf16.value, byte_order, &test->allocator);
+
+            result = utf8_count.valid
+                    && utf8_count.value == aft_string_get_count(&string)
+                    && utf8.valid
+                    && aft_strings_match(&utf8.value, &string);
+
+            aft_string_destroy(&utf8.value);
+        }
+
+        if(utf16.valid)
+        {
+            aft_utf16_destroy_with_allocator(&utf16.value, &test->allocator);
+        }
+    }
+
+    aft_string_destroy(&string);
+
+    return result;
+}
+
+
+static bool test_utf8_check(Test* test)
+{
+    const char* valid[] =
+    {
+        "",
+        "Plain ASCII that runs on past one sixteen byte block.",
+        u8"Crème brûlée costs 3.50 € 👍🏽",
+    };
+    const char* invalid[] =
+    {
+        "\x80",
+        "caf\xc3",
+        "Plain ASCII that runs on past one sixteen byte block \xed\xa0\x80.",
+        "\xc0\xaf",
+        "\xf4\x90\x80\x80",
+    };
+
+    bool result = true;
+
+    for(int string_index = 0; result && string_index < 3; string_index += 1)
+    {
+        AftMaybeString string = aft_string_copy_c_string_with_allocator(valid[string_index], &test->allocator);
+        result = string.valid && aft_utf8_check(&string.value);
+        aft_string_destroy(&string.value);
+    }
+
+    for(int string_index = 0; result && string_index < 5; string_index += 1)
+    {
+        AftMaybeString string = aft_string_copy_c_string_with_allocator(invalid[string_index], &test->allocator);
+        result = string.valid && !aft_utf8_check(&string.value);
+        aft_string_destroy(&string.value);
+    }
+
+    return result;
+}
+
+static bool test_utf8_sanitize(Test* test)
+{
+    // These are the examples of maximal subparts from the Unicode Standard,
+    // section 3.9, each surrounded by enough ASCII for the block paths.
+    const char* inputs[] =
+    {
+        "a\xf1\x80\x80\xe1\x80\xc2" "b\x80" "c\x80\xbf" "d",
+        "\xc0\xaf\xe0\x80\xbf\xf0\x81\x82\x41",
+        "\xed\xa0\x80\xed\xbf\xbf\xed\xaf\x41",
+        "\xf4\x91\x92\x93\xff\x41\x80\xbf\x42",
+        "\xe1\x80\xe2\xf0\x91\x92\xf1\xbf\x41",
+        "Plain ASCII that runs on past one sixteen byte block \xe2\x82",
+    };
+    const char* expected[] =
+    {
+        u8"a���b�c��d",
+        u8"��������A",
+        u8"��������A",
+        u8"�����A��B",
+        u8"����A",
+        u8"Plain ASCII that runs on past one sixteen byte block �",
+    };
+
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    bool result = true;
+
+    for(int string_index = 0; result && string_index < 6; string_index += 1)
+    {
+        aft_string_remove(&buffer, 0, aft_string_get_count(&buffer));
+
+        AftMaybeStringSlice sanitized = aft_utf8_sanitize(aft_string_slice_from_c_string(inputs[string_index]), &buffer);
+        result = sanitized.valid
+                && aft_string_slice_matches(sanitized.value, aft_string_slice_from_c_string(expected[string_index]));
+    }
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+static bool test_utf8_sanitize_valid(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice slice = aft_string_slice_from_c_string(u8"Crème brûlée costs 3.50 € 👍🏽");
+    AftMaybeStringSlice sanitized = aft_utf8_sanitize(slice, &buffer);
+
+    bool result = sanitized.valid
+            && aft_string_slice_start(sanitized.value) == aft_string_slice_start(slice)
+            && aft_string_slice_count(sanitized.value) == aft_string_slice_count(slice)
+            && aft_string_get_count(&buffer) == 0;
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
 
 int main(int argc, const char** argv)
 {
@@ -998,14 +2056,23 @@ int main(int argc, const char** argv)
     add_test(&suite, test_append_to_nothing, "Append To Nothing");
     add_test(&suite, test_append_c_string, "Append C String");
     add_test(&suite, test_append_char, "Append Char");
+    add_test(&suite, test_append_many, "Append Many");
+    add_test(&suite, test_append_many_overflow, "Append Many Overflow");
+    add_test(&suite, test_append_repeated, "Append Repeated");
+    add_test(&suite, test_append_repeated_overflow, "Append Repeated Overflow");
     add_test(&suite, test_assign, "Assign");
     add_test(&suite, test_assign_nothing, "Assign Nothing");
     add_test(&suite, test_assign_self, "Assign Self");
     add_test(&suite, test_c_string_copy_string, "C String Copy String");
     add_test(&suite, test_c_string_copy_string_empty, "C String Copy String Empty");
+    add_test(&suite, test_code_page_latin_1, "Code Page Latin-1");
+    add_test(&suite, test_code_page_unmappable, "Code Page Unmappable");
+    add_test(&suite, test_code_page_windows_1252, "Code Page Windows-1252");
+    add_test(&suite, test_codepoint_index, "Codepoint Index");
     add_test(&suite, test_copy, "Copy");
     add_test(&suite, test_copy_c_string, "Copy C String");
     add_test(&suite, test_copy_c_string_empty, "Copy C String Empty");
+    add_test(&suite, test_copy_c_string_full_small, "Copy C String Full Small");
     add_test(&suite, test_destroy, "Destroy");
     add_test(&suite, test_ends_with, "Ends With");
     add_test(&suite, test_ends_with_missing, "Ends With Missing");
@@ -1023,10 +2090,21 @@ int main(int argc, const char** argv)
     add_test(&suite, test_find_last_string_self, "Find Last String Self");
     add_test(&suite, test_get_contents, "Get Contents");
     add_test(&suite, test_get_contents_const, "Get Contents Const");
+    add_test(&suite, test_handle_array_from_strings, "Handle Array From Strings");
+    add_test(&suite, test_handle_compare, "Handle Compare");
+    add_test(&suite, test_handle_hash, "Handle Hash");
+    add_test(&suite, test_handle_matches, "Handle Matches");
     add_test(&suite, test_initialise, "Initialise");
     add_test(&suite, test_iterator_next, "Iterator Next");
+    add_test(&suite, test_iterator_next_batch, "Iterator Next Batch");
     add_test(&suite, test_iterator_prior, "Iterator Prior");
     add_test(&suite, test_iterator_set_string, "Iterator Set String");
+    add_test(&suite, test_join, "Join");
+    add_test(&suite, test_join_nothing, "Join Nothing");
+    add_test(&suite, test_join_overflow, "Join Overflow");
+    add_test(&suite, test_line_index, "Line Index");
+    add_test(&suite, test_line_index_update, "Line Index Update");
+    add_test(&suite, test_line_iterator, "Line Iterator");
     add_test(&suite, test_remove_end, "Remove End");
     add_test(&suite, test_remove_everything, "Remove Everything");
     add_test(&suite, test_remove_middle, "Remove Middle");
@@ -1040,10 +2118,24 @@ int main(int argc, const char** argv)
     add_test(&suite, test_replace_self_middle, "Replace Self Middle");
     add_test(&suite, test_replace_with_nothing, "Replace With Nothing");
     add_test(&suite, test_reserve, "Reserve");
+    add_test(&suite, test_sort, "Sort");
+    add_test(&suite, test_sort_slices, "Sort Slices");
+    add_test(&suite, test_sort_slices_ignore_case, "Sort Slices Ignore Case");
+    add_test(&suite, test_sort_slices_parallel, "Sort Slices Parallel");
+    add_test(&suite, test_split_byte, "Split Byte");
+    add_test(&suite, test_split_byte_set, "Split Byte Set");
+    add_test(&suite, test_split_long, "Split Long");
+    add_test(&suite, test_split_string, "Split String");
     add_test(&suite, test_starts_with, "Starts With");
     add_test(&suite, test_starts_with_missing, "Starts With Missing");
     add_test(&suite, test_starts_with_nothing, "Starts With Nothing");
     add_test(&suite, test_starts_with_self, "Starts With Self");
+    add_test(&suite, test_utf16_byte_order, "UTF-16 Byte Order");
+    add_test(&suite, test_utf16_invalid, "UTF-16 Invalid");
+    add_test(&suite, test_utf16_round_trip, "UTF-16 Round Trip");
+    add_test(&suite, test_utf8_check, "UTF-8 Check");
+    add_test(&suite, test_utf8_sanitize, "UTF-8 Sanitize");
+    add_test(&suite, test_utf8_sanitize_valid, "UTF-8 Sanitize Valid");
 
     bool success = run_tests(&suite);
     return !success;
@@ -0,0 +1,749 @@
+#include "../Utility/benchmark.h"
+
+#include <AftString/aft_string.h>
+#include <AftString/aft_unicode.h>
+
+#include <stddef.h>
+
+
+#define NUMBER_COUNT 1024
+#define TEXT_BYTES 65536
+
+
+static const char* ascii_sample = "The quick brown fox jumps over the lazy dog. ";
+static const char* windows_1252_sample = "Cr\xe8me br\xfbl\xe9" "e costs \x80" "3.50 \x96 "
+        "\x93na\xefve fa\xe7" "ade\x94. ";
+static const char* cyrillic_sample = u8"Бума́га всё сте́рпит. В гостя́х хорошо́, а до́ма лу́чше. ";
+static const char* mixed_sample = u8"Crème brûlée costs 3.50 € — 猫はかわいい。 नमस्ते दुनिया "
+        u8"한국어 텍스트 مرحبا بالعالم 👩‍👩‍👧 🇯🇵 👍🏽 Ελληνικά! ";
+
+
+static AftString make_text(Benchmark* benchmark, const char* sample)
+{
+    AftString text;
+    aft_string_initialise_with_allocator(&text, &benchmark->allocator);
+
+    while(aft_string_get_count(&text) < TEXT_BYTES)
+    {
+        bool appended = aft_string_append_c_string(&text, sample);
+        ASSERT(appended);
+    }
+
+    return text;
+}
+
+static void make_numbers(Benchmark* benchmark, int64_t* numbers)
+{
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        uint64_t bits = random_generate(&benchmark->generator);
+        int shift = random_int_range(&benchmark->generator, 1, 63);
+        numbers[number_index] = ((int64_t) bits) >> shift;
+    }
+}
+
+static void code_page_to_utf8(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftString utf8;
+    aft_string_initialise_with_allocator(&utf8, &benchmark->allocator);
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_string_remove(&utf8, 0, aft_string_get_count(&utf8));
+        aft_utf8_append_code_page(&utf8, aft_string_slice_from_string(&text), AFT_CODE_PAGE_WINDOWS_1252);
+        sum += aft_string_get_count(&utf8);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+    aft_string_destroy(&utf8);
+}
+
+static void codepoint_next(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftCodepointIterator it;
+    uint32_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_codepoint_iterator_set_string(&it, aft_string_slice_from_string(&text));
+
+        for(AftMaybeChar32 codepoint = aft_codepoint_iterator_next(&it);
+                codepoint.valid;
+                codepoint = aft_codepoint_iterator_next(&it))
+        {
+            sum += codepoint.value;
+        }
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void codepoint_next_batch(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftCodepointIterator it;
+    char32_t codepoints[256];
+    uint32_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_codepoint_iterator_set_string(&it, aft_string_slice_from_string(&text));
+
+        for(int count = aft_codepoint_iterator_next_batch(&it, codepoints, 256);
+                count > 0;
+                count = aft_codepoint_iterator_next_batch(&it, codepoints, 256))
+        {
+            for(int codepoint_index = 0; codepoint_index < count; codepoint_index += 1)
+            {
+                sum += codepoints[codepoint_index];
+            }
+        }
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void codepoint_prior(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftCodepointIterator it;
+    uint32_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_codepoint_iterator_set_string(&it, aft_string_slice_from_string(&text));
+        aft_codepoint_iterator_end(&it);
+
+        for(AftMaybeChar32 codepoint = aft_codepoint_iterator_prior(&it);
+                codepoint.valid;
+                codepoint = aft_codepoint_iterator_prior(&it))
+        {
+            sum += codepoint.value;
+        }
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void equals_folded(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+
+    AftString folded;
+    aft_string_initialise_with_allocator(&folded, &benchmark->allocator);
+    bool appended = aft_utf8_fold_case(&folded, aft_string_slice_from_string(&text), AFT_CASE_FOLDING_FULL);
+    ASSERT(appended);
+
+    uint64_t matches = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        matches += aft_utf8_equals_folded(aft_string_slice_from_string(&text),
+                aft_string_slice_from_string(&folded));
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = matches;
+    aft_string_destroy(&folded);
+    aft_string_destroy(&text);
+}
+
+static void format_int64(Benchmark* benchmark, bool use_grouping)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &benchmark->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = use_grouping;
+
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        int64_t number = numbers[iteration % NUMBER_COUNT];
+        AftMaybeString string = aft_string_from_int64_with_allocator(number, &format, &benchmark->allocator);
+        sum += aft_string_get_count(&string.value);
+        aft_string_destroy(&string.value);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_decimal_format_destroy(&format);
+}
+
+static void grapheme_next(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftGraphemeIterator it;
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_grapheme_iterator_set_string(&it, aft_string_slice_from_string(&text));
+
+        for(AftMaybeStringSlice cluster = aft_grapheme_iterator_next(&it);
+                cluster.valid;
+                cluster = aft_grapheme_iterator_next(&it))
+        {
+            sum += aft_string_slice_count(cluster.value);
+        }
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void utf16_to_utf8(Benchmark* benchmark, const char* sample)
+{
+    static char16_t units[2 * TEXT_BYTES];
+    static char bytes[2 * TEXT_BYTES];
+
+    AftString text = make_text(benchmark, sample);
+    AftMaybeInt unit_count = aft_utf8_to_utf16_buffer(aft_string_slice_from_string(&text),
+            AFT_BYTE_ORDER_LITTLE_ENDIAN, units, 2 * TEXT_BYTES);
+    ASSERT(unit_count.valid);
+
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftMaybeInt count = aft_utf16_get_utf8_count(units, unit_count.value, AFT_BYTE_ORDER_LITTLE_ENDIAN);
+        AftMaybeInt written = aft_utf16_to_utf8_buffer(units, unit_count.value,
+                AFT_BYTE_ORDER_LITTLE_ENDIAN, bytes, count.value);
+        sum += written.value;
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void utf8_sanitize(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &benchmark->allocator);
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftMaybeStringSlice sanitized = aft_utf8_sanitize(aft_string_slice_from_string(&text), &buffer);
+        sum += aft_string_slice_count(sanitized.value);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+    aft_string_destroy(&buffer);
+}
+
+static void utf8_to_code_page(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftString utf8;
+    aft_string_initialise_with_allocator(&utf8, &benchmark->allocator);
+    bool converted = aft_utf8_append_code_page(&utf8, aft_string_slice_from_string(&text), AFT_CODE_PAGE_WINDOWS_1252);
+    ASSERT(converted);
+
+    AftString encoded;
+    aft_string_initialise_with_allocator(&encoded, &benchmark->allocator);
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_string_remove(&encoded, 0, aft_string_get_count(&encoded));
+        aft_code_page_append_utf8(&encoded, aft_string_slice_from_string(&utf8),
+                AFT_CODE_PAGE_WINDOWS_1252, AFT_CONVERSION_STRICT);
+        sum += aft_string_get_count(&encoded);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+    aft_string_destroy(&utf8);
+    aft_string_destroy(&encoded);
+}
+
+static void utf8_to_utf16(Benchmark* benchmark, const char* sample)
+{
+    static char16_t units[2 * TEXT_BYTES];
+
+    AftString text = make_text(benchmark, sample);
+    AftStringSlice slice = aft_string_slice_from_string(&text);
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftMaybeInt count = aft_utf8_get_utf16_count(slice);
+        AftMaybeInt written = aft_utf8_to_utf16_buffer(slice, AFT_BYTE_ORDER_LITTLE_ENDIAN, units, count.value);
+        sum += written.value;
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void word_next(Benchmark* benchmark, const char* sample)
+{
+    AftString text = make_text(benchmark, sample);
+    AftWordIterator it;
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        aft_word_iterator_set_string(&it, aft_string_slice_from_string(&text));
+
+        for(AftMaybeStringSlice word = aft_word_iterator_next(&it);
+                word.valid;
+                word = aft_word_iterator_next(&it))
+        {
+            sum += aft_string_slice_count(word.value);
+        }
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&text);
+}
+
+static void benchmark_code_page_to_utf8_ascii(Benchmark* benchmark)
+{
+    code_page_to_utf8(benchmark, ascii_sample);
+}
+
+static void benchmark_code_page_to_utf8_windows_1252(Benchmark* benchmark)
+{
+    code_page_to_utf8(benchmark, windows_1252_sample);
+}
+
+static void benchmark_codepoint_next_ascii(Benchmark* benchmark)
+{
+    codepoint_next(benchmark, ascii_sample);
+}
+
+static void benchmark_codepoint_next_batch_ascii(Benchmark* benchmark)
+{
+    codepoint_next_batch(benchmark, ascii_sample);
+}
+
+static void benchmark_codepoint_next_batch_cyrillic(Benchmark* benchmark)
+{
+    codepoint_next_batch(benchmark, cyrillic_sample);
+}
+
+static void benchmark_codepoint_next_cyrillic(Benchmark* benchmark)
+{
+    codepoint_next(benchmark, cyrillic_sample);
+}
+
+static void benchmark_codepoint_next_mixed(Benchmark* benchmark)
+{
+    codepoint_next(benchmark, mixed_sample);
+}
+
+static void benchmark_codepoint_prior_ascii(Benchmark* benchmark)
+{
+    codepoint_prior(benchmark, ascii_sample);
+}
+
+static void benchmark_codepoint_prior_cyrillic(Benchmark* benchmark)
+{
+    codepoint_prior(benchmark, cyrillic_sample);
+}
+
+static void benchmark_equals_folded_ascii(Benchmark* benchmark)
+{
+    equals_folded(benchmark, ascii_sample);
+}
+
+static void benchmark_equals_folded_cyrillic(Benchmark* benchmark)
+{
+    equals_folded(benchmark, cyrillic_sample);
+}
+
+static void benchmark_format_double(Benchmark* benchmark)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &benchmark->allocator);
+    ASSERT(defaulted);
+
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        double number = numbers[iteration % NUMBER_COUNT] / 4096.0;
+        AftMaybeString string = aft_string_from_double_with_allocator(number, &format, &benchmark->allocator);
+        sum += aft_string_get_count(&string.value);
+        aft_string_destroy(&string.value);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_decimal_format_destroy(&format);
+}
+
+static void benchmark_format_double_array(Benchmark* benchmark)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    static double values[NUMBER_COUNT];
+
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        values[number_index] = numbers[number_index] / 4096.0;
+    }
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &benchmark->allocator);
+    ASSERT(defaulted);
+
+    AftBatchFormatOptions options;
+    options.separator = aft_string_slice_from_c_string(",");
+    options.chunk_size = 0;
+    options.thread_count = 1;
+
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftMaybeString string = aft_string_from_doubles_with_allocator(values, NUMBER_COUNT, &format, &options, &benchmark->allocator);
+        sum += aft_string_get_count(&string.value);
+        aft_string_destroy(&string.value);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_decimal_format_destroy(&format);
+}
+
+static void benchmark_format_int64(Benchmark* benchmark)
+{
+    format_int64(benchmark, true);
+}
+
+static void benchmark_format_int64_compiled(Benchmark* benchmark)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &benchmark->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = true;
+
+    AftCompiledDecimalFormat compiled;
+    bool compiled_valid = aft_decimal_format_compile_with_allocator(&compiled, &format, &benchmark->allocator);
+    ASSERT(compiled_valid);
+
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &benchmark->allocator);
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        int64_t number = numbers[iteration % NUMBER_COUNT];
+        aft_string_remove(&string, 0, aft_string_get_count(&string));
+        aft_string_append_int64_compiled(&string, number, &compiled);
+        sum += aft_string_get_count(&string);
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+    aft_string_destroy(&string);
+    aft_compiled_decimal_format_destroy(&compiled);
+    aft_decimal_format_destroy(&format);
+}
+
+static void benchmark_format_int64_ungrouped(Benchmark* benchmark)
+{
+    format_int64(benchmark, false);
+}
+
+static void benchmark_grapheme_next_ascii(Benchmark* benchmark)
+{
+    grapheme_next(benchmark, ascii_sample);
+}
+
+static void benchmark_grapheme_next_mixed(Benchmark* benchmark)
+{
+    grapheme_next(benchmark, mixed_sample);
+}
+
+static void benchmark_parse_double(Benchmark* benchmark)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    static AftString strings[NUMBER_COUNT];
+
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        double number = numbers[number_index] / 4096.0;
+        AftMaybeString string = aft_ascii_from_double_with_allocator(number, &benchmark->allocator);
+        ASSERT(string.valid);
+        strings[number_index] = string.value;
+    }
+
+    int64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftStringSlice slice = aft_string_slice_from_string(&strings[iteration % NUMBER_COUNT]);
+        AftMaybeDouble number = aft_ascii_to_double(slice);
+        sum += (int64_t) number.value;
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = (uint64_t) sum;
+
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        aft_string_destroy(&strings[number_index]);
+    }
+}
+
+static void benchmark_parse_int64(Benchmark* benchmark)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &benchmark->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = false;
+
+    static AftString strings[NUMBER_COUNT];
+
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        AftMaybeString string = aft_string_from_int64_with_allocator(numbers[number_index], &format, &benchmark->allocator);
+        ASSERT(string.valid);
+        strings[number_index] = string.value;
+    }
+
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftStringSlice slice = aft_string_slice_from_string(&strings[iteration % NUMBER_COUNT]);
+        AftMaybeInt64 number = aft_ascii_to_int64(slice);
+        sum += (uint64_t) number.value;
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        aft_string_destroy(&strings[number_index]);
+    }
+
+    aft_decimal_format_destroy(&format);
+}
+
+static void benchmark_parse_int64_column(Benchmark* benchmark)
+{
+    int64_t numbers[NUMBER_COUNT];
+    make_numbers(benchmark, numbers);
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &benchmark->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = false;
+
+    AftString text;
+    aft_string_initialise_with_allocator(&text, &benchmark->allocator);
+
+    for(int number_index = 0; number_index < NUMBER_COUNT; number_index += 1)
+    {
+        bool appended = aft_string_append_int64(&text, numbers[number_index], &format)
+                && aft_string_append_char(&text, number_index % 16 == 15 ? '\n' : ',');
+        ASSERT(appended);
+    }
+
+    AftDelimitedParseOptions options;
+    options.chunk_size = 0;
+    options.thread_count = 1;
+    options.delimiter = ',';
+
+    static int64_t values[NUMBER_COUNT];
+    uint64_t sum = 0;
+
+    start_timing(benchmark);
+
+    for(int iteration = 0; iteration < benchmark->iterations; iteration += 1)
+    {
+        AftDelimitedParseResult result = aft_ascii_to_int64s(aft_string_slice_from_string(&text), &options, values, NULL, NUMBER_COUNT);
+        sum += (uint64_t) values[iteration % NUMBER_COUNT] + (uint64_t) result.field_count;
+    }
+
+    stop_timing(benchmark);
+
+    benchmark->result = sum;
+
+    aft_string_destroy(&text);
+    aft_decimal_format_destroy(&format);
+}
+
+static void benchmark_utf16_to_utf8_ascii(Benchmark* benchmark)
+{
+    utf16_to_utf8(benchmark, ascii_sample);
+}
+
+static void benchmark_utf16_to_utf8_mixed(Benchmark* benchmark)
+{
+    utf16_to_utf8(benchmark, mixed_sample);
+}
+
+static void benchmark_utf8_sanitize_ascii(Benchmark* benchmark)
+{
+    utf8_sanitize(benchmark, ascii_sample);
+}
+
+static void benchmark_utf8_sanitize_mixed(Benchmark* benchmark)
+{
+    utf8_sanitize(benchmark, mixed_sample);
+}
+
+static void benchmark_utf8_to_code_page_ascii(Benchmark* benchmark)
+{
+    utf8_to_code_page(benchmark, ascii_sample);
+}
+
+static void benchmark_utf8_to_code_page_windows_1252(Benchmark* benchmark)
+{
+    utf8_to_code_page(benchmark, windows_1252_sample);
+}
+
+static void benchmark_utf8_to_utf16_ascii(Benchmark* benchmark)
+{
+    utf8_to_utf16(benchmark, ascii_sample);
+}
+
+static void benchmark_utf8_to_utf16_mixed(Benchmark* benchmark)
+{
+    utf8_to_utf16(benchmark, mixed_sample);
+}
+
+static void benchmark_word_next_ascii(Benchmark* benchmark)
+{
+    word_next(benchmark, ascii_sample);
+}
+
+static void benchmark_word_next_mixed(Benchmark* benchmark)
+{
+    word_next(benchmark, mixed_sample);
+}
+
+
+int main(int argc, const char** argv)
+{
+    BenchmarkSuite suite = {0};
+
+    add_benchmark(&suite, benchmark_code_page_to_utf8_ascii, "Code Page To UTF-8 ASCII");
+    add_benchmark(&suite, benchmark_code_page_to_utf8_windows_1252, "Code Page To UTF-8 Windows-1252");
+    add_benchmark(&suite, benchmark_codepoint_next_ascii, "Codepoint Next ASCII");
+    add_benchmark(&suite, benchmark_codepoint_next_batch_ascii, "Codepoint Next Batch ASCII");
+    add_benchmark(&suite, benchmark_codepoint_next_batch_cyrillic, "Codepoint Next Batch Cyrillic");
+    add_benchmark(&suite, benchmark_codepoint_next_cyrillic, "Codepoint Next Cyrillic");
+    add_benchmark(&suite, benchmark_codepoint_next_mixed, "Codepoint Next Mixed");
+    add_benchmark(&suite, benchmark_codepoint_prior_ascii, "Codepoint Prior ASCII");
+    add_benchmark(&suite, benchmark_codepoint_prior_cyrillic, "Codepoint Prior Cyrillic");
+    add_benchmark(&suite, benchmark_equals_folded_ascii, "Equals Folded ASCII");
+    add_benchmark(&suite, benchmark_equals_folded_cyrillic, "Equals Folded Cyrillic");
+    add_benchmark(&suite, benchmark_format_double, "Format Double");
+    add_benchmark(&suite, benchmark_format_double_array, "Format Double Array");
+    add_benchmark(&suite, benchmark_format_int64, "Format Int64");
+    add_benchmark(&suite, benchmark_format_int64_compiled, "Format Int64 Compiled");
+    add_benchmark(&suite, benchmark_format_int64_ungrouped, "Format Int64 Ungrouped");
+    add_benchmark(&suite, benchmark_grapheme_next_ascii, "Grapheme Next ASCII");
+    add_benchmark(&suite, benchmark_grapheme_next_mixed, "Grapheme Next Mixed");
+    add_benchmark(&suite, benchmark_parse_double, "Parse Double");
+    add_benchmark(&suite, benchmark_parse_int64, "Parse Int64");
+    add_benchmark(&suite, benchmark_parse_int64_column, "Parse Int64 Column");
+    add_benchmark(&suite, benchmark_utf16_to_utf8_ascii, "UTF-16 To UTF-8 ASCII");
+    add_benchmark(&suite, benchmark_utf16_to_utf8_mixed, "UTF-16 To UTF-8 Mixed");
+    add_benchmark(&suite, benchmark_utf8_sanitize_ascii, "UTF-8 Sanitize ASCII");
+    add_benchmark(&suite, benchmark_utf8_sanitize_mixed, "UTF-8 Sanitize Mixed");
+    add_benchmark(&suite, benchmark_utf8_to_code_page_ascii, "UTF-8 To Code Page ASCII");
+    add_benchmark(&suite, benchmark_utf8_to_code_page_windows_1252, "UTF-8 To Code Page Windows-1252");
+    add_benchmark(&suite, benchmark_utf8_to_utf16_ascii, "UTF-8 To UTF-16 ASCII");
+    add_benchmark(&suite, benchmark_utf8_to_utf16_mixed, "UTF-8 To UTF-16 Mixed");
+    add_benchmark(&suite, benchmark_word_next_ascii, "Word Next ASCII");
+    add_benchmark(&suite, benchmark_word_next_mixed, "Word Next Mixed");
+
+    const char* filter = (argc > 1) ? argv[1] : NULL;
+    run_benchmarks(&suite, filter);
+
+    return 0;
+}
@@ -96,6 +96,16 @@ static bool test_multiply_by_pow10(Test* test)
             && big_int_compare(&product, &equivalent_product) == 0;
 }
 
+static bool test_multiply_by_pow5(Test* test)
+{
+    const BigInt a = big_int_from_c_string("23542352111117009235462177");
+    const BigInt answer = big_int_from_c_string("877020959225185559520951546728610992431640625");
+
+    BigInt product = big_int_multiply_by_pow5(&a, 28);
+
+    return big_int_compare(&product, &answer) == 0;
+}
+
 static bool test_multiply_by_2(Test* test)
 {
     const BigInt a = big_int_from_c_string("23542352111117009235462177");
@@ -154,6 +164,7 @@ int main(int argc, const char** argv)
     add_test(&suite, test_double, "Test Double");
     add_test(&suite, test_multiply, "Test Multiply");
     add_test(&suite, test_multiply_by_pow10, "Test Multiply By Power Of 10");
+    add_test(&suite, test_multiply_by_pow5, "Test Multiply By Power Of 5");
     add_test(&suite, test_multiply_by_2, "Test Multiply By 2");
     add_test(&suite, test_multiply_uint32, "Test Multiply By uint32_t");
     add_test(&suite, test_pow2, "Test Power Of 2");
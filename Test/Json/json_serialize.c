@@ -22,11 +22,7 @@ static bool serialize_string(Serializer* serializer, const JsonElement* element)
 static void add_indentation(AftString* string, int indent_level, int spaces_per_indent)
 {
     int spaces = spaces_per_indent * indent_level;
-
-    for(int space = 0; space < spaces; space += 1)
-    {
-        aft_string_append_char(string, ' ');
-    }
+    aft_string_append_repeated(string, aft_string_slice_from_c_string(" "), spaces);
 }
 
 static bool serialize_array(Serializer* serializer, const JsonElement* element)
@@ -4,6 +4,8 @@
 
 #include "../Utility/test.h"
 
+#include <stddef.h>
+
 
 int main(const char* argv, int argc)
 {
@@ -80,19 +82,16 @@ int main(const char* argv, int argc)
 
     if(allocator.bytes_used != 0)
     {
-        AftString message = aft_string_copy_c_string_with_allocator("Memory leak warning! ", &allocator).value;
-
-        AftBaseFormat format = {.base = 10};
-        AftString bytes = aft_ascii_from_uint64_with_allocator(allocator.bytes_used, &format, &allocator).value;
-        aft_string_append(&message, &bytes);
+        AftString message;
+        aft_string_initialise_with_allocator(&message, &allocator);
 
-        aft_string_append_c_string(&message, " bytes were not deallocated. \n");
+        AftFormatValue bytes = aft_format_value_from_uint64(allocator.bytes_used, NULL);
+        aft_string_append_format(&message, "Memory leak warning! {} bytes were not deallocated. \n", &bytes, 1);
 
         AftStringSlice slice = aft_string_slice_from_string(&message);
         aft_write_to_error_output(slice);
 
         aft_string_destroy(&message);
-        aft_string_destroy(&bytes);
     }
 
     return 0;
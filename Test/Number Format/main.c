@@ -2,6 +2,781 @@
 
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static bool test_append_format(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.use_grouping = true;
+
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    AftFormatValue values[6] =
+    {
+        aft_format_value_from_slice(aft_string_slice_from_c_string("Crème")),
+        aft_format_value_from_codepoint(U'€'),
+        aft_format_value_from_double(1234.5, &format),
+        aft_format_value_from_int64(INT64_MIN, NULL),
+        aft_format_value_from_uint64(UINT64_C(1000000), &format),
+        aft_format_value_from_int64(-42, &format),
+    };
+
+    bool appended = aft_string_append_c_string(&string, "> ")
+            && aft_string_append_format(&string, "{} costs {}{} {{{3}}} {4} {5}, {0}!", values, 6);
+
+    const char* reference = u8"> Crème costs €1,234.5 {-9223372036854775808} 1,000,000 -42, Crème!";
+    bool result = appended && strings_match(reference, aft_string_get_contents_const(&string));
+
+    aft_string_destroy(&string);
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+static bool test_append_format_invalid(Test* test)
+{
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    AftFormatValue values[1] =
+    {
+        aft_format_value_from_uint64(7, NULL),
+    };
+
+    bool result = aft_string_append_c_string(&string, "Before")
+            && !aft_string_append_format(&string, "{} and {}", values, 1)
+            && !aft_string_append_format(&string, "{1}", values, 1)
+            && !aft_string_append_format(&string, "{", values, 1)
+            && !aft_string_append_format(&string, "}", values, 1)
+            && !aft_string_append_format(&string, "{x}", values, 1)
+            && strings_match("Before", aft_string_get_contents_const(&string))
+            && aft_string_append_format(&string, " {0}{0}", values, 1)
+            && strings_match("Before 77", aft_string_get_contents_const(&string));
+
+    aft_string_destroy(&string);
+
+    return result;
+}
+
+static bool test_append_number(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.use_grouping = true;
+
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool appended = aft_string_append_c_string(&string, "Values: ")
+            && aft_string_append_int(&string, -12345, &format)
+            && aft_string_append_c_string(&string, " ")
+            && aft_string_append_int64(&string, INT64_MIN, &format)
+            && aft_string_append_c_string(&string, " ")
+            && aft_string_append_uint64(&string, UINT64_MAX, &format)
+            && aft_string_append_c_string(&string, " ")
+            && aft_string_append_double(&string, 1234.5, &format)
+            && aft_string_append_c_string(&string, " ")
+            && aft_string_append_float(&string, 0.25f, &format);
+
+    const char* reference = "Values: -12,345 -9,223,372,036,854,775,808 18,446,744,073,709,551,615 1,234.5 0.25";
+    bool result = appended && strings_match(reference, aft_string_get_contents_const(&string));
+
+    aft_string_destroy(&string);
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+static bool test_append_numbers(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.use_grouping = true;
+
+    AftBatchFormatOptions options;
+    options.separator = aft_string_slice_from_c_string("; ");
+    options.chunk_size = 0;
+    options.thread_count = 1;
+
+    const int64_t ints[3] = {-12345, 0, INT64_MIN};
+    const double doubles[3] = {1.5, -0.25, 1e21};
+
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool appended = aft_string_append_c_string(&string, "Values: ")
+            && aft_string_append_int64s(&string, ints, 3, &format, &options)
+            && aft_string_append_c_string(&string, " | ")
+            && aft_string_append_doubles(&string, doubles, 3, NULL, &options)
+            && aft_string_append_doubles(&string, NULL, 0, &format, &options);
+
+    const char* reference = "Values: -12,345; 0; -9,223,372,036,854,775,808 | 1.5; -0.25; 1e+21";
+    bool result = appended && strings_match(reference, aft_string_get_contents_const(&string));
+
+    aft_string_destroy(&string);
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+static bool test_append_numbers_parallel(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    double doubles[3000];
+    int64_t ints[3000];
+
+    AftString double_reference;
+    AftString int_reference;
+    aft_string_initialise_with_allocator(&double_reference, &test->allocator);
+    aft_string_initialise_with_allocator(&int_reference, &test->allocator);
+
+    bool appended = true;
+
+    for(int value_index = 0; value_index < 3000; value_index += 1)
+    {
+        uint64_t bits = random_generate(&test->generator);
+        ints[value_index] = (int64_t) bits >> random_int_range(&test->generator, 0, 63);
+        doubles[value_index] = (double) ints[value_index] / 1000.0;
+
+        if(value_index > 0)
+        {
+            appended = appended
+                    && aft_string_append_char(&double_reference, '\n')
+                    && aft_string_append_char(&int_reference, '\n');
+        }
+
+        AftFormatValue int_value = aft_format_value_from_int64(ints[value_index], NULL);
+        appended = appended
+                && aft_string_append_double(&double_reference, doubles[value_index], &format)
+                && aft_string_append_format(&int_reference, "{}", &int_value, 1);
+    }
+
+    AftBatchFormatOptions options;
+    options.separator = aft_string_slice_from_c_string("\n");
+    options.chunk_size = 100;
+    options.thread_count = 4;
+
+    AftMaybeString formatted_doubles = aft_string_from_doubles_with_allocator(doubles, 3000, &format, &options, &test->allocator);
+    AftMaybeString formatted_ints = aft_string_from_int64s_with_allocator(ints, 3000, NULL, &options, &test->allocator);
+
+    bool result = appended
+            && formatted_doubles.valid
+            && formatted_ints.valid
+            && aft_strings_match(&double_reference, &formatted_doubles.value)
+            && aft_strings_match(&int_reference, &formatted_ints.value);
+
+    aft_string_destroy(&formatted_doubles.value);
+    aft_string_destroy(&formatted_ints.value);
+    aft_string_destroy(&double_reference);
+    aft_string_destroy(&int_reference);
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+// Write either a random finite double to a random precision, or a run of
+// random digits with a random exponent. Long runs of digits and values near
+// the ends of the range are the hard cases for parsing.
+static void make_random_decimal(RandomGenerator* generator, char* buffer, int cap)
+{
+    if(random_int_range(generator, 0, 1))
+    {
+        union
+        {
+            double value;
+            uint64_t bits;
+        } number;
+
+        do
+        {
+            number.bits = random_generate(generator);
+        } while(isnan(number.value) || isinf(number.value));
+
+        int precision = random_int_range(generator, 1, 25);
+        snprintf(buffer, cap, "%.*g", precision, number.value);
+    }
+    else
+    {
+        int count = 0;
+
+        if(random_int_range(generator, 0, 1))
+        {
+            buffer[count] = '-';
+            count += 1;
+        }
+
+        int digit_count = random_int_range(generator, 1, 40);
+        int point = random_int_range(generator, 0, digit_count);
+
+        for(int digit_index = 0; digit_index < digit_count; digit_index += 1)
+        {
+            if(digit_index == point && digit_index != 0)
+            {
+                buffer[count] = '.';
+                count += 1;
+            }
+
+            buffer[count] = (char) ('0' + random_int_range(generator, 0, 9));
+            count += 1;
+        }
+
+        snprintf(&buffer[count], cap - count, "e%d", random_int_range(generator, -360, 320));
+    }
+}
+
+static bool test_ascii_double(Test* test)
+{
+    const double values[12] =
+    {
+        0.0, -0.0, 0.1 + 0.2, 123.456, 1e20, 1e21, 0.000001, 1e-7, DBL_MAX, 4.9406564584124654e-324,
+        NAN, -INFINITY,
+    };
+    const char* references[12] =
+    {
+        "0", "-0", "0.30000000000000004", "123.456", "100000000000000000000", "1e+21", "0.000001",
+        "1e-7", "1.7976931348623157e+308", "5e-324", "nan", "-inf",
+    };
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 12; case_index += 1)
+    {
+        AftMaybeString string = aft_ascii_from_double_with_allocator(values[case_index], &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        result = result && string.valid && strings_match(references[case_index], contents);
+
+        aft_string_destroy(&string.value);
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_double(Test* test)
+{
+    const char* hard_cases[8] =
+    {
+        "2.2250738585072011e-308",
+        "2.4703282292062327208828439643411068618252990130716238221279284125033775364e-324",
+        "4.9406564584124654e-324",
+        "1.7976931348623158e308",
+        "9007199254740993",
+        "9007199254740993.000000000000000000000000000000000000000001",
+        "0.1000000000000000055511151231257827021181583404541015625",
+        "1e-400",
+    };
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 8; case_index += 1)
+    {
+        const char* text = hard_cases[case_index];
+        AftMaybeDouble number = aft_ascii_to_double(aft_string_slice_from_c_string(text));
+        result = result && number.valid && number.value == strtod(text, NULL);
+    }
+
+    for(int case_index = 0; case_index < 10000; case_index += 1)
+    {
+        char text[64];
+        make_random_decimal(&test->generator, text, 64);
+
+        AftMaybeDouble number = aft_ascii_to_double(aft_string_slice_from_c_string(text));
+        double reference = strtod(text, NULL);
+
+        result = result
+                && number.valid
+                && number.value == reference
+                && signbit(number.value) == signbit(reference);
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_double_invalid(Test* test)
+{
+    const char* cases[8] = {"", "-", ".", "e5", "1e", "1e+", "1.2.3", "12 "};
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 8; case_index += 1)
+    {
+        AftMaybeDouble number = aft_ascii_to_double(aft_string_slice_from_c_string(cases[case_index]));
+        result = result && !number.valid;
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_float(Test* test)
+{
+    bool result = true;
+
+    for(int case_index = 0; case_index < 10000; case_index += 1)
+    {
+        char text[64];
+        make_random_decimal(&test->generator, text, 64);
+
+        AftMaybeFloat number = aft_ascii_to_float(aft_string_slice_from_c_string(text));
+        float reference = strtof(text, NULL);
+
+        result = result
+                && number.valid
+                && number.value == reference
+                && signbit(number.value) == signbit(reference);
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_doubles(Test* test)
+{
+    AftDelimitedParseOptions options;
+    options.chunk_size = 0;
+    options.thread_count = 1;
+    options.delimiter = ',';
+
+    AftStringSlice text = aft_string_slice_from_c_string("1.5,-2,abc\r\n3e2,,7\n");
+
+    double values[6];
+    bool valid[6];
+    AftDelimitedParseResult parsed = aft_ascii_to_doubles(text, &options, values, valid, 6);
+
+    const double references[6] = {1.5, -2.0, 0.0, 300.0, 0.0, 7.0};
+    const bool valid_references[6] = {true, true, false, true, false, true};
+
+    bool result = parsed.field_count == 6
+            && parsed.error_count == 2
+            && parsed.first_error == 2;
+
+    for(int value_index = 0; value_index < 6; value_index += 1)
+    {
+        result = result
+                && values[value_index] == references[value_index]
+                && valid[value_index] == valid_references[value_index];
+    }
+
+    AftDelimitedParseResult trailing = aft_ascii_to_doubles(aft_string_slice_from_c_string("1,2,"), &options, values, NULL, 2);
+    result = result
+            && trailing.field_count == 3
+            && trailing.error_count == 0
+            && trailing.first_error == -1
+            && values[0] == 1.0
+            && values[1] == 2.0;
+
+    AftDelimitedParseResult empty = aft_ascii_to_doubles(aft_string_slice_from_c_string(""), &options, values, NULL, 2);
+    result = result && empty.field_count == 0;
+
+    return result;
+}
+
+static bool test_ascii_to_int64s_parallel(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = false;
+
+    AftString text;
+    aft_string_initialise_with_allocator(&text, &test->allocator);
+
+    int64_t references[2000];
+    bool appended = true;
+
+    for(int value_index = 0; value_index < 2000; value_index += 1)
+    {
+        if(value_index > 0)
+        {
+            appended = appended && aft_string_append_char(&text, value_index % 10 ? ';' : '\n');
+        }
+
+        if(value_index % 97 == 5)
+        {
+            references[value_index] = 0;
+            appended = appended && aft_string_append_c_string(&text, "x");
+        }
+        else
+        {
+            uint64_t bits = random_generate(&test->generator);
+            references[value_index] = (int64_t) bits >> random_int_range(&test->generator, 0, 63);
+            appended = appended && aft_string_append_int64(&text, references[value_index], &format);
+        }
+    }
+
+    AftDelimitedParseOptions options;
+    options.chunk_size = 64;
+    options.thread_count = 4;
+    options.delimiter = ';';
+
+    int64_t values[2000];
+    bool valid[2000];
+    AftDelimitedParseResult parsed = aft_ascii_to_int64s(aft_string_slice_from_string(&text), &options, values, valid, 2000);
+
+    bool result = appended
+            && parsed.field_count == 2000
+            && parsed.error_count == 21
+            && parsed.first_error == 5;
+
+    for(int value_index = 0; value_index < 2000; value_index += 1)
+    {
+        result = result
+                && values[value_index] == references[value_index]
+                && valid[value_index] == (value_index % 97 != 5);
+    }
+
+    aft_string_destroy(&text);
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+static bool test_ascii_to_int32(Test* test)
+{
+    const char* texts[8] = {"0", "-0", "+7", "2147483647", "-2147483648", "2147483648", "-2147483649", "12a"};
+    const int32_t values[8] = {0, 0, 7, INT32_MAX, INT32_MIN, 0, 0, 0};
+    const bool valid[8] = {true, true, true, true, true, false, false, false};
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 8; case_index += 1)
+    {
+        AftMaybeInt32 number = aft_ascii_to_int32(aft_string_slice_from_c_string(texts[case_index]));
+        result = result
+                && number.valid == valid[case_index]
+                && (!number.valid || number.value == values[case_index]);
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_int64(Test* test)
+{
+    const char* texts[8] =
+    {
+        "-1",
+        "9223372036854775807",
+        "-9223372036854775808",
+        "0000000000000000000000000000042",
+        "9223372036854775808",
+        "-9223372036854775809",
+        "",
+        "--1",
+    };
+    const int64_t values[8] = {-1, INT64_MAX, INT64_MIN, 42, 0, 0, 0, 0};
+    const bool valid[8] = {true, true, true, true, false, false, false, false};
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 8; case_index += 1)
+    {
+        AftMaybeInt64 number = aft_ascii_to_int64(aft_string_slice_from_c_string(texts[case_index]));
+        result = result
+                && number.valid == valid[case_index]
+                && (!number.valid || number.value == values[case_index]);
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_uint64(Test* test)
+{
+    const char* texts[6] =
+    {
+        "18446744073709551615",
+        "18446744073709551616",
+        "99999999999999999999",
+        "184467440737095516150",
+        "-1",
+        "12345678901234567",
+    };
+    const uint64_t values[6] = {UINT64_MAX, 0, 0, 0, 0, UINT64_C(12345678901234567)};
+    const bool valid[6] = {true, false, false, false, false, true};
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 6; case_index += 1)
+    {
+        AftMaybeUint64 number = aft_ascii_to_uint64(aft_string_slice_from_c_string(texts[case_index]));
+        result = result
+                && number.valid == valid[case_index]
+                && (!number.valid || number.value == values[case_index]);
+    }
+
+    return result;
+}
+
+static bool test_ascii_to_uint64_bases(Test* test)
+{
+    int count;
+    AftMaybeUint64 prefix = aft_ascii_to_uint64_with_base(aft_string_slice_from_c_string("12z"), 10, &count);
+    bool result = prefix.valid && prefix.value == 12 && count == 2;
+
+    AftMaybeUint64 overflow = aft_ascii_to_uint64_with_base(aft_string_slice_from_c_string("10000000000000000"), 16, &count);
+    result = result && !overflow.valid && count == 17;
+
+    AftMaybeUint64 empty = aft_ascii_to_uint64_with_base(aft_string_slice_from_c_string("+g"), 16, &count);
+    result = result && !empty.valid && count == 0;
+
+    for(int case_index = 0; case_index < 1000; case_index += 1)
+    {
+        AftBaseFormat format;
+        format.base = random_int_range(&test->generator, 2, 36);
+        format.use_uppercase = random_int_range(&test->generator, 0, 1);
+
+        uint64_t value = random_generate(&test->generator) >> random_int_range(&test->generator, 0, 63);
+
+        AftMaybeString string = aft_ascii_from_uint64_with_allocator(value, &format, &test->allocator);
+        AftStringSlice slice = aft_string_slice_from_string(&string.value);
+        AftMaybeUint64 number = aft_ascii_to_uint64_with_base(slice, format.base, &count);
+
+        result = result
+                && string.valid
+                && number.valid
+                && number.value == value
+                && count == aft_string_slice_count(slice);
+
+        aft_string_destroy(&string.value);
+    }
+
+    return result;
+}
+
+static bool test_bases(Test* test)
+{
+    const uint64_t values[4] = {0, 5, UINT64_C(1000000000000000), UINT64_MAX};
+    const int bases[4] = {2, 8, 10, 36};
+    const char* references[16] =
+    {
+        "0", "0", "0", "0",
+        "101", "5", "5", "5",
+        "11100011010111111010100100110001101000000000000000", "34327724461500000", "1000000000000000", "9ugxnorjls",
+        "1111111111111111111111111111111111111111111111111111111111111111", "1777777777777777777777", "18446744073709551615", "3w5e11264sgsf",
+    };
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 16; case_index += 1)
+    {
+        AftBaseFormat format =
+        {
+            .base = bases[case_index % 4],
+            .use_uppercase = false,
+        };
+        uint64_t value = values[case_index / 4];
+        AftMaybeString string = aft_ascii_from_uint64_with_allocator(value, &format, &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        result = result && string.valid && strings_match(references[case_index], contents);
+
+        aft_string_destroy(&string.value);
+    }
+
+    return result;
+}
+
+static bool test_buffer(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.use_grouping = true;
+
+    char buffer[16];
+
+    AftMaybeInt int_count = aft_int64_to_buffer(-1234567, &format, buffer, 10);
+    bool result = int_count.valid
+            && int_count.value == 10
+            && aft_string_slice_matches(aft_string_slice_from_c_string("-1,234,567"), aft_string_slice_from_buffer(buffer, int_count.value))
+            && !aft_int64_to_buffer(-1234567, &format, buffer, 9).valid
+            && !aft_uint64_to_buffer(0, &format, NULL, 0).valid;
+
+    AftMaybeInt double_count = aft_double_to_buffer(-0.125, &format, buffer, 16);
+    result = result
+            && double_count.valid
+            && aft_string_slice_matches(aft_string_slice_from_c_string("-0.125"), aft_string_slice_from_buffer(buffer, double_count.value))
+            && !aft_double_to_buffer(-0.125, &format, buffer, 5).valid;
+
+    AftMaybeInt float_count = aft_float_to_buffer(2.5f, &format, buffer, 16);
+    result = result
+            && float_count.valid
+            && aft_string_slice_matches(aft_string_slice_from_c_string("2.5"), aft_string_slice_from_buffer(buffer, float_count.value));
+
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+static bool test_compiled(Test* test)
+{
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.use_grouping = true;
+    format.min_fraction_digits = 2;
+
+    AftCompiledDecimalFormat compiled;
+    bool compiled_valid = aft_decimal_format_compile_with_allocator(&compiled, &format, &test->allocator);
+    ASSERT(compiled_valid);
+
+    // The compiled form stands on its own, so the format can go first.
+    aft_decimal_format_destroy(&format);
+
+    AftString string;
+    aft_string_initialise_with_allocator(&string, &test->allocator);
+
+    bool result = aft_string_append_int64_compiled(&string, -1234567, &compiled)
+            && aft_string_append_c_string(&string, " ")
+            && aft_string_append_uint64_compiled(&string, 0, &compiled)
+            && strings_match("-1,234,567.00 0.00", aft_string_get_contents_const(&string))
+            && compiled.ascii_digits
+            && compiled.min_count <= 4
+            && compiled.max_count >= 30;
+
+    aft_string_destroy(&string);
+    aft_compiled_decimal_format_destroy(&compiled);
+
+    return result;
+}
+
+static void set_format_variant(AftDecimalFormat* format, int variant)
+{
+    switch(variant)
+    {
+        case 1:
+        {
+            format->use_grouping = true;
+            break;
+        }
+        case 2:
+        {
+            format->use_grouping = true;
+            format->secondary_grouping_size = 2;
+            break;
+        }
+        case 3:
+        {
+            format->use_grouping = true;
+            format->min_integer_digits = 30;
+            break;
+        }
+        case 4:
+        {
+            format->use_grouping = true;
+            format->max_integer_digits = 4;
+            break;
+        }
+        case 5:
+        {
+            format->use_grouping = true;
+            format->use_significant_digits = true;
+            format->max_significant_digits = 3;
+            format->min_significant_digits = 3;
+            break;
+        }
+        case 6:
+        {
+            format->min_fraction_digits = 2;
+            break;
+        }
+        case 7:
+        {
+            format->style = AFT_DECIMAL_FORMAT_STYLE_SCIENTIFIC;
+            format->max_fraction_digits = 4;
+            break;
+        }
+        case 8:
+        {
+            format->style = AFT_DECIMAL_FORMAT_STYLE_PERCENT;
+            format->percent.multiplier = 100;
+            format->use_grouping = true;
+            bool appended = aft_string_append_c_string(&format->positive_suffix_pattern, u8"‰%");
+            ASSERT(appended);
+            break;
+        }
+        case 9:
+        {
+            format->use_grouping = true;
+            format->use_explicit_plus_sign = true;
+
+            for(int digit = 0; digit < 10; digit += 1)
+            {
+                AftString* symbol = &format->symbols.digits[digit];
+                aft_string_remove(symbol, 0, aft_string_get_count(symbol));
+                bool appended = aft_utf8_append_codepoint(symbol, U'٠' + digit);
+                ASSERT(appended);
+            }
+            break;
+        }
+    }
+}
+
+static bool test_compiled_matches(Test* test)
+{
+    const int64_t values[10] =
+    {
+        0, 7, -7, 42, 1000, -123456, 99999999, INT64_C(1234567890123),
+        INT64_MAX, INT64_MIN + 1,
+    };
+
+    bool result = true;
+
+    for(int variant = 0; variant < 10; variant += 1)
+    {
+        AftDecimalFormat format;
+        bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+        ASSERT(defaulted);
+
+        set_format_variant(&format, variant);
+
+        AftCompiledDecimalFormat compiled;
+        bool compiled_valid = aft_decimal_format_compile_with_allocator(&compiled, &format, &test->allocator);
+        ASSERT(compiled_valid);
+
+        result = result && (compiled.ascii_digits == (variant != 9));
+
+        AftString string;
+        aft_string_initialise_with_allocator(&string, &test->allocator);
+
+        for(int value_index = 0; value_index < 10; value_index += 1)
+        {
+            int64_t value = values[value_index];
+            AftMaybeString reference = aft_string_from_int64_with_allocator(value, &format, &test->allocator);
+
+            aft_string_remove(&string, 0, aft_string_get_count(&string));
+            bool appended = aft_string_append_int64_compiled(&string, value, &compiled);
+
+            int count = aft_string_get_count(&string);
+            result = result
+                    && reference.valid
+                    && appended
+                    && aft_strings_match(&reference.value, &string)
+                    && count >= compiled.min_count
+                    && count <= compiled.max_count;
+
+            aft_string_destroy(&reference.value);
+        }
+
+        aft_string_destroy(&string);
+        aft_compiled_decimal_format_destroy(&compiled);
+        aft_decimal_format_destroy(&format);
+    }
+
+    return result;
+}
 
 static bool test_default(Test* test)
 {
@@ -418,6 +1193,120 @@ static bool test_hexadecimal(Test* test)
     return result;
 }
 
+static bool test_max_count(Test* test)
+{
+    const int64_t integers[4] = {0, -7, INT64_MAX, INT64_MIN};
+    const double doubles[9] =
+    {
+        0.0, -1234.5678, DBL_MAX, -DBL_MAX, DBL_MIN, 4.9406564584124654e-324,
+        INFINITY, -INFINITY, NAN,
+    };
+
+    bool result = true;
+
+    for(int variant = 0; variant < 10; variant += 1)
+    {
+        AftDecimalFormat format;
+        bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+        ASSERT(defaulted);
+
+        set_format_variant(&format, variant);
+
+        if(variant == 4)
+        {
+            format.max_fraction_digits = 40;
+        }
+        else if(variant == 6 || variant == 7)
+        {
+            format.max_fraction_digits = AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+        }
+
+        AftCompiledDecimalFormat compiled;
+        bool compiled_valid = aft_decimal_format_compile_with_allocator(&compiled, &format, &test->allocator);
+        ASSERT(compiled_valid);
+
+        char buffer[2048];
+        int int_max_count = aft_decimal_format_get_max_count(&format, AFT_FORMAT_TYPE_INT64);
+        int double_max_count = aft_decimal_format_get_max_count(&format, AFT_FORMAT_TYPE_DOUBLE);
+        ASSERT(double_max_count <= 2048);
+
+        result = result
+                && int_max_count == compiled.max_count
+                && int_max_count == aft_decimal_format_get_max_count(&format, AFT_FORMAT_TYPE_UINT64)
+                && aft_uint64_to_buffer(UINT64_MAX, &format, buffer, int_max_count).valid;
+
+        for(int value_index = 0; value_index < 4; value_index += 1)
+        {
+            result = result && aft_int64_to_buffer(integers[value_index], &format, buffer, int_max_count).valid;
+        }
+
+        for(int value_index = 0; value_index < 9; value_index += 1)
+        {
+            result = result
+                    && aft_double_to_buffer(doubles[value_index], &format, buffer, double_max_count).valid
+                    && aft_float_to_buffer((float) doubles[value_index], &format, buffer, double_max_count).valid;
+        }
+
+        aft_compiled_decimal_format_destroy(&compiled);
+        aft_decimal_format_destroy(&format);
+    }
+
+    return result;
+}
+
+// Grouped fixed-point formats without a fraction digit limit are the longest,
+// so check the extremes fit in a buffer of exactly the most bytes reported.
+static bool test_max_count_double_extremes(Test* test)
+{
+    const double doubles[8] =
+    {
+        DBL_MAX, -DBL_MAX, 1e300, -1e300, DBL_MIN, -1e-300,
+        4.9406564584124654e-324, -2.1191390537329942e-310,
+    };
+    const int max_integer_digits[3] = {8, 42, 400};
+    const int min_integer_digits[2] = {1, 30};
+
+    bool result = true;
+
+    for(int variant = 0; variant < 12; variant += 1)
+    {
+        AftDecimalFormat format;
+        bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+        ASSERT(defaulted);
+
+        format.max_fraction_digits = AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+        format.max_integer_digits = max_integer_digits[variant % 3];
+        format.min_integer_digits = min_integer_digits[(variant / 3) % 2];
+        format.secondary_grouping_size = variant < 6 ? 3 : 2;
+        format.use_grouping = true;
+
+        if(format.min_integer_digits > format.max_integer_digits)
+        {
+            format.min_integer_digits = format.max_integer_digits;
+        }
+
+        char buffer[2048];
+        int max_count = aft_decimal_format_get_max_count(&format, AFT_FORMAT_TYPE_DOUBLE);
+        ASSERT(max_count <= 2048);
+
+        for(int value_index = 0; value_index < 8; value_index += 1)
+        {
+            AftMaybeString string = aft_string_from_double_with_allocator(doubles[value_index], &format, &test->allocator);
+
+            result = result
+                    && string.valid
+                    && aft_string_get_count(&string.value) <= max_count
+                    && aft_double_to_buffer(doubles[value_index], &format, buffer, max_count).valid;
+
+            aft_string_destroy(&string.value);
+        }
+
+        aft_decimal_format_destroy(&format);
+    }
+
+    return result;
+}
+
 static bool test_max_fraction_digits_double(Test* test)
 {
     const double value = 0.00000000000078904;
@@ -493,6 +1382,37 @@ static bool test_max_integer_digits_double(Test* test)
     return result;
 }
 
+static bool test_max_integer_digits_double_big(Test* test)
+{
+    const double values[3] = {1e300, -1e300, DBL_MAX};
+    const char* references[3] = {"00,000,000", "-00,000,000", "00,000,000"};
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.max_integer_digits = 8;
+    format.max_fraction_digits = AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+    format.use_grouping = true;
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 3; case_index += 1)
+    {
+        AftMaybeString string = aft_string_from_double_with_allocator(values[case_index], &format, &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        bool contents_match = strings_match(references[case_index], contents);
+        result = result && string.valid && contents_match;
+
+        aft_string_destroy(&string.value);
+    }
+
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
 static bool test_max_significant_digits(Test* test)
 {
     const int value = 123456789;
@@ -1004,6 +1924,38 @@ static bool test_round_half_even_double(Test* test)
     return result;
 }
 
+static bool test_round_half_even_double_ties(Test* test)
+{
+    const double values[8] = {0.125, 0.375, 2.5, 3.5, 0.15, 1234567.5, -0.0625, 9.995};
+    const int fraction_digits[8] = {2, 2, 0, 0, 1, 0, 3, 2};
+    const char* references[8] = {"0.12", "0.38", "2", "4", "0.1", "1234568", "-0.062", "9.99"};
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = false;
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 8; case_index += 1)
+    {
+        format.max_fraction_digits = fraction_digits[case_index];
+
+        AftMaybeString string = aft_string_from_double_with_allocator(values[case_index], &format, &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        result = result
+                && string.valid
+                && strings_match(references[case_index], contents);
+
+        aft_string_destroy(&string.value);
+    }
+
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
 static bool test_round_half_even_int(Test* test)
 {
     const int values[9] = {20, 24, 28, 32, 0, -20, -24, -28, -32};
@@ -1160,10 +2112,129 @@ static bool test_round_up_int(Test* test)
     return result;
 }
 
+static bool test_scientific_double_subnormal(Test* test)
+{
+    const double values[3] = {2.1191390537329942e-310, -4.9406564584124654e-324, 0.0};
+    const char* references[3] = {"2.1191E-310", "-4.9407E-324", "0E0"};
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_scientific_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+
+    format.use_significant_digits = true;
+    format.min_significant_digits = 1;
+    format.max_significant_digits = 5;
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 3; case_index += 1)
+    {
+        AftMaybeString string = aft_string_from_double_with_allocator(values[case_index], &format, &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        bool contents_match = strings_match(references[case_index], contents);
+        result = result && string.valid && contents_match;
+
+        aft_string_destroy(&string.value);
+    }
+
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
+static bool test_shortest_double(Test* test)
+{
+    const double values[4] = {1234.5678, 0.1 + 0.2, 1e-10, 1e22};
+    const char* references[4] = {"1,234.5678", "0.30000000000000004", "0.0000000001", "10,000,000,000,000,000,000,000"};
+    const char* scientific_references[4] = {"1.2345678E3", "3.0000000000000004E-1", "1E-10", "1E22"};
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+    format.use_grouping = true;
+    format.max_fraction_digits = AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+
+    AftDecimalFormat scientific;
+    defaulted = aft_decimal_format_default_scientific_with_allocator(&scientific, &test->allocator);
+    ASSERT(defaulted);
+    scientific.max_fraction_digits = AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 4; case_index += 1)
+    {
+        AftMaybeString string = aft_string_from_double_with_allocator(values[case_index], &format, &test->allocator);
+        AftMaybeString scientific_string = aft_string_from_double_with_allocator(values[case_index], &scientific, &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        const char* scientific_contents = aft_string_get_contents_const(&scientific_string.value);
+        result = result
+                && string.valid
+                && scientific_string.valid
+                && strings_match(references[case_index], contents)
+                && strings_match(scientific_references[case_index], scientific_contents);
+
+        aft_string_destroy(&string.value);
+        aft_string_destroy(&scientific_string.value);
+    }
+
+    aft_decimal_format_destroy(&format);
+    aft_decimal_format_destroy(&scientific);
+
+    return result;
+}
+
+static bool test_shortest_float(Test* test)
+{
+    const float values[3] = {0.1f, 16777216.0f, FLT_MAX};
+    const char* references[3] = {"0.1", "16777216", "340282350000000000000000000000000000000"};
+
+    AftDecimalFormat format;
+    bool defaulted = aft_decimal_format_default_with_allocator(&format, &test->allocator);
+    ASSERT(defaulted);
+    format.max_fraction_digits = AFT_DECIMAL_FORMAT_NO_DIGIT_LIMIT;
+
+    bool result = true;
+
+    for(int case_index = 0; case_index < 3; case_index += 1)
+    {
+        AftMaybeString string = aft_string_from_float_with_allocator(values[case_index], &format, &test->allocator);
+
+        const char* contents = aft_string_get_contents_const(&string.value);
+        result = result && string.valid && strings_match(references[case_index], contents);
+
+        aft_string_destroy(&string.value);
+    }
+
+    aft_decimal_format_destroy(&format);
+
+    return result;
+}
+
 int main(int argc, const char** argv)
 {
     Suite suite = {0};
 
+    add_test(&suite, test_append_format, "Test Append Format");
+    add_test(&suite, test_append_format_invalid, "Test Append Format Invalid");
+    add_test(&suite, test_append_number, "Test Append Number");
+    add_test(&suite, test_append_numbers, "Test Append Numbers");
+    add_test(&suite, test_append_numbers_parallel, "Test Append Numbers Parallel");
+    add_test(&suite, test_ascii_double, "Test ASCII double");
+    add_test(&suite, test_ascii_to_double, "Test ASCII To double");
+    add_test(&suite, test_ascii_to_double_invalid, "Test ASCII To double Invalid");
+    add_test(&suite, test_ascii_to_doubles, "Test ASCII To doubles");
+    add_test(&suite, test_ascii_to_float, "Test ASCII To float");
+    add_test(&suite, test_ascii_to_int32, "Test ASCII To int32_t");
+    add_test(&suite, test_ascii_to_int64, "Test ASCII To int64_t");
+    add_test(&suite, test_ascii_to_int64s_parallel, "Test ASCII To int64_t Array Parallel");
+    add_test(&suite, test_ascii_to_uint64, "Test ASCII To uint64_t");
+    add_test(&suite, test_ascii_to_uint64_bases, "Test ASCII To uint64_t Bases");
+    add_test(&suite, test_bases, "Test Bases");
+    add_test(&suite, test_buffer, "Test Buffer");
+    add_test(&suite, test_compiled, "Test Compiled");
+    add_test(&suite, test_compiled_matches, "Test Compiled Matches");
     add_test(&suite, test_default, "Test Default");
     add_test(&suite, test_default_double, "Test Default double");
     add_test(&suite, test_default_double_big, "Test Default double Big");
@@ -1184,9 +2255,12 @@ int main(int argc, const char** argv)
     add_test(&suite, test_double_max, "Test double Max");
     add_test(&suite, test_group_double, "Test Group Double");
     add_test(&suite, test_hexadecimal, "Test Hexadecimal");
+    add_test(&suite, test_max_count, "Test Max Count");
+    add_test(&suite, test_max_count_double_extremes, "Test Max Count double Extremes");
     add_test(&suite, test_max_fraction_digits_double, "Test Max Fraction Digits double");
     add_test(&suite, test_max_integer_digits, "Test Max Integer Digits");
     add_test(&suite, test_max_integer_digits_double, "Test Max Integer Digits double");
+    add_test(&suite, test_max_integer_digits_double_big, "Test Max Integer Digits double Big");
     add_test(&suite, test_max_significant_digits, "Test Max Significant Digits");
     add_test(&suite, test_min_fraction_digits, "Test Min Fraction Digits");
     add_test(&suite, test_min_fraction_digits_double, "Test Min Fraction Digits double");
@@ -1205,11 +2279,16 @@ int main(int argc, const char** argv)
     add_test(&suite, test_round_half_down_double, "Test Round Half Down double");
     add_test(&suite, test_round_half_down_int, "Test Round Half Down int");
     add_test(&suite, test_round_half_even_double, "Test Round Half Even double");
+    add_test(&suite, test_round_half_even_double_ties, "Test Round Half Even double Ties");
     add_test(&suite, test_round_half_even_int, "Test Round Half Even int");
     add_test(&suite, test_round_half_up_double, "Test Round Half Up double");
     add_test(&suite, test_round_half_up_int, "Test Round Half Up int");
     add_test(&suite, test_round_up_double, "Test Round Up double");
     add_test(&suite, test_round_up_int, "Test Round Up int");
+    add_test(&suite, test_scientific_double_subnormal, "Test Scientific double Subnormal");
+
+    add_test(&suite, test_shortest_double, "Test Shortest double");
+    add_test(&suite, test_shortest_float, "Test Shortest float");
 
     bool success = run_tests(&suite);
     return !success;
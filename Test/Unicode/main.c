@@ -0,0 +1,546 @@
+#include "../Utility/test.h"
+
+#include <AftString/aft_unicode.h>
+
+static bool test_alphabetic(Test* test)
+{
+    (void) test;
+
+    return aft_unicode_is_alphabetic(U'a')
+            && aft_unicode_is_alphabetic(U'ß')
+            && aft_unicode_is_alphabetic(U'猫')
+            && aft_unicode_is_alphabetic(U'ͅ')
+            && aft_unicode_is_alphabetic(U'Ⅻ')
+            && !aft_unicode_is_alphabetic(U'1')
+            && !aft_unicode_is_alphabetic(U'́')
+            && !aft_unicode_is_alphabetic(U'🍌')
+            && aft_unicode_is_alphanumeric(U'٣')
+            && !aft_unicode_is_alphanumeric(U'_');
+}
+
+static bool test_category(Test* test)
+{
+    (void) test;
+
+    return aft_unicode_get_category(U'A') == AFT_UNICODE_CATEGORY_UPPERCASE_LETTER
+            && aft_unicode_get_category(U'ǅ') == AFT_UNICODE_CATEGORY_TITLECASE_LETTER
+            && aft_unicode_get_category(U'́') == AFT_UNICODE_CATEGORY_NONSPACING_MARK
+            && aft_unicode_get_category(U'٣') == AFT_UNICODE_CATEGORY_DECIMAL_NUMBER
+            && aft_unicode_get_category(U'«') == AFT_UNICODE_CATEGORY_INITIAL_PUNCTUATION
+            && aft_unicode_get_category(U'€') == AFT_UNICODE_CATEGORY_CURRENCY_SYMBOL
+            && aft_unicode_get_category(U' ') == AFT_UNICODE_CATEGORY_LINE_SEPARATOR
+            && aft_unicode_get_category(U'​') == AFT_UNICODE_CATEGORY_FORMAT
+            && aft_unicode_get_category(0xe000) == AFT_UNICODE_CATEGORY_PRIVATE_USE
+            && aft_unicode_get_category(0x0378) == AFT_UNICODE_CATEGORY_UNASSIGNED
+            && aft_unicode_get_category(0x20000) == AFT_UNICODE_CATEGORY_OTHER_LETTER
+            && aft_unicode_get_category(0x110000) == AFT_UNICODE_CATEGORY_UNASSIGNED
+            && aft_unicode_is_letter(U'猫')
+            && aft_unicode_is_lowercase(U'ж')
+            && aft_unicode_is_mark(U'⃝')
+            && aft_unicode_is_punctuation(U'、')
+            && aft_unicode_is_uppercase(U'Ж');
+}
+
+static bool test_classify(Test* test)
+{
+    (void) test;
+
+    AftStringSlice slice = aft_string_slice_from_c_string(u8"a 猫　٣!");
+    uint8_t classes[16];
+
+    AftMaybeInt count = aft_unicode_classify(slice, classes, 16);
+
+    return count.valid
+            && count.value == 6
+            && classes[0] == (AFT_UNICODE_CATEGORY_LOWERCASE_LETTER | AFT_UNICODE_CLASS_ALPHABETIC)
+            && classes[1] == (AFT_UNICODE_CATEGORY_SPACE_SEPARATOR | AFT_UNICODE_CLASS_WHITESPACE)
+            && classes[2] == (AFT_UNICODE_CATEGORY_OTHER_LETTER | AFT_UNICODE_CLASS_ALPHABETIC)
+            && classes[3] == (AFT_UNICODE_CATEGORY_SPACE_SEPARATOR | AFT_UNICODE_CLASS_WHITESPACE)
+            && classes[4] == AFT_UNICODE_CATEGORY_DECIMAL_NUMBER
+            && classes[5] == AFT_UNICODE_CATEGORY_OTHER_PUNCTUATION;
+}
+
+static bool test_classify_invalid(Test* test)
+{
+    (void) test;
+
+    uint8_t classes[16];
+
+    AftStringSlice invalid = aft_string_slice_from_c_string("ab\xff" "cd");
+    AftMaybeInt stopped = aft_unicode_classify(invalid, classes, 16);
+
+    AftStringSlice long_slice = aft_string_slice_from_c_string("abcdefgh");
+    AftMaybeInt full = aft_unicode_classify(long_slice, classes, 4);
+
+    return !stopped.valid
+            && stopped.value == 2
+            && !full.valid
+            && full.value == 4;
+}
+
+static bool test_equals_folded(Test* test)
+{
+    (void) test;
+
+    AftStringSlice a = aft_string_slice_from_c_string(u8"Straße KELVIN");
+    AftStringSlice b = aft_string_slice_from_c_string(u8"STRASSE Kelvin");
+    AftStringSlice c = aft_string_slice_from_c_string(u8"Strasse Kelvi");
+    AftStringSlice d = aft_string_slice_from_c_string(u8"ΣΊΣΥΦΟΣ");
+    AftStringSlice e = aft_string_slice_from_c_string(u8"σίσυφος");
+
+    return aft_utf8_equals_folded(a, b)
+            && !aft_utf8_equals_folded(a, c)
+            && !aft_utf8_equals_folded(c, a)
+            && aft_utf8_equals_folded(d, e);
+}
+
+static bool test_equals_folded_long(Test* test)
+{
+    (void) test;
+
+    AftStringSlice a = aft_string_slice_from_c_string(
+            u8"THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG ÆØÅ the quick brown fox jumps over the lazy dog");
+    AftStringSlice b = aft_string_slice_from_c_string(
+            u8"the quick brown fox jumps over the lazy dog æøå THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG");
+    AftStringSlice c = aft_string_slice_from_c_string(
+            u8"the quick brown fox jumps over the lazy cog æøå THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG");
+
+    return aft_utf8_equals_folded(a, b)
+            && !aft_utf8_equals_folded(a, c);
+}
+
+static bool test_find_folded(Test* test)
+{
+    (void) test;
+
+    AftStringSlice haystack = aft_string_slice_from_c_string(
+            u8"Over the lazy dog, the quick brown fox jumps over STRASSE and Maße");
+    AftStringSlice fox = aft_string_slice_from_c_string("QUICK BROWN FOX");
+    AftStringSlice strasse = aft_string_slice_from_c_string(u8"straße");
+    AftStringSlice mass = aft_string_slice_from_c_string("MASSE");
+    AftStringSlice mas = aft_string_slice_from_c_string("MAS");
+    AftStringSlice missing = aft_string_slice_from_c_string("slow");
+    AftStringSlice empty = aft_string_slice_from_c_string("");
+
+    AftMaybeInt found_fox = aft_utf8_find_folded(haystack, fox);
+    AftMaybeInt found_strasse = aft_utf8_find_folded(haystack, strasse);
+    AftMaybeInt found_mass = aft_utf8_find_folded(haystack, mass);
+    AftMaybeInt found_mas = aft_utf8_find_folded(haystack, mas);
+    AftMaybeInt found_missing = aft_utf8_find_folded(haystack, missing);
+    AftMaybeInt found_empty = aft_utf8_find_folded(haystack, empty);
+
+    return found_fox.valid && found_fox.value == 23
+            && found_strasse.valid && found_strasse.value == 50
+            && found_mass.valid && found_mass.value == 62
+            && !found_mas.valid
+            && !found_missing.valid
+            && found_empty.valid && found_empty.value == 0;
+}
+
+static bool test_fold_case(Test* test)
+{
+    AftString folded;
+    aft_string_initialise_with_allocator(&folded, &test->allocator);
+
+    AftStringSlice slice = aft_string_slice_from_c_string(
+            u8"Große ΣΊΣΥΦΟΣ in THE QUICK BROWN FOX, ŉ and ǰ");
+
+    bool result = aft_utf8_fold_case(&folded, slice, AFT_CASE_FOLDING_FULL);
+    result = result && strings_match(aft_string_get_contents_const(&folded),
+            u8"grosse σίσυφοσ in the quick brown fox, ʼn and j\xcc\x8c");
+
+    aft_string_remove(&folded, 0, aft_string_get_count(&folded));
+
+    result = result && aft_utf8_fold_case(&folded, slice, AFT_CASE_FOLDING_SIMPLE);
+    result = result && strings_match(aft_string_get_contents_const(&folded),
+            u8"große σίσυφοσ in the quick brown fox, ŉ and ǰ");
+
+    aft_string_destroy(&folded);
+
+    return result;
+}
+
+static bool test_fold_case_codepoint(Test* test)
+{
+    (void) test;
+
+    char32_t folded[AFT_CASE_FOLD_MAX];
+    int count = aft_unicode_fold_case_full(U'ΐ', folded);
+
+    return count == 3
+            && folded[0] == U'ι'
+            && folded[1] == 0x308
+            && folded[2] == 0x301
+            && aft_unicode_fold_case_full(U'A', folded) == 1
+            && folded[0] == U'a'
+            && aft_unicode_fold_case_simple(U'ẞ') == U'ß'
+            && aft_unicode_fold_case_simple(U'ß') == U'ß'
+            && aft_unicode_fold_case_simple(0x10400) == 0x10428
+            && aft_unicode_fold_case_simple(U'猫') == U'猫';
+}
+
+static bool test_grapheme_iterator(Test* test)
+{
+    (void) test;
+
+    const char* expected[] =
+    {
+        u8"e\xcc\x81",
+        u8"\r\n",
+        u8"\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7",
+        u8"🇯🇵",
+        u8"🇰🇷",
+        u8"\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd",
+        u8"\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab",
+        u8"नि",
+        u8"x",
+        "\xff",
+    };
+    const int expected_count = sizeof(expected) / sizeof(*expected);
+
+    AftString text;
+    aft_string_initialise_with_allocator(&text, &test->allocator);
+
+    bool result = true;
+
+    for(int cluster_index = 0; cluster_index < expected_count; cluster_index += 1)
+    {
+        result = result && aft_string_append_c_string(&text, expected[cluster_index]);
+    }
+
+    AftGraphemeIterator it;
+    aft_grapheme_iterator_set_string(&it, aft_string_slice_from_string(&text));
+
+    for(int cluster_index = 0; cluster_index < expected_count; cluster_index += 1)
+    {
+        AftMaybeStringSlice cluster = aft_grapheme_iterator_next(&it);
+        AftStringSlice expected_cluster = aft_string_slice_from_c_string(expected[cluster_index]);
+        result = result && cluster.valid && aft_string_slice_matches(cluster.value, expected_cluster);
+    }
+
+    result = result && !aft_grapheme_iterator_next(&it).valid;
+
+    aft_string_destroy(&text);
+
+    return result;
+}
+
+static bool test_grapheme_iterator_ascii(Test* test)
+{
+    (void) test;
+
+    AftStringSlice slice = aft_string_slice_from_c_string("ab\r\n c\n");
+
+    AftGraphemeIterator it;
+    aft_grapheme_iterator_set_string(&it, slice);
+
+    AftMaybeStringSlice clusters[6];
+
+    for(int cluster_index = 0; cluster_index < 6; cluster_index += 1)
+    {
+        clusters[cluster_index] = aft_grapheme_iterator_next(&it);
+    }
+
+    return clusters[0].valid
+            && aft_string_slice_count(clusters[0].value) == 1
+            && clusters[1].valid
+            && aft_string_slice_count(clusters[1].value) == 1
+            && clusters[2].valid
+            && aft_string_slice_count(clusters[2].value) == 2
+            && clusters[3].valid
+            && aft_string_slice_count(clusters[3].value) == 1
+            && clusters[4].valid
+            && aft_string_slice_count(clusters[4].value) == 1
+            && clusters[5].valid
+            && aft_string_slice_count(clusters[5].value) == 1
+            && !aft_grapheme_iterator_next(&it).valid;
+}
+
+static bool test_normalize_already_normalized(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice slice = aft_string_slice_from_c_string(
+            u8"The quick brown fox jumps over the lazy dog. Café, 한국어");
+
+    AftMaybeStringSlice nfc = aft_utf8_normalize_nfc(slice, &buffer);
+
+    AftStringSlice decomposed = aft_string_slice_from_c_string(u8"Cafe\xcc\x81");
+    AftMaybeStringSlice nfd = aft_utf8_normalize_nfd(decomposed, &buffer);
+
+    bool result = nfc.valid
+            && aft_string_slice_start(nfc.value) == aft_string_slice_start(slice)
+            && aft_string_slice_count(nfc.value) == aft_string_slice_count(slice)
+            && nfd.valid
+            && aft_string_slice_start(nfd.value) == aft_string_slice_start(decomposed)
+            && aft_string_get_count(&buffer) == 0;
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+static bool test_normalize_hangul(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice composed = aft_string_slice_from_c_string(u8"한글");
+    AftStringSlice decomposed = aft_string_slice_from_c_string(
+            u8"\u1112\u1161\u11ab\u1100\u1173\u11af");
+
+    AftMaybeStringSlice nfd = aft_utf8_normalize_nfd(composed, &buffer);
+    bool result = nfd.valid && aft_string_slice_matches(nfd.value, decomposed);
+
+    AftMaybeStringSlice nfc = aft_utf8_normalize_nfc(decomposed, &buffer);
+    result = result && nfc.valid && aft_string_slice_matches(nfc.value, composed);
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+static bool test_normalize_invalid(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice slice = aft_string_slice_from_c_string("e\xcc\x81 and \xff");
+
+    bool result = !aft_utf8_normalize_nfc(slice, &buffer).valid
+            && !aft_utf8_normalize_nfd(slice, &buffer).valid
+            && aft_string_get_count(&buffer) == 0;
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+// The run of marks is longer than fits inline, and has to be put in order as
+// a whole rather than in pieces.
+static bool test_normalize_long_mark_run(Test* test)
+{
+    AftString input;
+    AftString expected_nfc;
+    AftString expected_nfd;
+    AftString buffer;
+    aft_string_initialise_with_allocator(&input, &test->allocator);
+    aft_string_initialise_with_allocator(&expected_nfc, &test->allocator);
+    aft_string_initialise_with_allocator(&expected_nfd, &test->allocator);
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice acute = aft_string_slice_from_c_string(u8"\u0301");
+    AftStringSlice grave_below = aft_string_slice_from_c_string(u8"\u0316");
+
+    bool built = aft_string_append_c_string(&input, "a")
+            && aft_string_append_repeated(&input, acute, 40)
+            && aft_string_append_repeated(&input, grave_below, 40)
+            && aft_string_append_c_string(&expected_nfc, u8"\u00e1")
+            && aft_string_append_repeated(&expected_nfc, grave_below, 40)
+            && aft_string_append_repeated(&expected_nfc, acute, 39)
+            && aft_string_append_c_string(&expected_nfd, "a")
+            && aft_string_append_repeated(&expected_nfd, grave_below, 40)
+            && aft_string_append_repeated(&expected_nfd, acute, 40);
+    ASSERT(built);
+
+    AftStringSlice slice = aft_string_slice_from_string(&input);
+    AftMaybeStringSlice nfc = aft_utf8_normalize_nfc(slice, &buffer);
+    bool result = nfc.valid
+            && aft_string_slice_matches(nfc.value, aft_string_slice_from_string(&expected_nfc));
+
+    AftMaybeStringSlice nfd = aft_utf8_normalize_nfd(slice, &buffer);
+    result = result
+            && nfd.valid
+            && aft_string_slice_matches(nfd.value, aft_string_slice_from_string(&expected_nfd));
+
+    aft_string_destroy(&input);
+    aft_string_destroy(&expected_nfc);
+    aft_string_destroy(&expected_nfd);
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+// These have codepoints which only maybe stay the same under composition, but
+// are already composed, so they should come back without a copy.
+static bool test_normalize_maybe(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    const char* composed[3] =
+    {
+        u8"x\u0301",
+        u8"\u0995\u09be",
+        u8"Plenty of plain text first, then x\u0301 and more after.",
+    };
+
+    bool result = true;
+
+    for(int string_index = 0; result && string_index < 3; string_index += 1)
+    {
+        AftStringSlice slice = aft_string_slice_from_c_string(composed[string_index]);
+        AftMaybeStringSlice nfc = aft_utf8_normalize_nfc(slice, &buffer);
+
+        result = nfc.valid
+                && aft_string_slice_start(nfc.value) == aft_string_slice_start(slice)
+                && aft_string_slice_count(nfc.value) == aft_string_slice_count(slice)
+                && aft_string_get_count(&buffer) == 0;
+    }
+
+    AftStringSlice uncomposed = aft_string_slice_from_c_string(u8"\u09c7\u09be and e\u0301");
+    AftMaybeStringSlice nfc = aft_utf8_normalize_nfc(uncomposed, &buffer);
+    result = result
+            && nfc.valid
+            && aft_string_slice_matches(nfc.value, aft_string_slice_from_c_string(u8"\u09cb and \u00e9"));
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+static bool test_normalize_nfc(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice slice = aft_string_slice_from_c_string(
+            u8"Cafe\xcc\x81 A\xcc\x8a\xe2\x84\xab q\xcc\xa3\xcc\x87 \xe1\xb9\xa9 \xcd\xb4");
+
+    AftMaybeStringSlice nfc = aft_utf8_normalize_nfc(slice, &buffer);
+    AftStringSlice expected = aft_string_slice_from_c_string(
+            u8"Café ÅÅ q\xcc\xa3\xcc\x87 ṩ ʹ");
+
+    bool result = nfc.valid && aft_string_slice_matches(nfc.value, expected);
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+static bool test_normalize_nfd(Test* test)
+{
+    AftString buffer;
+    aft_string_initialise_with_allocator(&buffer, &test->allocator);
+
+    AftStringSlice slice = aft_string_slice_from_c_string(
+            u8"Café ṩ q\xcc\x87\xcc\xa3 ǖ");
+
+    AftMaybeStringSlice nfd = aft_utf8_normalize_nfd(slice, &buffer);
+    AftStringSlice expected = aft_string_slice_from_c_string(
+            u8"Cafe\xcc\x81 s\xcc\xa3\xcc\x87 q\xcc\xa3\xcc\x87 u\xcc\x88\xcc\x84");
+
+    bool result = nfd.valid && aft_string_slice_matches(nfd.value, expected);
+
+    aft_string_destroy(&buffer);
+
+    return result;
+}
+
+static bool test_whitespace(Test* test)
+{
+    (void) test;
+
+    return aft_unicode_is_whitespace(U' ')
+            && aft_unicode_is_whitespace(U'\t')
+            && aft_unicode_is_whitespace(0x85)
+            && aft_unicode_is_whitespace(U' ')
+            && aft_unicode_is_whitespace(U' ')
+            && aft_unicode_is_whitespace(U'　')
+            && !aft_unicode_is_whitespace(U'​')
+            && !aft_unicode_is_whitespace(U'x');
+}
+
+static bool test_word_iterator(Test* test)
+{
+    (void) test;
+
+    const char* expected[] =
+    {
+        "Can't", " ", "stop", ",", " ", "3.14", " ", "e.g", ".", "  ", "snake_case",
+        " ", u8"Café", " ", u8"カタカナ", u8"漢", u8"字", "\r\n", u8"🇯🇵", u8"🇰🇷",
+    };
+    const int expected_count = sizeof(expected) / sizeof(*expected);
+
+    AftString text;
+    aft_string_initialise_with_allocator(&text, &test->allocator);
+
+    bool result = true;
+
+    for(int word_index = 0; word_index < expected_count; word_index += 1)
+    {
+        result = result && aft_string_append_c_string(&text, expected[word_index]);
+    }
+
+    AftWordIterator it;
+    aft_word_iterator_set_string(&it, aft_string_slice_from_string(&text));
+
+    for(int word_index = 0; word_index < expected_count; word_index += 1)
+    {
+        AftMaybeStringSlice word = aft_word_iterator_next(&it);
+        AftStringSlice expected_word = aft_string_slice_from_c_string(expected[word_index]);
+        result = result && word.valid && aft_string_slice_matches(word.value, expected_word);
+    }
+
+    result = result && !aft_word_iterator_next(&it).valid;
+
+    aft_string_destroy(&text);
+
+    return result;
+}
+
+static bool test_word_iterator_ignored(Test* test)
+{
+    (void) test;
+
+    // The combining accent and zero width joiner are ignored, so the
+    // apostrophe still joins the letters on either side.
+    AftStringSlice slice = aft_string_slice_from_c_string(
+            u8"e\xcc\x81'\xe2\x80\x8dt 1,\xe2\x80\x8d" "2");
+
+    AftWordIterator it;
+    aft_word_iterator_set_string(&it, slice);
+
+    AftMaybeStringSlice first = aft_word_iterator_next(&it);
+    AftMaybeStringSlice space = aft_word_iterator_next(&it);
+    AftMaybeStringSlice number = aft_word_iterator_next(&it);
+
+    return first.valid
+            && aft_string_slice_count(first.value) == 8
+            && space.valid
+            && aft_string_slice_count(space.value) == 1
+            && number.valid
+            && aft_string_slice_count(number.value) == 6
+            && !aft_word_iterator_next(&it).valid;
+}
+
+int main(int argc, const char** argv)
+{
+    Suite suite = {0};
+
+    add_test(&suite, test_alphabetic, "Alphabetic");
+    add_test(&suite, test_category, "Category");
+    add_test(&suite, test_classify, "Classify");
+    add_test(&suite, test_classify_invalid, "Classify Invalid");
+    add_test(&suite, test_equals_folded, "Equals Folded");
+    add_test(&suite, test_equals_folded_long, "Equals Folded Long");
+    add_test(&suite, test_find_folded, "Find Folded");
+    add_test(&suite, test_fold_case, "Fold Case");
+    add_test(&suite, test_fold_case_codepoint, "Fold Case Codepoint");
+    add_test(&suite, test_grapheme_iterator, "Grapheme Iterator");
+    add_test(&suite, test_grapheme_iterator_ascii, "Grapheme Iterator ASCII");
+    add_test(&suite, test_normalize_already_normalized, "Normalize Already Normalized");
+    add_test(&suite, test_normalize_hangul, "Normalize Hangul");
+    add_test(&suite, test_normalize_invalid, "Normalize Invalid");
+    add_test(&suite, test_normalize_long_mark_run, "Normalize Long Mark Run");
+    add_test(&suite, test_normalize_maybe, "Normalize Maybe");
+    add_test(&suite, test_normalize_nfc, "Normalize NFC");
+    add_test(&suite, test_normalize_nfd, "Normalize NFD");
+    add_test(&suite, test_whitespace, "Whitespace");
+    add_test(&suite, test_word_iterator, "Word Iterator");
+    add_test(&suite, test_word_iterator_ignored, "Word Iterator Ignored");
+
+    bool success = run_tests(&suite);
+    return !success;
+}
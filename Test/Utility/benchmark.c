@@ -0,0 +1,111 @@
+#if defined(__linux__)
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include "benchmark.h"
+
+#include "platform_definitions.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(OS_LINUX)
+#include <time.h>
+#elif defined(OS_WINDOWS)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#endif
+
+
+#define MINIMUM_NANOSECONDS 250000000
+
+
+static uint64_t get_nanoseconds(void)
+{
+#if defined(OS_LINUX)
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint64_t) now.tv_sec * UINT64_C(1000000000) + (uint64_t) now.tv_nsec;
+#elif defined(OS_WINDOWS)
+    LARGE_INTEGER frequency;
+    LARGE_INTEGER counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    return (uint64_t) ((double) counter.QuadPart * (1e9 / (double) frequency.QuadPart));
+#endif
+}
+
+void add_benchmark(BenchmarkSuite* suite, BenchmarkCall run, const char* name)
+{
+    if(suite->benchmark_count + 1 >= suite->benchmark_cap)
+    {
+        int prior_cap = suite->benchmark_cap;
+        int cap = (suite->benchmark_cap) ? suite->benchmark_cap * 2 : 16;
+
+        BenchmarkSpec* specs = calloc(cap, sizeof(BenchmarkSpec));
+
+        if(prior_cap)
+        {
+            memcpy(specs, suite->specs, sizeof(BenchmarkSpec) * prior_cap);
+            free(suite->specs);
+        }
+
+        suite->specs = specs;
+        suite->benchmark_cap = cap;
+    }
+
+    int index = suite->benchmark_count;
+    suite->specs[index].name = name;
+    suite->specs[index].run = run;
+    suite->benchmark_count += 1;
+}
+
+// Each benchmark is run with double the iterations of the last until it takes
+// long enough to time reliably. Only the benchmarks with the filter in their
+// name are run, or all of them if there's no filter.
+void run_benchmarks(BenchmarkSuite* suite, const char* filter)
+{
+    FILE* file = stdout;
+
+    for(int benchmark_index = 0;
+            benchmark_index < suite->benchmark_count;
+            benchmark_index += 1)
+    {
+        BenchmarkSpec spec = suite->specs[benchmark_index];
+
+        if(filter && !strstr(spec.name, filter))
+        {
+            continue;
+        }
+
+        for(int iterations = 1; iterations > 0; iterations *= 2)
+        {
+            Benchmark benchmark = {0};
+            benchmark.iterations = iterations;
+            random_seed(&benchmark.generator, 0x5eed);
+
+            spec.run(&benchmark);
+
+            ASSERT(benchmark.allocator.bytes_used == 0);
+
+            if(benchmark.elapsed_nanoseconds >= MINIMUM_NANOSECONDS)
+            {
+                double per_iteration = (double) benchmark.elapsed_nanoseconds / iterations;
+                fprintf(file, "%-40s %12d %14.1f ns/op\n", spec.name, iterations,
+                        per_iteration);
+                break;
+            }
+        }
+    }
+}
+
+void start_timing(Benchmark* benchmark)
+{
+    benchmark->start_nanoseconds = get_nanoseconds();
+}
+
+void stop_timing(Benchmark* benchmark)
+{
+    benchmark->elapsed_nanoseconds += get_nanoseconds() - benchmark->start_nanoseconds;
+}
@@ -0,0 +1,43 @@
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+#include "random.h"
+#include "test.h"
+
+#include <stdint.h>
+
+
+typedef struct Benchmark Benchmark;
+
+typedef void (*BenchmarkCall)(Benchmark* benchmark);
+
+struct Benchmark
+{
+    Allocator allocator;
+    RandomGenerator generator;
+    uint64_t elapsed_nanoseconds;
+    uint64_t start_nanoseconds;
+    uint64_t result;
+    int iterations;
+};
+
+typedef struct BenchmarkSpec
+{
+    BenchmarkCall run;
+    const char* name;
+} BenchmarkSpec;
+
+typedef struct BenchmarkSuite
+{
+    BenchmarkSpec* specs;
+    int benchmark_count;
+    int benchmark_cap;
+} BenchmarkSuite;
+
+
+void add_benchmark(BenchmarkSuite* suite, BenchmarkCall run, const char* name);
+void run_benchmarks(BenchmarkSuite* suite, const char* filter);
+void start_timing(Benchmark* benchmark);
+void stop_timing(Benchmark* benchmark);
+
+#endif // BENCHMARK_H_
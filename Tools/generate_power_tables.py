@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+"""Generate the power of five tables in Source/power_tables.c and .h.
+
+Usage: generate_power_tables.py [<output directory>]
+
+The output directory defaults to Source next to this script.
+
+Each entry is 128 bits, stored as its low then high 64 bits.
+
+The split tables are for finding the shortest digits of a double.
+
+- pow5_split[i] is 5^i, shifted to be POW5_BITCOUNT bits long.
+- pow5_inverse_split[i] is 2^k / 5^i, rounded up, where k is chosen to make
+  it POW5_INVERSE_BITCOUNT bits long.
+
+The parse table is for reading decimal numbers with the Eisel-Lemire
+algorithm. pow5_parse[q - POW5_PARSE_MIN_EXPONENT] is 5^q shifted to be 128
+bits long, truncated for q >= 0. For q < 0 it's rounded up, in the same way
+as the table in "Number Parsing at a Gigabyte per Second" by Daniel Lemire.
+"""
+
+import os
+import sys
+
+
+POW5_BITCOUNT = 125
+POW5_INVERSE_BITCOUNT = 125
+POW5_SPLIT_COUNT = 326
+POW5_INVERSE_SPLIT_COUNT = 342
+POW5_PARSE_MAX_EXPONENT = 308
+POW5_PARSE_MIN_EXPONENT = -342
+
+MASK64 = (1 << 64) - 1
+
+
+def build_pow5_split():
+    values = []
+    for i in range(POW5_SPLIT_COUNT):
+        pow5 = 5 ** i
+        shift = pow5.bit_length() - POW5_BITCOUNT
+        values.append(pow5 >> shift if shift >= 0 else pow5 << -shift)
+    return values
+
+
+def build_pow5_inverse_split():
+    values = []
+    for i in range(POW5_INVERSE_SPLIT_COUNT):
+        pow5 = 5 ** i
+        shift = pow5.bit_length() - 1 + POW5_INVERSE_BITCOUNT
+        values.append((1 << shift) // pow5 + 1)
+    return values
+
+
+def build_pow5_parse():
+    values = []
+    for q in range(POW5_PARSE_MIN_EXPONENT, 0):
+        pow5 = 5 ** -q
+        z = (pow5 - 1).bit_length()
+        if q >= -27:
+            value = (1 << (z + 127)) // pow5 + 1
+        else:
+            value = (1 << (2 * z + 128)) // pow5 + 1
+            while value >= 1 << 128:
+                value //= 2
+        values.append(value)
+    for q in range(0, POW5_PARSE_MAX_EXPONENT + 1):
+        value = 5 ** q
+        while value < 1 << 127:
+            value *= 2
+        while value >= 1 << 128:
+            value //= 2
+        values.append(value)
+    return values
+
+
+def format_split_array(declaration, values):
+    lines = [declaration + ' =', '{']
+    for value in values:
+        lines.append('    {UINT64_C(0x%016x), UINT64_C(0x%016x)},' % (value & MASK64, value >> 64))
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def write_tables(output_directory, arrays):
+    header_lines = [
+        '// Generated by Tools/generate_power_tables.py. Don\'t edit this by hand.',
+        '',
+        '#ifndef POWER_TABLES_H_',
+        '#define POWER_TABLES_H_',
+        '',
+        '#include <stdint.h>',
+        '',
+        '#define POW5_BITCOUNT %d' % POW5_BITCOUNT,
+        '#define POW5_INVERSE_BITCOUNT %d' % POW5_INVERSE_BITCOUNT,
+        '#define POW5_PARSE_MAX_EXPONENT %d' % POW5_PARSE_MAX_EXPONENT,
+        '#define POW5_PARSE_MIN_EXPONENT (%d)' % POW5_PARSE_MIN_EXPONENT,
+        '',
+    ]
+    source_lines = [
+        '// Generated by Tools/generate_power_tables.py. Don\'t edit this by hand.',
+        '',
+        '#include "power_tables.h"',
+        '',
+    ]
+
+    for name, values in arrays:
+        declaration = 'const uint64_t %s[%d][2]' % (name, len(values))
+        header_lines.append('extern ' + declaration + ';')
+        source_lines.append(format_split_array(declaration, values))
+        source_lines.append('')
+
+    header_lines.append('')
+    header_lines.append('#endif // POWER_TABLES_H_')
+
+    with open(os.path.join(output_directory, 'power_tables.h'), 'w', newline='\n') as file:
+        file.write('\n'.join(header_lines) + '\n')
+    with open(os.path.join(output_directory, 'power_tables.c'), 'w', newline='\n') as file:
+        file.write('\n'.join(source_lines).rstrip('\n') + '\n')
+
+
+def main():
+    if len(sys.argv) > 1:
+        output_directory = sys.argv[1]
+    else:
+        output_directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Source')
+
+    arrays = [
+        ('pow5_inverse_split', build_pow5_inverse_split()),
+        ('pow5_parse', build_pow5_parse()),
+        ('pow5_split', build_pow5_split()),
+    ]
+
+    write_tables(output_directory, arrays)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,457 @@
+#!/usr/bin/env python3
+"""Generate the Unicode property tables in Source/unicode_data.c and .h.
+
+Usage: generate_unicode_data.py <ucd directory> [<output directory>]
+
+The UCD directory is an unzipped copy of UCD.zip from
+https://www.unicode.org/Public/UCD/latest/ucd/ and the output directory
+defaults to Source next to this script.
+"""
+
+import os
+import re
+import sys
+
+
+CODEPOINT_COUNT = 0x110000
+
+CATEGORIES = [
+    ('Cn', 'UNASSIGNED'),
+    ('Lu', 'UPPERCASE_LETTER'),
+    ('Ll', 'LOWERCASE_LETTER'),
+    ('Lt', 'TITLECASE_LETTER'),
+    ('Lm', 'MODIFIER_LETTER'),
+    ('Lo', 'OTHER_LETTER'),
+    ('Mn', 'NONSPACING_MARK'),
+    ('Mc', 'SPACING_MARK'),
+    ('Me', 'ENCLOSING_MARK'),
+    ('Nd', 'DECIMAL_NUMBER'),
+    ('Nl', 'LETTER_NUMBER'),
+    ('No', 'OTHER_NUMBER'),
+    ('Pc', 'CONNECTOR_PUNCTUATION'),
+    ('Pd', 'DASH_PUNCTUATION'),
+    ('Ps', 'OPEN_PUNCTUATION'),
+    ('Pe', 'CLOSE_PUNCTUATION'),
+    ('Pi', 'INITIAL_PUNCTUATION'),
+    ('Pf', 'FINAL_PUNCTUATION'),
+    ('Po', 'OTHER_PUNCTUATION'),
+    ('Sm', 'MATH_SYMBOL'),
+    ('Sc', 'CURRENCY_SYMBOL'),
+    ('Sk', 'MODIFIER_SYMBOL'),
+    ('So', 'OTHER_SYMBOL'),
+    ('Zs', 'SPACE_SEPARATOR'),
+    ('Zl', 'LINE_SEPARATOR'),
+    ('Zp', 'PARAGRAPH_SEPARATOR'),
+    ('Cc', 'CONTROL'),
+    ('Cf', 'FORMAT'),
+    ('Cs', 'SURROGATE'),
+    ('Co', 'PRIVATE_USE'),
+]
+
+# These match the AFT_UNICODE_CLASS_* flags in aft_unicode.h.
+CLASS_ALPHABETIC = 0x20
+CLASS_WHITESPACE = 0x40
+
+GRAPHEME_BREAKS = [
+    ('Other', 'OTHER'),
+    ('CR', 'CR'),
+    ('LF', 'LF'),
+    ('Control', 'CONTROL'),
+    ('Extend', 'EXTEND'),
+    ('ZWJ', 'ZWJ'),
+    ('Regional_Indicator', 'REGIONAL_INDICATOR'),
+    ('Prepend', 'PREPEND'),
+    ('SpacingMark', 'SPACING_MARK'),
+    ('L', 'L'),
+    ('V', 'V'),
+    ('T', 'T'),
+    ('LV', 'LV'),
+    ('LVT', 'LVT'),
+]
+
+WORD_BREAKS = [
+    ('Other', 'OTHER'),
+    ('CR', 'CR'),
+    ('LF', 'LF'),
+    ('Newline', 'NEWLINE'),
+    ('Extend', 'EXTEND'),
+    ('ZWJ', 'ZWJ'),
+    ('Regional_Indicator', 'REGIONAL_INDICATOR'),
+    ('Format', 'FORMAT'),
+    ('Katakana', 'KATAKANA'),
+    ('Hebrew_Letter', 'HEBREW_LETTER'),
+    ('ALetter', 'ALETTER'),
+    ('Single_Quote', 'SINGLE_QUOTE'),
+    ('Double_Quote', 'DOUBLE_QUOTE'),
+    ('MidNumLet', 'MID_NUM_LET'),
+    ('MidLetter', 'MID_LETTER'),
+    ('MidNum', 'MID_NUM'),
+    ('Numeric', 'NUMERIC'),
+    ('ExtendNumLet', 'EXTEND_NUM_LET'),
+    ('WSegSpace', 'WSEG_SPACE'),
+]
+
+# Set in the break tables for Extended_Pictographic codepoints, which both
+# grapheme and word boundaries use.
+EXTENDED_PICTOGRAPHIC = 0x80
+
+
+def read_lines(path):
+    with open(path, encoding='utf-8') as file:
+        for line in file:
+            line = line.split('#', 1)[0].strip()
+            if line:
+                yield [field.strip() for field in line.split(';')]
+
+
+def parse_range(field):
+    if '..' in field:
+        first, last = field.split('..')
+        return int(first, 16), int(last, 16)
+    codepoint = int(field, 16)
+    return codepoint, codepoint
+
+
+def read_version(ucd_directory):
+    with open(os.path.join(ucd_directory, 'PropList.txt'), encoding='utf-8') as file:
+        match = re.search(r'(\d+\.\d+\.\d+)', file.readline())
+    return match.group(1) if match else 'unknown'
+
+
+def read_unicode_data(ucd_directory):
+    """Return a list of the fields of UnicodeData.txt for every codepoint,
+    with the ranges marked First and Last filled in."""
+    entries = [None] * CODEPOINT_COUNT
+    range_start = None
+    for fields in read_lines(os.path.join(ucd_directory, 'UnicodeData.txt')):
+        codepoint = int(fields[0], 16)
+        name = fields[1]
+        if name.endswith(', First>'):
+            range_start = codepoint
+            continue
+        if name.endswith(', Last>'):
+            for inside in range(range_start, codepoint + 1):
+                entries[inside] = fields
+            continue
+        entries[codepoint] = fields
+    return entries
+
+
+def read_binary_property(path, name):
+    values = [False] * CODEPOINT_COUNT
+    for fields in read_lines(path):
+        if fields[1] == name:
+            first, last = parse_range(fields[0])
+            for codepoint in range(first, last + 1):
+                values[codepoint] = True
+    return values
+
+
+def split_blocks(values, shift):
+    """Split a table into its distinct blocks of a given size, and an index of
+    which block each part of the table uses."""
+    block_size = 1 << shift
+    blocks = {}
+    index = []
+    contents = []
+    for start in range(0, len(values), block_size):
+        block = tuple(values[start:start + block_size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            contents.extend(block)
+        index.append(blocks[block])
+    return index, contents
+
+
+def element_type(values):
+    return 'uint8_t' if max(values) <= 0xff else 'uint16_t'
+
+
+def element_size(values):
+    return 1 if max(values) <= 0xff else 2
+
+
+def split_table(values):
+    """Split a table into three stages, where the first two hold indices of
+    blocks in the next stage. The block sizes are picked to make the stages
+    smallest in total."""
+    best = None
+    for low_shift in range(4, 9):
+        index, stage3 = split_blocks(values, low_shift)
+        for middle_shift in range(2, 8):
+            stage1, stage2 = split_blocks(index, middle_shift)
+            size = (len(stage1) * element_size(stage1)
+                    + len(stage2) * element_size(stage2)
+                    + len(stage3) * element_size(stage3))
+            if best is None or size < best[0]:
+                best = (size, low_shift, middle_shift, stage1, stage2, stage3)
+    return best[1:]
+
+
+def format_array(declaration, values, per_line=16):
+    lines = [declaration + ' =', '{']
+    for start in range(0, len(values), per_line):
+        row = values[start:start + per_line]
+        lines.append('    ' + ', '.join(str(value) for value in row) + ',')
+    lines.append('};')
+    return '\n'.join(lines)
+
+
+def build_class_table(ucd_directory, unicode_data):
+    category_index = {code: index for index, (code, _) in enumerate(CATEGORIES)}
+    whitespace = read_binary_property(os.path.join(ucd_directory, 'PropList.txt'), 'White_Space')
+    alphabetic = read_binary_property(
+            os.path.join(ucd_directory, 'DerivedCoreProperties.txt'), 'Alphabetic')
+
+    classes = []
+    for codepoint in range(CODEPOINT_COUNT):
+        fields = unicode_data[codepoint]
+        value = category_index[fields[2]] if fields else 0
+        if alphabetic[codepoint]:
+            value |= CLASS_ALPHABETIC
+        if whitespace[codepoint]:
+            value |= CLASS_WHITESPACE
+        classes.append(value)
+    return classes
+
+
+def build_case_folding(ucd_directory):
+    """Return a table of which record each codepoint uses and the records
+    themselves. Each record is the difference between the simple case folding
+    and the codepoint, and the index of its full case folding when that's
+    more than one codepoint. The sequences for full case folding are padded to
+    three codepoints, and sequence 0 is unused."""
+    simple = {}
+    full = {}
+    for fields in read_lines(os.path.join(ucd_directory, 'CaseFolding.txt')):
+        codepoint = int(fields[0], 16)
+        status = fields[1]
+        mapping = [int(field, 16) for field in fields[2].split()]
+        if status in ('C', 'S'):
+            simple[codepoint] = mapping[0]
+        if status in ('C', 'F'):
+            full[codepoint] = mapping
+
+    records = [(0, 0)]
+    record_indices = {(0, 0): 0}
+    sequences = [0, 0, 0]
+    values = [0] * CODEPOINT_COUNT
+
+    for codepoint in sorted(set(simple) | set(full)):
+        delta = simple.get(codepoint, codepoint) - codepoint
+        sequence_index = 0
+        mapping = full.get(codepoint)
+        if mapping and len(mapping) > 1:
+            sequence_index = len(sequences) // 3
+            sequences.extend(mapping + [0] * (3 - len(mapping)))
+        record = (delta, sequence_index)
+        if record not in record_indices:
+            record_indices[record] = len(records)
+            records.append(record)
+        values[codepoint] = record_indices[record]
+
+    arrays = [
+        ('int32_t', 'unicode_case_fold_deltas', [record[0] for record in records]),
+        (element_type([record[1] for record in records]), 'unicode_case_fold_sequence_indices',
+                [record[1] for record in records]),
+        ('uint32_t', 'unicode_case_fold_sequences', sequences),
+    ]
+    return values, arrays
+
+
+def build_normalization(ucd_directory, unicode_data):
+    """Return the tables and arrays used for normalization.
+
+    The quick check table holds NFC_Quick_Check in its low two bits, as 0
+    for yes, 1 for no and 2 for maybe, and has bit 2 set when
+    NFD_Quick_Check is no. The decomposition table holds the index of each
+    codepoint's full canonical decomposition, stored as a count followed by
+    the codepoints, where index 0 is unused. Compositions are a sorted list
+    of keys, which are the two codepoints shifted together, and the
+    codepoints they compose to. Hangul syllables are left out, since those
+    are decomposed and composed by formula."""
+    combining_classes = [0] * CODEPOINT_COUNT
+    canonical = {}
+    for codepoint in range(CODEPOINT_COUNT):
+        fields = unicode_data[codepoint]
+        if not fields:
+            continue
+        combining_classes[codepoint] = int(fields[3])
+        decomposition = fields[5]
+        if decomposition and not decomposition.startswith('<'):
+            canonical[codepoint] = [int(field, 16) for field in decomposition.split()]
+
+    quick_check = [0] * CODEPOINT_COUNT
+    exclusions = set()
+    path = os.path.join(ucd_directory, 'DerivedNormalizationProps.txt')
+    for fields in read_lines(path):
+        first, last = parse_range(fields[0])
+        for codepoint in range(first, last + 1):
+            if fields[1] == 'Full_Composition_Exclusion':
+                exclusions.add(codepoint)
+            elif fields[1] == 'NFC_QC':
+                quick_check[codepoint] |= 1 if fields[2] == 'N' else 2
+            elif fields[1] == 'NFD_QC' and fields[2] == 'N':
+                quick_check[codepoint] |= 4
+
+    def decompose(codepoint):
+        if codepoint not in canonical:
+            return [codepoint]
+        result = []
+        for part in canonical[codepoint]:
+            result.extend(decompose(part))
+        return result
+
+    decompositions = [0] * CODEPOINT_COUNT
+    sequences = [0]
+    for codepoint in sorted(canonical):
+        sequence = decompose(codepoint)
+        decompositions[codepoint] = len(sequences)
+        sequences.append(len(sequence))
+        sequences.extend(sequence)
+
+    compositions = []
+    for codepoint, parts in canonical.items():
+        if len(parts) == 2 and codepoint not in exclusions:
+            compositions.append(((parts[0] << 21) | parts[1], codepoint))
+    compositions.sort()
+
+    tables = [
+        ('unicode_combining_class', combining_classes),
+        ('unicode_decomposition', decompositions),
+        ('unicode_quick_check', quick_check),
+    ]
+    arrays = [
+        ('uint32_t', 'unicode_decomposition_sequences', sequences),
+        ('uint64_t', 'unicode_composition_keys', [key for key, _ in compositions]),
+        ('uint32_t', 'unicode_composition_values', [value for _, value in compositions]),
+    ]
+    return tables, arrays
+
+
+def build_break_tables(ucd_directory):
+    """Return the grapheme and word break property tables. Each holds the
+    index of a codepoint's property value in GRAPHEME_BREAKS or WORD_BREAKS,
+    with EXTENDED_PICTOGRAPHIC set for pictographs."""
+    pictographic = read_binary_property(
+            os.path.join(ucd_directory, 'emoji', 'emoji-data.txt'), 'Extended_Pictographic')
+
+    def read_breaks(filename, names):
+        value_index = {name: index for index, (name, _) in enumerate(names)}
+        values = [0] * CODEPOINT_COUNT
+        for fields in read_lines(os.path.join(ucd_directory, 'auxiliary', filename)):
+            first, last = parse_range(fields[0])
+            for codepoint in range(first, last + 1):
+                values[codepoint] = value_index[fields[1]]
+        for codepoint in range(CODEPOINT_COUNT):
+            if pictographic[codepoint]:
+                values[codepoint] |= EXTENDED_PICTOGRAPHIC
+        return values
+
+    tables = [
+        ('unicode_grapheme_break', read_breaks('GraphemeBreakProperty.txt', GRAPHEME_BREAKS)),
+        ('unicode_word_break', read_breaks('WordBreakProperty.txt', WORD_BREAKS)),
+    ]
+    return tables
+
+
+def format_enum(type_name, prefix, names):
+    lines = ['typedef enum %s' % type_name, '{']
+    for _, name in names:
+        lines.append('    %s_%s,' % (prefix, name))
+    lines.append('} %s;' % type_name)
+    return lines
+
+
+def write_tables(output_directory, version, tables, arrays):
+    header_lines = [
+        '// Generated by Tools/generate_unicode_data.py from the Unicode Character',
+        '// Database %s. Don\'t edit this by hand.' % version,
+        '',
+        '#ifndef UNICODE_DATA_H_',
+        '#define UNICODE_DATA_H_',
+        '',
+        '#include <stdint.h>',
+        '',
+        '#define UNICODE_EXTENDED_PICTOGRAPHIC 0x%x' % EXTENDED_PICTOGRAPHIC,
+        '',
+    ]
+    header_lines.extend(format_enum('GraphemeBreak', 'GRAPHEME_BREAK', GRAPHEME_BREAKS))
+    header_lines.append('')
+    header_lines.extend(format_enum('WordBreak', 'WORD_BREAK', WORD_BREAKS))
+    header_lines.append('')
+    source_lines = [
+        '// Generated by Tools/generate_unicode_data.py from the Unicode Character',
+        '// Database %s. Don\'t edit this by hand.' % version,
+        '',
+        '#include "unicode_data.h"',
+        '',
+    ]
+
+    for name, values in tables:
+        low_shift, middle_shift, stage1, stage2, stage3 = split_table(values)
+        stages = [('stage1', stage1), ('stage2', stage2), ('stage3', stage3)]
+
+        for stage_name, stage in stages:
+            declaration = 'const %s %s_%s[%d]' % (element_type(stage), name, stage_name, len(stage))
+            header_lines.append('extern ' + declaration + ';')
+            source_lines.append(format_array(declaration, stage))
+            source_lines.append('')
+
+        header_lines.extend([
+            '',
+            'static inline %s %s_lookup(uint32_t codepoint)' % (element_type(stage3), name),
+            '{',
+            '    uint32_t block = %s_stage1[codepoint >> %d];' % (name, low_shift + middle_shift),
+            '    uint32_t middle = (codepoint >> %d) & 0x%x;' % (low_shift, (1 << middle_shift) - 1),
+            '    uint32_t index = %s_stage2[(block << %d) + middle];' % (name, middle_shift),
+            '    return %s_stage3[(index << %d) + (codepoint & 0x%x)];'
+                    % (name, low_shift, (1 << low_shift) - 1),
+            '}',
+            '',
+        ])
+
+    for c_type, name, values in arrays:
+        declaration = 'const %s %s[%d]' % (c_type, name, len(values))
+        header_lines.append('extern ' + declaration + ';')
+        source_lines.append(format_array(declaration, values))
+        source_lines.append('')
+
+    header_lines.append('')
+    header_lines.append('#endif // UNICODE_DATA_H_')
+
+    with open(os.path.join(output_directory, 'unicode_data.h'), 'w', newline='\n') as file:
+        file.write('\n'.join(header_lines) + '\n')
+    with open(os.path.join(output_directory, 'unicode_data.c'), 'w', newline='\n') as file:
+        file.write('\n'.join(source_lines).rstrip('\n') + '\n')
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+
+    ucd_directory = sys.argv[1]
+    if len(sys.argv) > 2:
+        output_directory = sys.argv[2]
+    else:
+        output_directory = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'Source')
+
+    version = read_version(ucd_directory)
+    unicode_data = read_unicode_data(ucd_directory)
+
+    case_folding, case_folding_arrays = build_case_folding(ucd_directory)
+    normalization_tables, normalization_arrays = build_normalization(ucd_directory, unicode_data)
+
+    tables = [
+        ('unicode_case_fold', case_folding),
+        ('unicode_class', build_class_table(ucd_directory, unicode_data)),
+    ]
+    tables.extend(normalization_tables)
+    tables.extend(build_break_tables(ucd_directory))
+    arrays = case_folding_arrays + normalization_arrays
+
+    write_tables(output_directory, version, tables, arrays)
+
+
+if __name__ == '__main__':
+    main()
@@ -25,3 +25,5 @@ class AftstringConan(ConanFile):
 
     def package_info(self):
         self.cpp_info.libs = ["AftString"]
+        if self.settings.os == "Linux":
+            self.cpp_info.libs.append("pthread")